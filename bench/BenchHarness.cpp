@@ -0,0 +1,191 @@
+#include "BenchHarness.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QTextStream>
+#include <QtMath>
+#include <algorithm>
+#include <cstdio>
+
+namespace bench {
+
+namespace {
+
+struct Entry {
+    QString name;
+    Function function;
+};
+
+QVector<Entry>& registry() {
+    static QVector<Entry> entries;
+    return entries;
+}
+
+struct Summary {
+    int    iterations = 0;
+    double meanNs = 0;
+    double medianNs = 0;
+    double minNs = 0;
+    double maxNs = 0;
+    double stddevNs = 0;
+};
+
+Summary summarize(QVector<qint64> samples) {
+    Summary s;
+    if (samples.isEmpty()) return s;
+    std::sort(samples.begin(), samples.end());
+    s.iterations = samples.size();
+    s.minNs = samples.first();
+    s.maxNs = samples.last();
+    const int mid = samples.size() / 2;
+    s.medianNs = samples.size() % 2 ? samples.at(mid) : (samples.at(mid - 1) + samples.at(mid)) / 2.0;
+    double sum = 0;
+    for (qint64 v : samples) sum += v;
+    s.meanNs = sum / samples.size();
+    double sq = 0;
+    for (qint64 v : samples) sq += (v - s.meanNs) * (v - s.meanNs);
+    s.stddevNs = samples.size() > 1 ? qSqrt(sq / (samples.size() - 1)) : 0.0;
+    return s;
+}
+
+QString formatNs(double ns) {
+    if (ns >= 1e6) return QString::number(ns / 1e6, 'f', 3) + QStringLiteral(" ms");
+    if (ns >= 1e3) return QString::number(ns / 1e3, 'f', 2) + QStringLiteral(" us");
+    return QString::number(ns, 'f', 0) + QStringLiteral(" ns");
+}
+
+} // namespace
+
+// --- State ---
+
+bool State::keepRunning() {
+    if (m_iteration >= 0) {
+        if (m_paused) resumeTiming();
+        const qint64 elapsed = m_timer.nsecsElapsed() - m_pausedNs;
+        if (m_iteration >= kWarmupIterations) {
+            m_samples.append(elapsed);
+            m_totalNs += elapsed;
+        }
+    }
+    ++m_iteration;
+
+    const int measured = m_iteration - kWarmupIterations;
+    if (measured >= m_limits.maxIterations) return false;
+    if (measured >= m_limits.minIterations && m_totalNs >= m_limits.minTimeNs) return false;
+
+    m_pausedNs = 0;
+    m_timer.start();
+    return true;
+}
+
+void State::pauseTiming() {
+    if (m_paused) return;
+    m_paused = true;
+    m_pauseStart = m_timer.nsecsElapsed();
+}
+
+void State::resumeTiming() {
+    if (!m_paused) return;
+    m_paused = false;
+    m_pausedNs += m_timer.nsecsElapsed() - m_pauseStart;
+}
+
+void registerBenchmark(const QString& name, Function function) {
+    registry().append({ name, std::move(function) });
+}
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+    // 默认离屏渲染：结果不受窗口管理器 / 合成器影响，也可在无显示环境（CI）中运行
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    QApplication app(argc, argv);
+    QApplication::setStyle(QStringLiteral("Fusion"));
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Fluent widget benchmarks"));
+    parser.addHelpOption();
+    const QCommandLineOption jsonOption(QStringLiteral("json"), QStringLiteral("Write results as JSON to <path>."), QStringLiteral("path"));
+    const QCommandLineOption filterOption(QStringLiteral("filter"), QStringLiteral("Run benchmarks whose name matches <regex>."), QStringLiteral("regex"));
+    const QCommandLineOption minTimeOption(QStringLiteral("min-time-ms"), QStringLiteral("Minimum measured time per benchmark."), QStringLiteral("ms"), QStringLiteral("300"));
+    const QCommandLineOption minItersOption(QStringLiteral("min-iterations"), QStringLiteral("Minimum measured iterations."), QStringLiteral("n"), QStringLiteral("5"));
+    const QCommandLineOption maxItersOption(QStringLiteral("max-iterations"), QStringLiteral("Maximum measured iterations."), QStringLiteral("n"), QStringLiteral("10000"));
+    const QCommandLineOption listOption(QStringLiteral("list"), QStringLiteral("List benchmark names and exit."));
+    parser.addOptions({ jsonOption, filterOption, minTimeOption, minItersOption, maxItersOption, listOption });
+    parser.process(app);
+
+    const QRegularExpression filter(parser.value(filterOption));
+    bench::State::Limits limits;
+    limits.minTimeNs = parser.value(minTimeOption).toLongLong() * 1000 * 1000;
+    limits.minIterations = qMax(1, parser.value(minItersOption).toInt());
+    limits.maxIterations = qMax(limits.minIterations, parser.value(maxItersOption).toInt());
+
+    QTextStream out(stdout);
+    QJsonArray results;
+    for (const bench::Entry& entry : bench::registry()) {
+        if (!filter.pattern().isEmpty() && !filter.match(entry.name).hasMatch()) continue;
+        if (parser.isSet(listOption)) {
+            out << entry.name << '\n';
+            continue;
+        }
+
+        bench::State state(limits);
+        entry.function(state);
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        const bench::Summary s = bench::summarize(state.samples());
+        out << QStringLiteral("%1  %2 iters  median %3  mean %4  min %5")
+                   .arg(entry.name, -48).arg(s.iterations, 6)
+                   .arg(bench::formatNs(s.medianNs), 12).arg(bench::formatNs(s.meanNs), 12)
+                   .arg(bench::formatNs(s.minNs), 12) << '\n';
+        out.flush();
+
+        QJsonObject counters;
+        for (auto it = state.counters().cbegin(); it != state.counters().cend(); ++it)
+            counters.insert(it.key(), it.value());
+        results.append(QJsonObject{
+            { QStringLiteral("name"), entry.name },
+            { QStringLiteral("iterations"), s.iterations },
+            { QStringLiteral("median_ns"), s.medianNs },
+            { QStringLiteral("mean_ns"), s.meanNs },
+            { QStringLiteral("min_ns"), s.minNs },
+            { QStringLiteral("max_ns"), s.maxNs },
+            { QStringLiteral("stddev_ns"), s.stddevNs },
+            { QStringLiteral("counters"), counters },
+        });
+    }
+
+    if (parser.isSet(jsonOption) && !parser.isSet(listOption)) {
+        const QJsonObject root{
+            { QStringLiteral("suite"), QFileInfo(QCoreApplication::applicationFilePath()).baseName() },
+            { QStringLiteral("timestamp"), QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+            { QStringLiteral("qt_version"), QString::fromLatin1(qVersion()) },
+            { QStringLiteral("platform"), QGuiApplication::platformName() },
+#ifdef NDEBUG
+            { QStringLiteral("build"), QStringLiteral("release") },
+#else
+            { QStringLiteral("build"), QStringLiteral("debug") },
+#endif
+            { QStringLiteral("benchmarks"), results },
+        };
+        const QString path = parser.value(jsonOption);
+        QDir().mkpath(QFileInfo(path).absolutePath());
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            std::fprintf(stderr, "cannot write %s\n", qPrintable(path));
+            return 1;
+        }
+        file.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+#ifndef BENCHHARNESS_H
+#define BENCHHARNESS_H
+
+#include <QElapsedTimer>
+#include <QMap>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+/**
+ * @brief 轻量基准测试框架（仅依赖 Qt）
+ *
+ * 用法：
+ *   FLUENT_BENCHMARK(ListViewScroll) {
+ *       ... 准备 ...
+ *       while (state.keepRunning()) { ... 被测代码 ... }
+ *       state.setCounter("rows", 100000);
+ *   }
+ * 也可以在运行期用 bench::registerBenchmark() 批量注册（如按控件表生成）。
+ *
+ * 每个基准先预热 kWarmupIterations 轮，之后逐轮计时，直到累计时间达到
+ * --min-time-ms 且至少 --min-iterations 轮（或达到 --max-iterations）。
+ * 结果输出到控制台，并可通过 --json <path> 写成机器可读的 JSON，用于跨版本比较。
+ */
+namespace bench {
+
+class State {
+public:
+    struct Limits {
+        qint64 minTimeNs = 300 * 1000 * 1000LL;
+        int minIterations = 5;
+        int maxIterations = 10000;
+    };
+
+    explicit State(const Limits& limits) : m_limits(limits) {}
+
+    /** 结束上一轮计时并决定是否开始下一轮 */
+    bool keepRunning();
+
+    /** 暂停 / 恢复计时（用于排除每轮的准备工作） */
+    void pauseTiming();
+    void resumeTiming();
+
+    /** 附加的自定义指标（如行数、元素数、每轮帧数），原样写入 JSON */
+    void setCounter(const QString& name, double value) { m_counters.insert(name, value); }
+
+    /** 当前轮次序号（含预热），可用于在每轮之间交替参数 */
+    int iteration() const { return m_iteration; }
+
+    const QVector<qint64>& samples() const { return m_samples; }
+    const QMap<QString, double>& counters() const { return m_counters; }
+
+    static constexpr int kWarmupIterations = 2;
+
+private:
+    Limits m_limits;
+    QElapsedTimer m_timer;
+    qint64 m_pausedNs = 0;
+    qint64 m_pauseStart = 0;
+    qint64 m_totalNs = 0;
+    int  m_iteration = -1;
+    bool m_paused = false;
+    QVector<qint64> m_samples;
+    QMap<QString, double> m_counters;
+};
+
+using Function = std::function<void(State&)>;
+
+void registerBenchmark(const QString& name, Function function);
+
+struct Registrar {
+    Registrar(const char* name, Function function) {
+        registerBenchmark(QString::fromLatin1(name), std::move(function));
+    }
+};
+
+} // namespace bench
+
+#define FLUENT_BENCHMARK(name)                                                     \
+    static void name(::bench::State& state);                                       \
+    static const ::bench::Registrar name##Registrar(#name, name);                  \
+    static void name(::bench::State& state)
+
+#endif // BENCHHARNESS_H
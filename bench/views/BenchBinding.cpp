@@ -0,0 +1,50 @@
+// PropertyBinder 每次更新的开销：按属性名（QMetaProperty / QVariant）与类型化（直接成员调用）两条路径
+#include "BenchHarness.h"
+
+#include "view/QMLPlus.h"
+#include "view/basicinput/Slider.h"
+
+using view::PropertyBinder;
+using view::basicinput::Slider;
+
+namespace {
+
+constexpr int kUpdatesPerIteration = 1000;
+
+// 高频源：Slider 拖动时每个像素都会发出 valueChanged
+void driveSlider(bench::State& state, Slider* source, Slider* target) {
+    source->setRange(0, kUpdatesPerIteration);
+    target->setRange(0, kUpdatesPerIteration);
+    int value = 0;
+    while (state.keepRunning()) {
+        for (int i = 0; i < kUpdatesPerIteration; ++i) {
+            value = (value + 1) % (kUpdatesPerIteration + 1);
+            source->setValue(value);
+        }
+    }
+    state.setCounter(QStringLiteral("updates_per_iteration"), kUpdatesPerIteration);
+    state.setCounter(QStringLiteral("in_sync"), target->value() == source->value() ? 1 : 0);
+}
+
+FLUENT_BENCHMARK(BindingNamedSliderValue) {
+    Slider source(Qt::Horizontal);
+    Slider target(Qt::Horizontal);
+    PropertyBinder::bind(&source, "value", &target, "value");
+    driveSlider(state, &source, &target);
+}
+
+FLUENT_BENCHMARK(BindingTypedSliderValue) {
+    Slider source(Qt::Horizontal);
+    Slider target(Qt::Horizontal);
+    PropertyBinder::bind<&Slider::value, &Slider::setValue>(&source, &Slider::valueChanged, &target);
+    driveSlider(state, &source, &target);
+}
+
+// 基线：源信号无任何绑定时 setValue 自身的开销
+FLUENT_BENCHMARK(BindingNoneSliderValue) {
+    Slider source(Qt::Horizontal);
+    Slider target(Qt::Horizontal);
+    driveSlider(state, &source, &target);
+}
+
+} // namespace
@@ -0,0 +1,93 @@
+// AnchorLayout::setGeometry 在不同规模 / 依赖顺序下的求解耗时
+#include "BenchHarness.h"
+
+#include <QWidget>
+
+#include "view/QMLPlus.h"
+
+using view::AnchorLayout;
+
+namespace {
+
+// 固定 sizeHint 的叶子控件，排除控件自身 sizeHint 计算对测量的影响
+class FixedItem : public QWidget {
+public:
+    using QWidget::QWidget;
+    QSize sizeHint() const override { return QSize(40, 24); }
+};
+
+enum class Order { Forward, Reversed };
+
+/**
+ * 构造 count 个控件的锚点链：第 i 个控件的 left 锚定第 i-1 个控件的 right，
+ * 第 0 个锚定父控件。Reversed 时按倒序加入布局，依赖方先于被依赖方求解，
+ * 用于衡量多轮迭代求解的最坏情况。
+ */
+void buildChain(QWidget* host, AnchorLayout* layout, int count, Order order) {
+    QVector<QWidget*> widgets;
+    widgets.reserve(count);
+    for (int i = 0; i < count; ++i) widgets.append(new FixedItem(host));
+
+    auto anchorsFor = [&](int i) {
+        AnchorLayout::Anchors a;
+        a.left = i == 0 ? AnchorLayout::Anchor(host, AnchorLayout::Edge::Left, 4)
+                        : AnchorLayout::Anchor(widgets[i - 1], AnchorLayout::Edge::Right, 4);
+        a.top = AnchorLayout::Anchor(host, AnchorLayout::Edge::Top, 4 + (i % 8) * 28);
+        return a;
+    };
+    if (order == Order::Forward) {
+        for (int i = 0; i < count; ++i) layout->addAnchoredWidget(widgets[i], anchorsFor(i));
+    } else {
+        for (int i = count - 1; i >= 0; --i) layout->addAnchoredWidget(widgets[i], anchorsFor(i));
+    }
+}
+
+void runChain(bench::State& state, int count, Order order) {
+    QWidget host;
+    auto* layout = new AnchorLayout(&host);
+    buildChain(&host, layout, count, order);
+
+    // 宽度交替变化，避免任何“几何未变则跳过”的捷径掩盖求解开销
+    const QRect rects[2] = { QRect(0, 0, 1200, 800), QRect(0, 0, 1280, 800) };
+    layout->setGeometry(rects[1]);   // 首次布局含 polish / 主题初始化，不计入
+    int flip = 0;
+    while (state.keepRunning()) {
+        layout->setGeometry(rects[flip]);
+        flip ^= 1;
+    }
+    state.setCounter(QStringLiteral("widgets"), count);
+}
+
+void runFill(bench::State& state, int count) {
+    QWidget host;
+    auto* layout = new AnchorLayout(&host);
+    for (int i = 0; i < count; ++i) {
+        AnchorLayout::Anchors a;
+        a.fill = true;
+        a.fillMargins = QMargins(i % 16, i % 16, i % 16, i % 16);
+        layout->addAnchoredWidget(new FixedItem(&host), a);
+    }
+
+    const QRect rects[2] = { QRect(0, 0, 1200, 800), QRect(0, 0, 1280, 800) };
+    layout->setGeometry(rects[1]);
+    int flip = 0;
+    while (state.keepRunning()) {
+        layout->setGeometry(rects[flip]);
+        flip ^= 1;
+    }
+    state.setCounter(QStringLiteral("widgets"), count);
+}
+
+const bool registered = [] {
+    for (int count : { 10, 100, 1000 }) {
+        bench::registerBenchmark(QStringLiteral("layout/anchor_chain/forward/%1").arg(count),
+                                 [count](bench::State& s) { runChain(s, count, Order::Forward); });
+        bench::registerBenchmark(QStringLiteral("layout/anchor_chain/reversed/%1").arg(count),
+                                 [count](bench::State& s) { runChain(s, count, Order::Reversed); });
+        bench::registerBenchmark(QStringLiteral("layout/anchor_fill/%1").arg(count),
+                                 [count](bench::State& s) { runFill(s, count); });
+    }
+    return true;
+}();
+
+} // namespace
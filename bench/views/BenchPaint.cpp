@@ -0,0 +1,226 @@
+// 每个控件的离屏绘制耗时：控件渲染到 QImage（含子控件），不经过窗口系统
+#include "BenchHarness.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QStandardItemModel>
+#include <QWidget>
+#include <functional>
+
+#include "view/basicinput/Button.h"
+#include "view/basicinput/CheckBox.h"
+#include "view/basicinput/ColorPicker.h"
+#include "view/basicinput/ComboBox.h"
+#include "view/basicinput/DropDownButton.h"
+#include "view/basicinput/HyperlinkButton.h"
+#include "view/basicinput/RadioButton.h"
+#include "view/basicinput/RatingControl.h"
+#include "view/basicinput/RepeatButton.h"
+#include "view/basicinput/Slider.h"
+#include "view/basicinput/SplitButton.h"
+#include "view/basicinput/ToggleButton.h"
+#include "view/basicinput/ToggleSplitButton.h"
+#include "view/basicinput/ToggleSwitch.h"
+#include "view/collections/FlipView.h"
+#include "view/collections/GridView.h"
+#include "view/collections/ListView.h"
+#include "view/collections/TreeView.h"
+#include "view/dialogs_flyouts/ContentDialog.h"
+#include "view/dialogs_flyouts/Dialog.h"
+#include "view/dialogs_flyouts/Flyout.h"
+#include "view/dialogs_flyouts/Popup.h"
+#include "view/dialogs_flyouts/TeachingTip.h"
+#include "view/menus_toolbars/Menu.h"
+#include "view/menus_toolbars/MenuBar.h"
+#include "view/scrolling/ScrollBar.h"
+#include "view/status_info/ProgressRing.h"
+#include "view/status_info/ToolTip.h"
+#include "view/textfields/AutoSuggestBox.h"
+#include "view/textfields/Label.h"
+#include "view/textfields/LineEdit.h"
+#include "view/textfields/NumberBox.h"
+#include "view/textfields/PasswordBox.h"
+#include "view/textfields/TextEdit.h"
+#include "view/windowing/TitleBar.h"
+#include "view/windowing/Window.h"
+
+using namespace view::basicinput;
+using namespace view::collections;
+using namespace view::dialogs_flyouts;
+using namespace view::menus_toolbars;
+using namespace view::scrolling;
+using namespace view::status_info;
+using namespace view::textfields;
+using namespace view::windowing;
+
+namespace {
+
+struct PaintCase {
+    const char* name;
+    QSize size;                                   // 为空时使用 sizeHint()
+    std::function<QWidget*(QWidget* host)> create;
+};
+
+QStandardItemModel* makeListModel(QObject* parent, int rows) {
+    auto* model = new QStandardItemModel(parent);
+    for (int i = 0; i < rows; ++i)
+        model->appendRow(new QStandardItem(QStringLiteral("Item %1").arg(i)));
+    return model;
+}
+
+QStandardItemModel* makeTreeModel(QObject* parent, int groups, int children) {
+    auto* model = new QStandardItemModel(parent);
+    for (int g = 0; g < groups; ++g) {
+        auto* group = new QStandardItem(QStringLiteral("Group %1").arg(g));
+        for (int c = 0; c < children; ++c)
+            group->appendRow(new QStandardItem(QStringLiteral("Child %1.%2").arg(g).arg(c)));
+        model->appendRow(group);
+    }
+    return model;
+}
+
+template <typename T>
+QWidget* openPopup(T* popup) {
+    popup->setAnimationEnabled(false);
+    popup->open();
+    return popup;
+}
+
+const QVector<PaintCase>& paintCases() {
+    static const QVector<PaintCase> cases = {
+        // basicinput
+        { "basicinput/Button", {}, [](QWidget* h) { return new Button(QStringLiteral("Button"), h); } },
+        { "basicinput/CheckBox", {}, [](QWidget* h) { auto* w = new CheckBox(QStringLiteral("CheckBox"), h); w->setChecked(true); return w; } },
+        { "basicinput/ColorPicker", {}, [](QWidget* h) { return new ColorPicker(h); } },
+        { "basicinput/ComboBox", QSize(200, 32), [](QWidget* h) {
+              auto* w = new ComboBox(h);
+              w->addItems({ QStringLiteral("Blue"), QStringLiteral("Green"), QStringLiteral("Red") });
+              return w; } },
+        { "basicinput/DropDownButton", {}, [](QWidget* h) { return new DropDownButton(QStringLiteral("Email"), h); } },
+        { "basicinput/HyperlinkButton", {}, [](QWidget* h) { return new HyperlinkButton(QStringLiteral("Link"), h); } },
+        { "basicinput/RadioButton", {}, [](QWidget* h) { auto* w = new RadioButton(QStringLiteral("Option"), h); w->setChecked(true); return w; } },
+        { "basicinput/RatingControl", {}, [](QWidget* h) { return new RatingControl(h); } },
+        { "basicinput/RepeatButton", {}, [](QWidget* h) { return new RepeatButton(QStringLiteral("Repeat"), h); } },
+        { "basicinput/Slider", QSize(200, 32), [](QWidget* h) { auto* w = new Slider(Qt::Horizontal, h); w->setValue(40); return w; } },
+        { "basicinput/SplitButton", {}, [](QWidget* h) { return new SplitButton(QStringLiteral("Split"), h); } },
+        { "basicinput/ToggleButton", {}, [](QWidget* h) { return new ToggleButton(QStringLiteral("Toggle"), h); } },
+        { "basicinput/ToggleSplitButton", {}, [](QWidget* h) { return new ToggleSplitButton(QStringLiteral("Toggle split"), h); } },
+        { "basicinput/ToggleSwitch", {}, [](QWidget* h) { auto* w = new ToggleSwitch(h); w->setIsOn(true); return w; } },
+
+        // collections
+        { "collections/FlipView", QSize(400, 260), [](QWidget* h) {
+              auto* w = new FlipView(h);
+              for (int i = 0; i < 3; ++i) w->addPage(new Label(QStringLiteral("Page %1").arg(i)));
+              return w; } },
+        { "collections/GridView", QSize(480, 360), [](QWidget* h) {
+              auto* w = new GridView(h);
+              w->setModel(makeListModel(w, 200));
+              return w; } },
+        { "collections/ListView", QSize(320, 400), [](QWidget* h) {
+              auto* w = new ListView(h);
+              w->setModel(makeListModel(w, 200));
+              return w; } },
+        { "collections/TreeView", QSize(320, 400), [](QWidget* h) {
+              auto* w = new TreeView(h);
+              w->setModel(makeTreeModel(w, 20, 10));
+              w->expandAll();
+              return w; } },
+
+        // dialogs_flyouts
+        { "dialogs_flyouts/ContentDialog", {}, [](QWidget* h) {
+              auto* w = new ContentDialog(h);
+              w->setTitle(QStringLiteral("Save your work?"));
+              w->setPrimaryButtonText(QStringLiteral("Save"));
+              w->setCloseButtonText(QStringLiteral("Cancel"));
+              return w; } },
+        { "dialogs_flyouts/Dialog", QSize(400, 240), [](QWidget* h) { return new Dialog(h); } },
+        { "dialogs_flyouts/Flyout", {}, [](QWidget* h) { return openPopup(new Flyout(h)); } },
+        { "dialogs_flyouts/Popup", {}, [](QWidget* h) { return openPopup(new Popup(h)); } },
+        { "dialogs_flyouts/TeachingTip", {}, [](QWidget* h) { return openPopup(new TeachingTip(h)); } },
+
+        // menus_toolbars
+        { "menus_toolbars/FluentMenu", {}, [](QWidget* h) {
+              auto* w = new FluentMenu(QStringLiteral("File"), h);
+              for (const char* text : { "New", "Open", "Save", "Save as", "Close" })
+                  w->addAction(QString::fromLatin1(text));
+              return w; } },
+        { "menus_toolbars/FluentMenuBar", QSize(400, 40), [](QWidget* h) {
+              auto* w = new FluentMenuBar(h);
+              for (const char* text : { "File", "Edit", "View", "Help" })
+                  w->addMenu(QString::fromLatin1(text));
+              return w; } },
+
+        // scrolling
+        { "scrolling/ScrollBar", QSize(12, 300), [](QWidget* h) {
+              auto* w = new ScrollBar(Qt::Vertical, h);
+              w->setRange(0, 1000);
+              w->setValue(300);
+              return w; } },
+
+        // status_info
+        { "status_info/ProgressRing", QSize(64, 64), [](QWidget* h) {
+              auto* w = new ProgressRing(h);
+              w->setIsIndeterminate(false);
+              w->setValue(60);
+              return w; } },
+        { "status_info/ToolTip", {}, [](QWidget* h) {
+              auto* w = new ToolTip(h);
+              w->setText(QStringLiteral("Tool tip text"));
+              return w; } },
+
+        // textfields
+        { "textfields/AutoSuggestBox", QSize(240, 32), [](QWidget* h) { return new AutoSuggestBox(h); } },
+        { "textfields/Label", {}, [](QWidget* h) { return new Label(QStringLiteral("The quick brown fox"), h); } },
+        { "textfields/LineEdit", QSize(240, 32), [](QWidget* h) {
+              auto* w = new LineEdit(h);
+              w->setText(QStringLiteral("Hello"));
+              return w; } },
+        { "textfields/NumberBox", QSize(160, 32), [](QWidget* h) { return new NumberBox(h); } },
+        { "textfields/PasswordBox", QSize(240, 32), [](QWidget* h) { return new PasswordBox(h); } },
+        { "textfields/TextEdit", QSize(320, 160), [](QWidget* h) {
+              auto* w = new TextEdit(h);
+              w->setPlainText(QStringLiteral("Lorem ipsum dolor sit amet,\nconsectetur adipiscing elit."));
+              return w; } },
+
+        // windowing
+        { "windowing/TitleBar", QSize(640, 32), [](QWidget* h) { return new TitleBar(h); } },
+        { "windowing/Window", QSize(640, 480), [](QWidget* h) { return new Window(h); } },
+    };
+    return cases;
+}
+
+void runPaintCase(const PaintCase& c, bench::State& state) {
+    QWidget host;
+    host.setAttribute(Qt::WA_DontShowOnScreen, true);
+    host.resize(800, 600);
+    host.show();
+
+    QWidget* widget = c.create(&host);
+    widget->resize(c.size.isEmpty() ? widget->sizeHint().expandedTo(QSize(1, 1)) : c.size);
+    if (!widget->isWindow()) widget->show();
+    QCoreApplication::processEvents();
+
+    const qreal dpr = host.devicePixelRatioF();
+    QImage image(widget->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+
+    while (state.keepRunning()) {
+        image.fill(Qt::transparent);
+        widget->render(&image, QPoint(), QRegion(), QWidget::DrawWindowBackground | QWidget::DrawChildren);
+    }
+    state.setCounter(QStringLiteral("width"), widget->width());
+    state.setCounter(QStringLiteral("height"), widget->height());
+
+    if (widget->isWindow()) delete widget;
+}
+
+// 按控件表批量注册：paint/<目录>/<控件>
+const bool registered = [] {
+    for (const PaintCase& c : paintCases()) {
+        bench::registerBenchmark(QStringLiteral("paint/") + QLatin1String(c.name),
+                                 [&c](bench::State& state) { runPaintCase(c, state); });
+    }
+    return true;
+}();
+
+} // namespace
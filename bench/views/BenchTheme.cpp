@@ -0,0 +1,105 @@
+// FluentElement::setTheme 的主题切换耗时：可见窗口内同步更新 / 隐藏窗口延迟更新；
+// 以及 themeColors() 读取缓存色表的单次开销
+#include "BenchHarness.h"
+
+#include <QVBoxLayout>
+#include <QWidget>
+
+#include "view/FluentElement.h"
+#include "view/basicinput/Button.h"
+#include "view/basicinput/CheckBox.h"
+#include "view/basicinput/ToggleSwitch.h"
+#include "view/textfields/LineEdit.h"
+
+using namespace view::basicinput;
+using namespace view::textfields;
+
+namespace {
+
+enum class Mix { Buttons, Controls };
+
+void populate(QWidget* window, int count, Mix mix) {
+    auto* layout = new QVBoxLayout(window);
+    for (int i = 0; i < count; ++i) {
+        QWidget* w = nullptr;
+        switch (mix == Mix::Buttons ? 0 : i % 4) {
+            case 0: w = new Button(QStringLiteral("Button %1").arg(i), window); break;
+            case 1: w = new CheckBox(QStringLiteral("Check %1").arg(i), window); break;
+            case 2: w = new ToggleSwitch(window); break;
+            default: w = new LineEdit(window); break;
+        }
+        layout->addWidget(w);
+    }
+}
+
+/** 窗口可见：setTheme 内同步回调全部元素 */
+void runVisible(bench::State& state, int count, Mix mix) {
+    FluentElement::setTheme(FluentElement::Light);
+    QWidget window;
+    window.setAttribute(Qt::WA_DontShowOnScreen, true);
+    populate(&window, count, mix);
+    window.show();
+    QCoreApplication::processEvents();
+
+    FluentElement::Theme theme = FluentElement::Light;
+    while (state.keepRunning()) {
+        theme = theme == FluentElement::Light ? FluentElement::Dark : FluentElement::Light;
+        FluentElement::setTheme(theme);
+    }
+    FluentElement::setTheme(FluentElement::Light);
+    state.setCounter(QStringLiteral("elements"), count);
+}
+
+/** 窗口隐藏：setTheme 只登记延迟，flushThemeUpdates 时才真正回调（不计入切换本身） */
+void runHidden(bench::State& state, int count, bool includeFlush) {
+    FluentElement::setTheme(FluentElement::Light);
+    QWidget window;
+    populate(&window, count, Mix::Buttons);
+
+    FluentElement::Theme theme = FluentElement::Light;
+    while (state.keepRunning()) {
+        theme = theme == FluentElement::Light ? FluentElement::Dark : FluentElement::Light;
+        FluentElement::setTheme(theme);
+        if (!includeFlush) state.pauseTiming();
+        FluentElement::flushThemeUpdates();
+    }
+    FluentElement::setTheme(FluentElement::Light);
+    FluentElement::flushThemeUpdates();
+    state.setCounter(QStringLiteral("elements"), count);
+}
+
+/** themeColors() 每轮调用 kCalls 次：返回同一张缓存表，不分配新结构 */
+FLUENT_BENCHMARK(ThemeColorsLookup) {
+    constexpr int kCalls = 100000;
+    FluentElement::setTheme(FluentElement::Light);
+    Button button(QStringLiteral("Button"));
+    const FluentElement::Colors* first = &button.themeColors();
+    int distinct = 0;
+    int alphaSum = 0;
+    while (state.keepRunning()) {
+        for (int i = 0; i < kCalls; ++i) {
+            const auto& c = button.themeColors();
+            if (&c != first) ++distinct;
+            alphaSum += c.textPrimary.alpha();
+        }
+    }
+    state.setCounter(QStringLiteral("callsPerIteration"), kCalls);
+    state.setCounter(QStringLiteral("distinctTables"), distinct);
+    state.setCounter(QStringLiteral("alphaSum"), alphaSum);
+}
+
+const bool registered = [] {
+    for (int count : { 100, 1000 }) {
+        bench::registerBenchmark(QStringLiteral("theme/visible/buttons/%1").arg(count),
+                                 [count](bench::State& s) { runVisible(s, count, Mix::Buttons); });
+        bench::registerBenchmark(QStringLiteral("theme/visible/mixed/%1").arg(count),
+                                 [count](bench::State& s) { runVisible(s, count, Mix::Controls); });
+        bench::registerBenchmark(QStringLiteral("theme/hidden/deferred/%1").arg(count),
+                                 [count](bench::State& s) { runHidden(s, count, false); });
+        bench::registerBenchmark(QStringLiteral("theme/hidden/flush/%1").arg(count),
+                                 [count](bench::State& s) { runHidden(s, count, true); });
+    }
+    return true;
+}();
+
+} // namespace
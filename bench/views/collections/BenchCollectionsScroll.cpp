@@ -0,0 +1,258 @@
+// 集合控件在大数据量下的滚动帧耗时：每次迭代推进滚动条并将 viewport 渲染到 QImage；
+// 另测虚拟化 ListView 百万行首帧 / 跳到末尾、GridView 大图库缩放、TreeView 扁平行索引与 QTreeView 逐行查找的几何查询耗时，
+// 以及大子树展开渐显时的绘制耗时
+#include "BenchHarness.h"
+
+#include <QAbstractListModel>
+#include <QImage>
+#include <QScrollBar>
+#include <QStandardItemModel>
+#include <QVector>
+#include <QWidget>
+
+#include "view/collections/GridView.h"
+#include "view/collections/ListView.h"
+#include "view/collections/TreeView.h"
+
+using namespace view::collections;
+
+namespace {
+
+/** 按需生成数据的只读模型，避免 QStandardItemModel 在 10 万行时的构造 / 内存开销干扰测量 */
+class GeneratedListModel : public QAbstractListModel {
+public:
+    GeneratedListModel(int rows, QObject* parent) : QAbstractListModel(parent), m_rows(rows) {}
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override {
+        return parent.isValid() ? 0 : m_rows;
+    }
+    QVariant data(const QModelIndex& index, int role) const override {
+        if (!index.isValid() || role != Qt::DisplayRole) return QVariant();
+        return QStringLiteral("Item %1").arg(index.row());
+    }
+
+private:
+    int m_rows;
+};
+
+QStandardItemModel* makeTreeModel(QObject* parent, int groups, int children) {
+    auto* model = new QStandardItemModel(parent);
+    for (int g = 0; g < groups; ++g) {
+        auto* group = new QStandardItem(QStringLiteral("Group %1").arg(g));
+        for (int c = 0; c < children; ++c)
+            group->appendRow(new QStandardItem(QStringLiteral("Child %1.%2").arg(g).arg(c)));
+        model->appendRow(group);
+    }
+    return model;
+}
+
+/**
+ * 通用滚动循环：每次迭代滚动一个固定步长（到底后回到顶部），
+ * 处理滚动引发的布局 / 事件后渲染 viewport。
+ */
+void scrollLoop(bench::State& state, QAbstractScrollArea* view, int step) {
+    QWidget* viewport = view->viewport();
+    QScrollBar* bar = view->verticalScrollBar();
+    const qreal dpr = view->devicePixelRatioF();
+    QImage image(viewport->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+
+    while (state.keepRunning()) {
+        const int next = bar->value() + step;
+        bar->setValue(next > bar->maximum() ? bar->minimum() : next);
+        image.fill(Qt::transparent);
+        viewport->render(&image);
+    }
+    state.setCounter(QStringLiteral("scroll_range"), bar->maximum() - bar->minimum());
+}
+
+template <typename View>
+void showView(QWidget* host, View* view, const QSize& size) {
+    host->setAttribute(Qt::WA_DontShowOnScreen, true);
+    view->setGeometry(QRect(QPoint(0, 0), size));
+    host->resize(size);
+    host->show();
+    QCoreApplication::processEvents();
+}
+
+void runListView(bench::State& state, int rows, bool virtualized) {
+    QWidget host;
+    auto* view = new ListView(&host);
+    view->setVirtualized(virtualized);
+    view->setModel(new GeneratedListModel(rows, view));
+    showView(&host, view, QSize(360, 600));
+
+    scrollLoop(state, view, 97);
+    state.setCounter(QStringLiteral("rows"), rows);
+}
+
+/**
+ * 虚拟化 ListView（带 section header）：firstPaint 每轮重新布局并渲染首帧，
+ * scrollToEnd 每轮从顶部（不计时）滚到最后一行并渲染。
+ */
+void runListViewJump(bench::State& state, int rows, bool scrollToEnd) {
+    QWidget host;
+    auto* view = new ListView(&host);
+    view->setVirtualized(true);
+    view->setModel(new GeneratedListModel(rows, view));
+    view->setSectionEnabled(true);
+    view->setSectionKeyFunction([](int row) { return QString::number(row / 100); });
+    showView(&host, view, QSize(300, 400));
+
+    QImage image(view->size(), QImage::Format_ARGB32_Premultiplied);
+    const QModelIndex last = view->model()->index(rows - 1, 0);
+    while (state.keepRunning()) {
+        if (scrollToEnd) {
+            state.pauseTiming();
+            view->verticalScrollBar()->setValue(0);
+            state.resumeTiming();
+            view->scrollTo(last);
+        } else {
+            view->doItemsLayout();
+        }
+        image.fill(Qt::transparent);
+        view->render(&image);
+    }
+    state.setCounter(QStringLiteral("rows"), rows);
+}
+
+void runGridView(bench::State& state, int items) {
+    QWidget host;
+    auto* view = new GridView(&host);
+    view->setModel(new GeneratedListModel(items, view));
+    showView(&host, view, QSize(640, 600));
+
+    scrollLoop(state, view, 97);
+    state.setCounter(QStringLiteral("items"), items);
+}
+
+/**
+ * 大图库缩放：每轮把宽度在 600 ~ 800 之间步进 20px（列数随之变化），
+ * 每次缩放后渲染一帧；固定 cell 布局下与数据量无关。
+ */
+void runGridResize(bench::State& state, int items) {
+    QWidget host;
+    auto* view = new GridView(&host);
+    view->setModel(new GeneratedListModel(items, view));
+    showView(&host, view, QSize(600, 500));
+
+    QImage image(QSize(800, 500), QImage::Format_ARGB32_Premultiplied);
+    while (state.keepRunning()) {
+        for (int w = 600; w <= 800; w += 20) {
+            view->resize(w, 500);
+            image.fill(Qt::transparent);
+            view->render(&image);
+        }
+    }
+    state.setCounter(QStringLiteral("items"), items);
+    state.setCounter(QStringLiteral("resizes"), 11);
+}
+
+void runTreeView(bench::State& state, int groups, int children) {
+    QWidget host;
+    auto* view = new TreeView(&host);
+    view->setModel(makeTreeModel(view, groups, children));
+    view->expandAll();
+    showView(&host, view, QSize(360, 600));
+
+    scrollLoop(state, view, 97);
+    state.setCounter(QStringLiteral("rows"), groups * (children + 1));
+}
+
+/**
+ * TreeView 几何查询：100 组 × 500 子项全部展开，每轮对 400 个分散的目标做
+ * visualRect / scrollTo；qtreeview 变体直接调用基类实现作为对照。
+ */
+void runTreeGeometry(bench::State& state, bool scroll, bool flat) {
+    QWidget host;
+    auto* view = new TreeView(&host);
+    auto* model = makeTreeModel(view, 100, 500);
+    view->setModel(model);
+    view->setUniformRowHeights(true);
+    view->expandAll();
+    showView(&host, view, QSize(300, 400));
+
+    QVector<QModelIndex> targets;
+    for (int i = 0; i < 400; ++i)
+        targets.append(model->index((i * 211) % 500, 0, model->index((i * 37) % 100, 0)));
+
+    int checksum = 0;
+    while (state.keepRunning()) {
+        for (const QModelIndex& t : targets) {
+            if (scroll) {
+                if (flat) view->scrollTo(t, QAbstractItemView::PositionAtCenter);
+                else view->QTreeView::scrollTo(t, QAbstractItemView::PositionAtCenter);
+            } else {
+                checksum += flat ? view->visualRect(t).y() : view->QTreeView::visualRect(t).y();
+            }
+        }
+    }
+    state.setCounter(QStringLiteral("queries"), targets.size());
+    state.setCounter(QStringLiteral("checksum"), checksum);
+}
+
+/**
+ * 展开含 children 个子项的节点后，在渐显动画进行中连续渲染 viewport 10 帧；
+ * 每轮先折叠再展开（不计时），保证每次测量都落在动画期间。
+ */
+void runTreeExpandReveal(bench::State& state, int children) {
+    QWidget host;
+    auto* view = new TreeView(&host);
+    auto* model = makeTreeModel(view, 1, children);
+    view->setModel(model);
+    showView(&host, view, QSize(300, 400));
+
+    QWidget* viewport = view->viewport();
+    const qreal dpr = view->devicePixelRatioF();
+    QImage image(viewport->size() * dpr, QImage::Format_ARGB32_Premultiplied);
+    image.setDevicePixelRatio(dpr);
+    const QModelIndex group = model->index(0, 0);
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        view->collapse(group);
+        view->expand(group);
+        state.resumeTiming();
+        for (int frame = 0; frame < 10; ++frame) {
+            image.fill(Qt::transparent);
+            viewport->render(&image);
+        }
+    }
+    state.setCounter(QStringLiteral("children"), children);
+    state.setCounter(QStringLiteral("frames"), 10);
+}
+
+const bool registered = [] {
+    for (int rows : { 1000, 100000 }) {
+        bench::registerBenchmark(QStringLiteral("scroll/ListView/%1").arg(rows),
+                                 [rows](bench::State& s) { runListView(s, rows, false); });
+        bench::registerBenchmark(QStringLiteral("scroll/ListView/virtualized/%1").arg(rows),
+                                 [rows](bench::State& s) { runListView(s, rows, true); });
+        bench::registerBenchmark(QStringLiteral("scroll/GridView/%1").arg(rows),
+                                 [rows](bench::State& s) { runGridView(s, rows); });
+    }
+    bench::registerBenchmark(QStringLiteral("scroll/ListView/virtualized/1000000/firstPaint"),
+                             [](bench::State& s) { runListViewJump(s, 1000000, false); });
+    bench::registerBenchmark(QStringLiteral("scroll/ListView/virtualized/1000000/scrollToEnd"),
+                             [](bench::State& s) { runListViewJump(s, 1000000, true); });
+    bench::registerBenchmark(QStringLiteral("resize/GridView/200000"),
+                             [](bench::State& s) { runGridResize(s, 200000); });
+    bench::registerBenchmark(QStringLiteral("scroll/TreeView/100x10"),
+                             [](bench::State& s) { runTreeView(s, 100, 10); });
+    bench::registerBenchmark(QStringLiteral("scroll/TreeView/2000x20"),
+                             [](bench::State& s) { runTreeView(s, 2000, 20); });
+    for (int children : { 100, 10000 }) {
+        bench::registerBenchmark(QStringLiteral("paint/TreeView/expandReveal/%1").arg(children),
+                                 [children](bench::State& s) { runTreeExpandReveal(s, children); });
+    }
+    for (bool scroll : { false, true }) {
+        const QString query = scroll ? QStringLiteral("scrollTo") : QStringLiteral("visualRect");
+        bench::registerBenchmark(QStringLiteral("geometry/TreeView/%1/flat").arg(query),
+                                 [scroll](bench::State& s) { runTreeGeometry(s, scroll, true); });
+        bench::registerBenchmark(QStringLiteral("geometry/TreeView/%1/qtreeview").arg(query),
+                                 [scroll](bench::State& s) { runTreeGeometry(s, scroll, false); });
+    }
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,105 @@
+// Popup / Flyout 打开-关闭一个来回的耗时（定位、遮罩、重挂父控件、首帧绘制）
+#include "BenchHarness.h"
+
+#include <QElapsedTimer>
+#include <QImage>
+#include <QVBoxLayout>
+#include <QWidget>
+
+#include "view/basicinput/Button.h"
+#include "view/dialogs_flyouts/Flyout.h"
+#include "view/dialogs_flyouts/Popup.h"
+
+using namespace view::basicinput;
+using namespace view::dialogs_flyouts;
+
+namespace {
+
+struct Host {
+    QWidget window;
+    Button* anchor = nullptr;
+
+    Host() {
+        window.setAttribute(Qt::WA_DontShowOnScreen, true);
+        window.resize(800, 600);
+        auto* layout = new QVBoxLayout(&window);
+        anchor = new Button(QStringLiteral("Anchor"), &window);
+        layout->addWidget(anchor, 0, Qt::AlignCenter);
+        window.show();
+        QCoreApplication::processEvents();
+    }
+};
+
+/** 关闭动画：open / close 同步完成，含一次离屏渲染以计入首帧绘制 */
+template <typename P, typename Open>
+void runInstant(bench::State& state, P* popup, Open openFn) {
+    popup->setAnimationEnabled(false);
+    QImage image;
+    while (state.keepRunning()) {
+        openFn();
+        if (image.size() != popup->size())
+            image = QImage(popup->size(), QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+        popup->render(&image);
+        popup->close();
+    }
+}
+
+/** 开启动画：完整进入 + 退出动画的墙钟时间（主要反映动画时长与帧调度） */
+template <typename P, typename Open>
+void runAnimated(bench::State& state, P* popup, Open openFn) {
+    popup->setAnimationEnabled(true);
+    int frames = 0;
+    int opened = 0;
+    int closed = 0;
+    QObject::connect(popup, &Popup::popupProgressChanged, popup, [&frames]() { ++frames; });
+    QObject::connect(popup, &Popup::opened, popup, [&opened]() { ++opened; });
+    QObject::connect(popup, &Popup::closed, popup, [&closed]() { ++closed; });
+    auto waitFor = [](const int& counter, int target) {
+        QElapsedTimer guard;
+        guard.start();
+        while (counter < target && guard.elapsed() < 2000)
+            QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+    };
+    while (state.keepRunning()) {
+        const int openTarget = opened + 1;
+        openFn();
+        waitFor(opened, openTarget);
+        const int closeTarget = closed + 1;
+        popup->close();
+        waitFor(closed, closeTarget);
+    }
+    state.setCounter(QStringLiteral("progress_updates"), frames);
+}
+
+FLUENT_BENCHMARK(PopupOpenClose) {
+    Host host;
+    auto* popup = new Popup(&host.window);
+    popup->resize(320, 200);
+    runInstant(state, popup, [popup]() { popup->open(); });
+}
+
+FLUENT_BENCHMARK(PopupOpenCloseDim) {
+    Host host;
+    auto* popup = new Popup(&host.window);
+    popup->resize(320, 200);
+    popup->setModal(true);
+    popup->setDim(true);
+    runInstant(state, popup, [popup]() { popup->open(); });
+}
+
+FLUENT_BENCHMARK(FlyoutShowAtClose) {
+    Host host;
+    auto* flyout = new Flyout(&host.window);
+    flyout->resize(240, 160);
+    runInstant(state, flyout, [flyout, &host]() { flyout->showAt(host.anchor); });
+}
+
+FLUENT_BENCHMARK(PopupAnimatedCycle) {
+    Host host;
+    auto* popup = new Popup(&host.window);
+    popup->resize(320, 200);
+    runAnimated(state, popup, [popup]() { popup->open(); });
+}
+
+} // namespace
@@ -79,3 +79,12 @@ using FluentColorComponent = qreal;
 #define FLUENT_MAKE_ENTER_EVENT(name, x, y) \
     QEvent name(QEvent::Enter)
 #endif
+
+// ── qHash overload signature ────────────────────────────────────────────────
+// Qt6: size_t qHash(const T&, size_t seed)
+// Qt5: uint qHash(const T&, uint seed)
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+using FluentHashValue = size_t;
+#else
+using FluentHashValue = uint;
+#endif
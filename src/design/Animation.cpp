@@ -0,0 +1,199 @@
+#include "Animation.h"
+
+#include <QAbstractAnimation>
+#include <QCoreApplication>
+#include <QWidget>
+#include <algorithm>
+
+namespace Animation {
+
+/** 调度器唯一的时钟：挂在 Qt 统一动画定时器上，持续时间无限 */
+class Scheduler::Clock : public QAbstractAnimation {
+public:
+    explicit Clock(Scheduler* owner) : m_owner(owner) {}
+    int duration() const override { return -1; }
+
+protected:
+    void updateCurrentTime(int currentTime) override { m_owner->tick(currentTime); }
+
+private:
+    Scheduler* m_owner;
+};
+
+Scheduler& Scheduler::instance() {
+    // 挂在 qApp 下，随应用对象一起析构（静态 QObject 会晚于 QUnifiedTimer 销毁）
+    static QPointer<Scheduler> s;
+    if (!s) s = new Scheduler(QCoreApplication::instance());
+    return *s;
+}
+
+Scheduler::Scheduler(QObject* parent)
+    : QObject(parent)
+    , m_clock(new Clock(this)) {
+    for (int i = 0; i <= int(EasingType::Exit); ++i)
+        m_curves[i] = getEasing(EasingType(i));
+}
+
+Scheduler::~Scheduler() {
+    m_clock->stop();
+}
+
+int Scheduler::currentTime() const {
+    return m_clock->state() == QAbstractAnimation::Running ? m_clock->currentTime() : 0;
+}
+
+void Scheduler::animate(QObject* owner, quintptr key, qreal from, qreal to, int durationMs,
+                        EasingType easing, Apply apply, QWidget* repaintTarget, Finished finished) {
+    if (!owner || !apply) return;
+    cancel(owner, key);
+
+    if (durationMs <= 0) {
+        apply(to);
+        if (repaintTarget) repaintTarget->update();
+        if (finished) finished();
+        return;
+    }
+
+    int id;
+    if (!m_free.isEmpty()) {
+        id = m_free.takeLast();
+    } else {
+        id = int(m_pool.size());
+        m_pool.push_back(std::make_unique<Tween>());
+    }
+
+    Tween& t = *m_pool[id];
+    t.owner = owner;
+    t.target = repaintTarget;
+    t.key = key;
+    t.from = from;
+    t.to = to;
+    t.startTime = currentTime();
+    t.duration = durationMs;
+    t.easing = easing;
+    t.done = false;
+    t.cancelled = false;
+    t.apply = std::move(apply);
+    t.finished = std::move(finished);
+    t.activePos = m_active.size();
+    m_active.append(id);
+    m_index.insert(Key(owner, key), id);
+
+    // 从停止状态启动会同步推进到 t=0，补间立即应用起点值
+    if (m_clock->state() != QAbstractAnimation::Running) m_clock->start();
+}
+
+void Scheduler::cancel(QObject* owner, quintptr key) {
+    const auto it = m_index.constFind(Key(owner, key));
+    if (it == m_index.constEnd()) return;
+    const int id = it.value();
+    if (m_ticking) {
+        // 帧内取消：先标记，帧末统一回收，避免打乱正在遍历的 m_active
+        Tween& t = *m_pool[id];
+        if (!t.done) m_done.append(id);
+        t.done = t.cancelled = true;
+        m_index.remove(Key(owner, key));
+        return;
+    }
+    release(id);
+}
+
+void Scheduler::cancelAll(QObject* owner) {
+    for (int n = m_active.size() - 1; n >= 0; --n) {
+        if (n >= m_active.size()) continue;
+        const Tween& t = *m_pool[m_active.at(n)];
+        if (t.owner == owner && !t.cancelled) cancel(owner, t.key);
+    }
+}
+
+bool Scheduler::isRunning(const QObject* owner, quintptr key) const {
+    return m_index.contains(Key(const_cast<QObject*>(owner), key));
+}
+
+void Scheduler::release(int id) {
+    Tween& t = *m_pool[id];
+    if (t.activePos < 0) return;
+
+    if (t.owner) {
+        const auto it = m_index.find(Key(t.owner.data(), t.key));
+        if (it != m_index.end() && it.value() == id) m_index.erase(it);
+    } else {
+        // owner 已销毁，键里的指针无从得知：按值查找（仅在销毁路径上发生）
+        for (auto it = m_index.begin(); it != m_index.end(); ++it) {
+            if (it.value() == id) { m_index.erase(it); break; }
+        }
+    }
+
+    const int last = m_active.takeLast();
+    if (last != id) {
+        m_active[t.activePos] = last;
+        m_pool[last]->activePos = t.activePos;
+    }
+    t.activePos = -1;
+    t.owner.clear();
+    t.target.clear();
+    t.apply = nullptr;      // 释放捕获的状态；Tween 本身留在池中复用
+    t.finished = nullptr;
+    m_free.append(id);
+}
+
+void Scheduler::tick(int now) {
+    m_ticking = true;
+
+    for (int n = 0; n < m_active.size(); ++n) {
+        const int id = m_active.at(n);
+        Tween& t = *m_pool[id];
+        if (t.done) continue;
+        if (!t.owner) {
+            // owner 已销毁：静默回收，不再回调
+            t.done = t.cancelled = true;
+            m_done.append(id);
+            continue;
+        }
+
+        const qreal progress = qBound(0.0, qreal(now - t.startTime) / t.duration, 1.0);
+        const qreal eased = m_curves[int(t.easing)].valueForProgress(progress);
+        t.apply(progress >= 1.0 ? t.to : t.from + (t.to - t.from) * eased);
+
+        // apply 期间新增补间只会扩容 m_pool，Tween 本身地址不变，t 仍然有效
+        if (QWidget* w = t.target.data()) m_dirty.append(w);
+        if (progress >= 1.0 && !t.done) {
+            t.done = true;
+            m_done.append(id);
+        }
+    }
+
+    for (int id : m_done) {
+        Tween& t = *m_pool[id];
+        if (!t.cancelled && t.finished) m_finishedQueue.append(std::move(t.finished));
+        release(id);
+    }
+    m_done.clear();
+    m_ticking = false;
+
+    // 重绘按顶层窗口分组并去重：同一控件（如 TreeView 的视口上多个箭头）每帧只 update 一次
+    if (!m_dirty.isEmpty()) {
+        std::sort(m_dirty.begin(), m_dirty.end(), [](QWidget* a, QWidget* b) {
+            QWidget* wa = a->window();
+            QWidget* wb = b->window();
+            return wa != wb ? wa < wb : a < b;
+        });
+        m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
+        for (QWidget* w : m_dirty) {
+            if (w->isVisible()) w->update();
+        }
+        m_dirty.clear();
+    }
+
+    if (!m_finishedQueue.isEmpty()) {
+        // 先交换出来：回调里可能启动新补间，甚至再次进入 tick
+        QVector<Finished> queue;
+        queue.swap(m_finishedQueue);
+        for (const Finished& f : queue) f();
+    }
+
+    emit frameTicked(m_active.size());
+    if (m_active.isEmpty()) m_clock->stop();
+}
+
+} // namespace Animation
@@ -2,6 +2,15 @@
 #define ANIMATION_H
 
 #include <QEasingCurve>
+#include <QObject>
+#include <QPointer>
+#include <QHash>
+#include <QVector>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class QWidget;
 
 /** Animation - Fluent Design Motion 规范（持续时间 + 缓动曲线）。 */
 namespace Animation {
@@ -41,6 +50,100 @@ namespace Animation {
             default:               return QEasingCurve::Linear;
         }
     }
+
+    // -------------------------------------------------------------------------
+    // 全局补间调度器
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Scheduler - 所有控件共享的单一动画时钟
+     *
+     * 补间以 (owner, key) 标识，同一标识再次 animate 时从新起点重新开始（相当于
+     * stop + start）。全部活动补间由一个挂在 Qt 统一动画定时器上的时钟推进
+     * （平台提供 vsync 驱动的 QAnimationDriver 时与刷新同步），每帧：
+     *   1. 依次计算各补间的值并调用 apply（apply 只写数值，不调用 update）；
+     *   2. 收集各补间的重绘目标，去重后按顶层窗口分组，每个控件只 update() 一次；
+     *   3. 最后统一执行已结束补间的 finished 回调（可在其中启动新的补间）。
+     *
+     * 补间对象放在对象池中复用，悬停等高频启停不产生分配；owner 销毁后其补间
+     * 在下一帧自动回收，不再回调。
+     */
+    class Scheduler : public QObject {
+        Q_OBJECT
+
+    public:
+        using Apply    = std::function<void(qreal)>;
+        using Finished = std::function<void()>;
+
+        static Scheduler& instance();
+        ~Scheduler() override;
+
+        /**
+         * @brief 启动（或重新启动）owner 的 key 号补间
+         * @param apply          每帧回调插值结果
+         * @param repaintTarget  每帧需要重绘的控件（可为空，如只驱动数值）
+         * @param finished       自然结束时回调；被 cancel 或重新启动时不回调
+         *
+         * durationMs <= 0 时立即应用终值并结束。
+         */
+        void animate(QObject* owner, quintptr key, qreal from, qreal to, int durationMs,
+                     EasingType easing, Apply apply, QWidget* repaintTarget = nullptr,
+                     Finished finished = {});
+
+        /** 取消补间，数值停留在当前帧 */
+        void cancel(QObject* owner, quintptr key);
+        /** 取消 owner 的全部补间 */
+        void cancelAll(QObject* owner);
+
+        bool isRunning(const QObject* owner, quintptr key) const;
+        int  activeCount() const { return int(m_active.size()); }
+        /** 对象池容量（历史最大并发补间数） */
+        int  poolSize() const { return int(m_pool.size()); }
+
+    signals:
+        /** 每帧推进结束后发出（重绘已提交） */
+        void frameTicked(int activeTweens);
+
+    private:
+        explicit Scheduler(QObject* parent);
+
+        struct Tween {
+            QPointer<QObject> owner;
+            QPointer<QWidget> target;
+            quintptr   key = 0;
+            qreal      from = 0.0;
+            qreal      to = 0.0;
+            int        startTime = 0;
+            int        duration = 0;
+            EasingType easing = EasingType::Standard;
+            int        activePos = -1;   // 在 m_active 中的位置；-1 表示空闲
+            bool       done = false;     // 本帧已结束或被取消，等待帧末回收
+            bool       cancelled = false;
+            Apply      apply;
+            Finished   finished;
+        };
+        using Key = QPair<QObject*, quintptr>;
+
+        class Clock;
+        friend class Clock;
+
+        void tick(int now);
+        void release(int id);
+        int  currentTime() const;
+
+        std::unique_ptr<Clock> m_clock;
+        std::vector<std::unique_ptr<Tween>> m_pool;  // 地址稳定：回调期间新增补间不会使其失效
+        QVector<int>   m_free;
+        QVector<int>   m_active;
+        QHash<Key, int> m_index;
+        QEasingCurve   m_curves[int(EasingType::Exit) + 1];
+
+        // 每帧复用的临时缓冲
+        QVector<QWidget*> m_dirty;
+        QVector<int>      m_done;
+        QVector<Finished> m_finishedQueue;
+        bool m_ticking = false;
+    };
 }
 
 #endif // ANIMATION_H
@@ -1,25 +1,65 @@
 #include "DebugOverlay.h"
+#include "PaintProfiler.h"
 #include <QPainter>
 #include <QEvent>
 #include <QPen>
 
+namespace {
+constexpr int kHudRefreshMs = 250;      // HUD 刷新间隔
+constexpr int kHudFlashMs = 400;        // 重绘区域高亮保留时长
+constexpr int kHudTopWidgets = 8;       // 面板列出的控件数
+} // namespace
+
 DebugOverlay::DebugOverlay(QWidget *target, const QColor &color, QWidget *parent)
-    : QWidget(parent ? parent : (target ? target->parentWidget() : nullptr))
+    : DebugOverlay(target, color, parent, Mode::Border)
+{
+}
+
+DebugOverlay::DebugOverlay(QWidget *target, const QColor &color, QWidget *parent, Mode mode)
+    : QWidget(mode == Mode::Hud ? nullptr : (parent ? parent : (target ? target->parentWidget() : nullptr)))
     , m_target(target)
     , m_color(color)
+    , m_mode(mode)
 {
     if (!m_target) return;
 
     // 设置属性：不接受鼠标事件（穿透）、不抢占焦点
     setAttribute(Qt::WA_TransparentForMouseEvents);
     setAttribute(Qt::WA_NoSystemBackground);
-    
+
+    if (m_mode == Mode::Hud) {
+        // 独立的透明置顶窗口：HUD 刷新不会让目标窗口重绘，避免污染采样。
+        // 顶层窗口上 WA_TransparentForMouseEvents 不会让输入穿透，需由窗口系统放行
+        setWindowFlags(Qt::Tool | Qt::FramelessWindowHint | Qt::WindowStaysOnTopHint
+                       | Qt::WindowDoesNotAcceptFocus | Qt::WindowTransparentForInput);
+        setAttribute(Qt::WA_TranslucentBackground);
+        setAttribute(Qt::WA_ShowWithoutActivating);
+        setAttribute(Qt::WA_DeleteOnClose);
+        connect(m_target, &QObject::destroyed, this, &QObject::deleteLater);
+
+        m_profiler = new PaintProfiler(this);
+        m_profiler->setExcluded(this);
+        m_profiler->attach(m_target);
+
+        m_refreshTimer.setInterval(kHudRefreshMs);
+        connect(&m_refreshTimer, &QTimer::timeout, this, [this]() { update(); });
+        m_refreshTimer.start();
+
+        // 目标所在窗口移动时 HUD 也要跟随
+        if (m_target->window() != m_target) m_target->window()->installEventFilter(this);
+    }
+
     // 安装事件过滤器，监听目标控件的移动和缩放
     m_target->installEventFilter(this);
-    
+
     // 初始对齐
     updateGeometryToTarget();
-    show();
+    if (m_mode == Mode::Border || m_target->isVisible()) show();
+}
+
+DebugOverlay* DebugOverlay::attachHud(QWidget *root) {
+    if (!root) return nullptr;
+    return new DebugOverlay(root, QColor(0, 120, 215), nullptr, Mode::Hud);
 }
 
 bool DebugOverlay::eventFilter(QObject *obj, QEvent *event) {
@@ -32,12 +72,20 @@ bool DebugOverlay::eventFilter(QObject *obj, QEvent *event) {
             show();
             updateGeometryToTarget();
         }
+    } else if (m_target && obj == m_target->window() && event->type() == QEvent::Move) {
+        updateGeometryToTarget();
     }
     return QWidget::eventFilter(obj, event);
 }
 
 void DebugOverlay::updateGeometryToTarget() {
     if (m_target) {
+        if (m_mode == Mode::Hud) {
+            // 顶层窗口：按目标的全局坐标覆盖
+            setGeometry(QRect(m_target->mapToGlobal(QPoint(0, 0)), m_target->size()));
+            raise();
+            return;
+        }
         // 将高亮框的大小和位置设置得与目标一致
         // 注意：这里假设 overlay 和 target 在同一个父控件下
         setGeometry(m_target->geometry());
@@ -58,4 +106,51 @@ void DebugOverlay::paintEvent(QPaintEvent *) {
     painter.setPen(pen);
     
     painter.drawRect(QRectF(0, 0, width() - m_thickness, height() - m_thickness));
-}
\ No newline at end of file
+
+    if (m_mode == Mode::Hud) paintHud(painter);
+}
+
+void DebugOverlay::paintHud(QPainter &painter) {
+    if (!m_profiler) return;
+
+    // 1. 最近的重绘区域（root 坐标即 HUD 坐标）
+    QColor fill = m_color;
+    fill.setAlpha(40);
+    painter.setPen(QPen(m_color, 1));
+    painter.setBrush(fill);
+    for (const QRect &r : m_profiler->recentRepaints(kHudFlashMs))
+        painter.drawRect(r.adjusted(0, 0, -1, -1));
+
+    // 2. 统计面板
+    const auto ms = [](qint64 ns) { return QString::number(ns / 1e6, 'f', 2); };
+    QStringList lines;
+    lines << QStringLiteral("paint  %1/s  %2 ms/s")
+                 .arg(m_profiler->paintsPerSecond()).arg(ms(m_profiler->paintNsPerSecond()));
+    lines << QStringLiteral("anim   %1 ticks/s").arg(m_profiler->animationTicksPerSecond());
+    lines << QStringLiteral("theme  %1 ms (%2 elements)")
+                 .arg(ms(m_profiler->lastThemeUpdateNs())).arg(m_profiler->lastThemeUpdateCount());
+    for (const PaintProfiler::WidgetStats &s : m_profiler->topWidgets(kHudTopWidgets)) {
+        lines << QStringLiteral("%1  %2/s  %3 ms/s  max %4 ms")
+                     .arg(s.name).arg(s.paintsPerSecond).arg(ms(s.paintNsPerSecond)).arg(ms(s.maxPaintNs));
+    }
+
+    QFont font = painter.font();
+    font.setStyleHint(QFont::Monospace);
+    font.setFamily(QStringLiteral("Consolas"));
+    font.setPixelSize(11);
+    painter.setFont(font);
+    const QFontMetrics fm(font);
+    int textW = 0;
+    for (const QString &line : lines) textW = qMax(textW, fm.horizontalAdvance(line));
+    const QRect panel(4, 4, textW + 12, lines.size() * fm.height() + 8);
+
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(0, 0, 0, 170));
+    painter.drawRoundedRect(panel, 4, 4);
+    painter.setPen(Qt::white);
+    int y = panel.top() + 4 + fm.ascent();
+    for (const QString &line : lines) {
+        painter.drawText(panel.left() + 6, y, line);
+        y += fm.height();
+    }
+}
@@ -4,30 +4,52 @@
 #include <QWidget>
 #include <QPointer>
 #include <QColor>
+#include <QTimer>
+
+class PaintProfiler;
 
 /**
  * @brief DebugOverlay - 用于高亮显示指定控件边框的调试组件
+ *
+ * attachHud() 创建性能 HUD 模式：在目标子树上挂载 PaintProfiler，
+ * 以独立的透明置顶窗口覆盖目标，显示最近的重绘区域、上一秒各控件的
+ * paintEvent 次数与耗时、onThemeUpdated 耗时以及动画帧率。
+ * HUD 不属于目标窗口，其自身刷新不会引起被测控件重绘。
  */
 class DebugOverlay : public QWidget {
     Q_OBJECT
 public:
     // 指定要高亮的控件和颜色
     explicit DebugOverlay(QWidget *target, const QColor &color = Qt::red, QWidget *parent = nullptr);
-    
+
+    /** 在 root 子树上挂载性能 HUD；root 销毁时 HUD 随之销毁 */
+    static DebugOverlay* attachHud(QWidget *root);
+
     void setColor(const QColor &c) { m_color = c; update(); }
     void setThickness(int t) { m_thickness = t; update(); }
 
+    /** HUD 模式下的采样器（可用于导出 CSV / JSON trace）；边框模式为空 */
+    PaintProfiler* profiler() const { return m_profiler; }
+
 protected:
     // 核心逻辑：追踪目标控件的变化
     bool eventFilter(QObject *obj, QEvent *event) override;
     void paintEvent(QPaintEvent *event) override;
 
 private:
+    enum class Mode { Border, Hud };
+    DebugOverlay(QWidget *target, const QColor &color, QWidget *parent, Mode mode);
+
     void updateGeometryToTarget();
+    void paintHud(QPainter &painter);
 
     QPointer<QWidget> m_target; // 使用弱引用，防止目标销毁后崩溃
     QColor m_color;
     int m_thickness = 1;
+
+    Mode m_mode = Mode::Border;
+    PaintProfiler* m_profiler = nullptr;
+    QTimer m_refreshTimer;
 };
 
-#endif // DEBUGOVERLAY_H
\ No newline at end of file
+#endif // DEBUGOVERLAY_H
@@ -0,0 +1,324 @@
+#include "PaintProfiler.h"
+
+#include <QChildEvent>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPaintEvent>
+#include <QTextStream>
+#include <algorithm>
+
+#include "design/Animation.h"
+#include "view/FluentElement.h"
+
+namespace {
+
+// 同一次主题切换内的 onThemeUpdated 回调彼此相隔很近；间隔超过该值视为新一轮切换
+constexpr qint64 kThemeBurstGapUs = 100 * 1000;
+
+QString widgetName(const QObject* object) {
+    QString name = QString::fromLatin1(object->metaObject()->className());
+    if (!object->objectName().isEmpty()) name += QLatin1Char('#') + object->objectName();
+    return name;
+}
+
+const char* kindName(PaintProfiler::SampleKind kind) {
+    switch (kind) {
+        case PaintProfiler::SampleKind::Paint:         return "paint";
+        case PaintProfiler::SampleKind::ThemeUpdate:   return "theme";
+        case PaintProfiler::SampleKind::AnimationTick: return "tick";
+    }
+    return "";
+}
+
+// CSV 字段：含逗号或引号时整体加引号
+QString csvField(const QString& text) {
+    if (!text.contains(QLatin1Char(',')) && !text.contains(QLatin1Char('"'))) return text;
+    QString quoted = text;
+    quoted.replace(QLatin1String("\""), QLatin1String("\"\""));
+    return QLatin1Char('"') + quoted + QLatin1Char('"');
+}
+
+} // namespace
+
+PaintProfiler::PaintProfiler(QObject* parent) : QObject(parent) {
+    m_rollTimer.setInterval(1000);
+    connect(&m_rollTimer, &QTimer::timeout, this, &PaintProfiler::roll);
+}
+
+PaintProfiler::~PaintProfiler() {
+    detach();
+}
+
+void PaintProfiler::attach(QWidget* root) {
+    detach();
+    if (!root) return;
+
+    m_root = root;
+    reset();
+    watch(root);
+
+    FluentElement::setThemeUpdateHook([this](FluentElement* element, qint64 nsecs) {
+        auto* widget = dynamic_cast<QWidget*>(element);
+        if (!widget || !isProfiled(widget)) return;
+
+        const qint64 now = nowUs();
+        if (m_lastThemeUs < 0 || now - m_lastThemeUs > kThemeBurstGapUs) {
+            m_lastThemeNs = 0;
+            m_lastThemeCount = 0;
+        }
+        m_lastThemeUs = now;
+        m_lastThemeNs += nsecs;
+        ++m_lastThemeCount;
+
+        WidgetStats& s = statsFor(widget);
+        ++s.themeUpdates;
+        s.themeNs += nsecs;
+        record({ SampleKind::ThemeUpdate, now - nsecs / 1000, nsecs / 1000, s.name, QRect(), 0 });
+    });
+
+    m_tickConnection = connect(&::Animation::Scheduler::instance(), &::Animation::Scheduler::frameTicked,
+                               this, [this](int activeTweens) {
+        ++m_thisSecond.ticks;
+        record({ SampleKind::AnimationTick, nowUs(), 0, QString(), QRect(), activeTweens });
+    });
+
+    m_rollTimer.start();
+}
+
+void PaintProfiler::detach() {
+    if (!m_root && !m_rollTimer.isActive()) return;
+
+    closeFinishedPaints(true);
+    m_rollTimer.stop();
+    disconnect(m_tickConnection);
+    FluentElement::setThemeUpdateHook({});
+
+    if (m_root) {
+        m_root->removeEventFilter(this);
+        const auto children = m_root->findChildren<QWidget*>();
+        for (QWidget* w : children) w->removeEventFilter(this);
+    }
+    m_root = nullptr;
+}
+
+void PaintProfiler::setMaxSamples(int count) {
+    m_maxSamples = qMax(1, count);
+    const QVector<Sample> ordered = samples();
+    m_samples = ordered.mid(qMax(0, ordered.size() - m_maxSamples));
+    m_sampleHead = m_samples.size() % m_maxSamples;
+}
+
+void PaintProfiler::reset() {
+    m_stats.clear();
+    m_paintsThisSecond.clear();
+    m_paintNsThisSecond.clear();
+    m_thisSecond = {};
+    m_lastSecond = {};
+    m_lastThemeNs = 0;
+    m_lastThemeCount = 0;
+    m_lastThemeUs = -1;
+    m_samples.clear();
+    m_sampleHead = 0;
+    m_recent.clear();
+    m_recentHead = 0;
+    m_openPaints.clear();   // 时钟重启，未结算的开始时刻失效
+    m_clock.start();
+}
+
+void PaintProfiler::watch(QWidget* widget) {
+    if (widget == m_excluded) return;
+    widget->installEventFilter(this);
+    connect(widget, &QObject::destroyed, this, &PaintProfiler::forgetWidget, Qt::UniqueConnection);
+
+    const auto children = widget->findChildren<QWidget*>(QString(), Qt::FindDirectChildrenOnly);
+    for (QWidget* child : children) watch(child);
+}
+
+void PaintProfiler::forgetWidget(QObject* widget) {
+    // 析构中的对象只用作键，不解引用
+    m_stats.remove(widget);
+    m_paintsThisSecond.remove(widget);
+    m_paintNsThisSecond.remove(widget);
+}
+
+bool PaintProfiler::isProfiled(const QWidget* widget) const {
+    if (!m_root) return false;
+    if (m_excluded && (widget == m_excluded || m_excluded->isAncestorOf(widget))) return false;
+    return widget == m_root || m_root->isAncestorOf(widget);
+}
+
+PaintProfiler::WidgetStats& PaintProfiler::statsFor(const QWidget* widget) {
+    auto it = m_stats.find(widget);
+    if (it == m_stats.end()) {
+        it = m_stats.insert(widget, WidgetStats());
+        it->name = widgetName(widget);
+    }
+    return it.value();
+}
+
+bool PaintProfiler::eventFilter(QObject* watched, QEvent* event) {
+    if (event->type() == QEvent::ChildAdded) {
+        auto* child = static_cast<QChildEvent*>(event)->child();
+        if (child->isWidgetType()) watch(static_cast<QWidget*>(child));
+        return false;
+    }
+    if (event->type() != QEvent::Paint || !watched->isWidgetType())
+        return false;
+
+    auto* widget = static_cast<QWidget*>(watched);
+    if (!isProfiled(widget)) return false;
+
+    // 只打开计时：事件照常沿过滤器链派发，结束时刻由 closeFinishedPaints() 判定
+    closeFinishedPaints();
+    m_openPaints.append({ widget, static_cast<QPaintEvent*>(event)->rect(), m_clock.nsecsElapsed() });
+    if (!m_closeQueued) {
+        // 本轮重绘的最后一个控件没有后继 Paint：回到事件循环时结算
+        m_closeQueued = true;
+        QTimer::singleShot(0, this, [this]() {
+            m_closeQueued = false;
+            closeFinishedPaints();
+        });
+    }
+    return false;
+}
+
+void PaintProfiler::closeFinishedPaints(bool force) {
+    if (m_openPaints.isEmpty()) return;
+    const qint64 now = m_clock.nsecsElapsed();
+    // 栈顶仍在 paintEvent 内（外层控件正在 render() 其他控件）时，其下各层也未结束
+    int keep = m_openPaints.size();
+    while (keep > 0) {
+        const QWidget* widget = m_openPaints.at(keep - 1).widget;
+        if (!force && widget && widget->testAttribute(Qt::WA_WState_InPaintEvent)) break;
+        --keep;
+    }
+    // 按开始顺序记录，样本时间戳保持递增
+    for (int i = keep; i < m_openPaints.size(); ++i) {
+        const OpenPaint& open = m_openPaints.at(i);
+        if (open.widget) finishPaint(open.widget, open.rect, open.startNs, now);
+    }
+    m_openPaints.resize(keep);
+}
+
+void PaintProfiler::finishPaint(QWidget* widget, const QRect& rect, qint64 startNs, qint64 endNs) {
+    const qint64 nsecs = endNs - startNs;
+    const qint64 startUs = startNs / 1000;
+
+    WidgetStats& s = statsFor(widget);
+    ++s.paintCount;
+    s.paintNs += nsecs;
+    s.maxPaintNs = qMax(s.maxPaintNs, nsecs);
+    ++m_paintsThisSecond[widget];
+    m_paintNsThisSecond[widget] += nsecs;
+    ++m_thisSecond.paints;
+    m_thisSecond.paintNs += nsecs;
+
+    if (m_root) {
+        const RecentRect recent{ startUs / 1000, QRect(widget->mapTo(m_root, rect.topLeft()), rect.size()) };
+        if (m_recent.size() < kMaxRecentRects) m_recent.append(recent);
+        else m_recent[m_recentHead] = recent;
+        m_recentHead = (m_recentHead + 1) % kMaxRecentRects;
+    }
+    record({ SampleKind::Paint, startUs, nsecs / 1000, s.name, rect, 0 });
+}
+
+void PaintProfiler::record(Sample&& sample) {
+    if (m_samples.size() < m_maxSamples) m_samples.append(std::move(sample));
+    else m_samples[m_sampleHead] = std::move(sample);
+    m_sampleHead = (m_sampleHead + 1) % m_maxSamples;
+}
+
+void PaintProfiler::roll() {
+    closeFinishedPaints();
+    m_lastSecond = m_thisSecond;
+    m_thisSecond = {};
+    for (auto it = m_stats.begin(); it != m_stats.end(); ++it) {
+        it->paintsPerSecond = m_paintsThisSecond.value(it.key());
+        it->paintNsPerSecond = m_paintNsThisSecond.value(it.key());
+    }
+    m_paintsThisSecond.clear();
+    m_paintNsThisSecond.clear();
+    emit statsRolled();
+}
+
+QVector<PaintProfiler::WidgetStats> PaintProfiler::topWidgets(int count) const {
+    settle();
+    QVector<WidgetStats> result;
+    result.reserve(m_stats.size());
+    for (const WidgetStats& s : m_stats) {
+        if (s.paintsPerSecond > 0) result.append(s);
+    }
+    std::sort(result.begin(), result.end(), [](const WidgetStats& a, const WidgetStats& b) {
+        return a.paintNsPerSecond > b.paintNsPerSecond;
+    });
+    if (result.size() > count) result.resize(count);
+    return result;
+}
+
+QVector<QRect> PaintProfiler::recentRepaints(int withinMs) const {
+    settle();
+    const qint64 since = nowUs() / 1000 - withinMs;
+    QVector<QRect> rects;
+    for (const RecentRect& r : m_recent) {
+        if (r.timestampMs >= since) rects.append(r.rect);
+    }
+    return rects;
+}
+
+QVector<PaintProfiler::Sample> PaintProfiler::samples() const {
+    settle();
+    if (m_samples.size() < m_maxSamples) return m_samples;
+    QVector<Sample> ordered;
+    ordered.reserve(m_samples.size());
+    for (int i = 0; i < m_samples.size(); ++i)
+        ordered.append(m_samples.at((m_sampleHead + i) % m_samples.size()));
+    return ordered;
+}
+
+bool PaintProfiler::exportCsv(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) return false;
+
+    QTextStream out(&file);
+    out << "timestamp_us,kind,widget,duration_us,x,y,width,height,value\n";
+    for (const Sample& s : samples()) {
+        out << s.timestampUs << ',' << kindName(s.kind) << ',' << csvField(s.widget) << ','
+            << s.durationUs << ',' << s.rect.x() << ',' << s.rect.y() << ','
+            << s.rect.width() << ',' << s.rect.height() << ',' << s.value << '\n';
+    }
+    return out.status() == QTextStream::Ok;
+}
+
+bool PaintProfiler::exportJson(const QString& path) const {
+    // Chrome trace event 格式：绘制 / 主题为完整事件（ph = X），动画帧为计数器（ph = C）
+    QJsonArray events;
+    for (const Sample& s : samples()) {
+        QJsonObject e;
+        e.insert(QStringLiteral("cat"), QLatin1String(kindName(s.kind)));
+        e.insert(QStringLiteral("ts"), double(s.timestampUs));
+        e.insert(QStringLiteral("pid"), 0);
+        e.insert(QStringLiteral("tid"), 0);
+        if (s.kind == SampleKind::AnimationTick) {
+            e.insert(QStringLiteral("name"), QStringLiteral("activeTweens"));
+            e.insert(QStringLiteral("ph"), QStringLiteral("C"));
+            e.insert(QStringLiteral("args"), QJsonObject{ { QStringLiteral("tweens"), s.value } });
+        } else {
+            e.insert(QStringLiteral("name"), s.widget);
+            e.insert(QStringLiteral("ph"), QStringLiteral("X"));
+            e.insert(QStringLiteral("dur"), double(s.durationUs));
+            if (s.kind == SampleKind::Paint) {
+                e.insert(QStringLiteral("args"), QJsonObject{
+                    { QStringLiteral("rect"), QJsonArray{ s.rect.x(), s.rect.y(), s.rect.width(), s.rect.height() } } });
+            }
+        }
+        events.append(e);
+    }
+
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return false;
+    const QJsonObject root{ { QStringLiteral("traceEvents"), events },
+                            { QStringLiteral("displayTimeUnit"), QStringLiteral("ms") } };
+    return file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) >= 0;
+}
@@ -0,0 +1,156 @@
+#ifndef PAINTPROFILER_H
+#define PAINTPROFILER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QPointer>
+#include <QRect>
+#include <QString>
+#include <QTimer>
+#include <QVector>
+#include <QWidget>
+
+/**
+ * @brief PaintProfiler - 运行时挂载到任意控件子树的绘制 / 主题 / 动画开销采样器
+ *
+ * - paintEvent：对子树内每个控件（含之后新增的子控件）安装事件过滤器，Paint 到达时只记下
+ *   开始时间与重绘区域并放行，不重新投递，其余事件过滤器与 event() 各执行一次。
+ *   Qt 在派发 Paint 期间置 WA_WState_InPaintEvent；下一次 Paint 到达、统计查询或本轮重绘
+ *   结束（排队回调）时，已清除该标志的控件即完成绘制，以此时刻结束计时。
+ *   因此耗时含 Qt 在两次派发之间的少量工作，嵌套 render() 的耗时计入外层控件；
+ * - onThemeUpdated：通过 FluentElement::setThemeUpdateHook 计量子树内元素的耗时；
+ * - 动画：统计 Animation::Scheduler 每秒推进的帧数与活动补间数。
+ *
+ * 每秒滚动一次“上一秒”统计（次数 / 耗时），供 DebugOverlay 的 HUD 显示；
+ * 原始样本保存在定长环形缓冲中，可导出为 CSV 或 Chrome trace 格式的 JSON
+ * （chrome://tracing / Perfetto 可直接打开）。
+ *
+ * 注意：同一时刻只应有一个采样器挂载（主题钩子为全局单例）。
+ */
+class PaintProfiler : public QObject {
+    Q_OBJECT
+
+public:
+    enum class SampleKind { Paint, ThemeUpdate, AnimationTick };
+
+    struct Sample {
+        SampleKind kind;
+        qint64  timestampUs;   ///< 相对 attach 的开始时间
+        qint64  durationUs;
+        QString widget;        ///< 类名[#objectName]；AnimationTick 为空
+        QRect   rect;          ///< Paint：重绘区域外接矩形（控件坐标）
+        int     value = 0;     ///< AnimationTick：本帧活动补间数
+    };
+
+    struct WidgetStats {
+        QString name;
+        int     paintCount = 0;        ///< 累计
+        qint64  paintNs = 0;           ///< 累计
+        qint64  maxPaintNs = 0;
+        int     paintsPerSecond = 0;   ///< 上一秒
+        qint64  paintNsPerSecond = 0;  ///< 上一秒
+        int     themeUpdates = 0;
+        qint64  themeNs = 0;
+    };
+
+    explicit PaintProfiler(QObject* parent = nullptr);
+    ~PaintProfiler() override;
+
+    /** 挂载到 root 子树；重复调用会先卸载上一个子树 */
+    void attach(QWidget* root);
+    void detach();
+    QWidget* root() const { return m_root; }
+
+    /** 排除某个控件（如 HUD 自身）及其子控件 */
+    void setExcluded(QWidget* widget) { m_excluded = widget; }
+
+    void setMaxSamples(int count);
+    int  maxSamples() const { return m_maxSamples; }
+
+    /** 清空样本与统计，计时重新开始 */
+    void reset();
+
+    // --- 统计查询 ---
+    WidgetStats stats(const QWidget* widget) const { settle(); return m_stats.value(widget); }
+    /** 按上一秒绘制耗时降序的前 count 个控件 */
+    QVector<WidgetStats> topWidgets(int count) const;
+    int    paintsPerSecond() const { return m_lastSecond.paints; }
+    qint64 paintNsPerSecond() const { return m_lastSecond.paintNs; }
+    int    animationTicksPerSecond() const { return m_lastSecond.ticks; }
+    /** 最近一次主题切换中子树内 onThemeUpdated 的总耗时 / 元素数 */
+    qint64 lastThemeUpdateNs() const { return m_lastThemeNs; }
+    int    lastThemeUpdateCount() const { return m_lastThemeCount; }
+
+    /** withinMs 毫秒内的重绘区域（root 坐标），最多保留最近 kMaxRecentRects 个 */
+    QVector<QRect> recentRepaints(int withinMs) const;
+
+    /** 按时间顺序返回环形缓冲中的样本 */
+    QVector<Sample> samples() const;
+
+    // --- 导出 ---
+    bool exportCsv(const QString& path) const;
+    bool exportJson(const QString& path) const;
+
+signals:
+    /** 每秒滚动统计后发出，HUD 据此刷新 */
+    void statsRolled();
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    struct RecentRect {
+        qint64 timestampMs;
+        QRect  rect;
+    };
+    struct OpenPaint {
+        QPointer<QWidget> widget;
+        QRect  rect;
+        qint64 startNs;
+    };
+    struct Counters {
+        int    paints = 0;
+        qint64 paintNs = 0;
+        int    ticks = 0;
+    };
+    static constexpr int kMaxRecentRects = 256;
+
+    void watch(QWidget* widget);
+    void forgetWidget(QObject* widget);
+    bool isProfiled(const QWidget* widget) const;
+    WidgetStats& statsFor(const QWidget* widget);
+    void record(Sample&& sample);
+    /** 结束已离开 paintEvent 的计时；force 时全部结束（detach） */
+    void closeFinishedPaints(bool force = false);
+    void finishPaint(QWidget* widget, const QRect& rect, qint64 startNs, qint64 endNs);
+    /** 查询前结算已完成的绘制 */
+    void settle() const { const_cast<PaintProfiler*>(this)->closeFinishedPaints(); }
+    void roll();
+    qint64 nowUs() const { return m_clock.nsecsElapsed() / 1000; }
+
+    QPointer<QWidget> m_root;
+    QPointer<QWidget> m_excluded;
+    QElapsedTimer m_clock;
+    QTimer m_rollTimer;
+    QMetaObject::Connection m_tickConnection;
+    QVector<OpenPaint> m_openPaints;   // 已开始、尚未结算的绘制（嵌套 render() 时多于一项）
+    bool m_closeQueued = false;
+
+    QHash<const QObject*, WidgetStats> m_stats;
+    QHash<const QObject*, int> m_paintsThisSecond;
+    QHash<const QObject*, qint64> m_paintNsThisSecond;
+    Counters m_thisSecond;
+    Counters m_lastSecond;
+    qint64 m_lastThemeNs = 0;
+    int    m_lastThemeCount = 0;
+    qint64 m_lastThemeUs = -1;
+
+    QVector<Sample> m_samples;   // 环形缓冲
+    int m_sampleHead = 0;        // 下一个写入位置（缓冲已满时即最旧样本）
+    int m_maxSamples = 100000;
+    QVector<RecentRect> m_recent;
+    int m_recentHead = 0;
+};
+
+#endif // PAINTPROFILER_H
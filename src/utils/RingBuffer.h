@@ -0,0 +1,86 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+/**
+ * @brief RingBuffer - 有界无锁环形队列（多生产者 / 单消费者）
+ *
+ * 每个槽位带一个序号：生产者以 CAS 抢占写入位置，写完后发布序号；
+ * 消费者只有一个，按序号判断槽位是否就绪，无需 CAS。
+ * 队列满时 tryPush 返回 false，由调用方决定丢弃、重试或等待（背压）。
+ *
+ * 容量向上取整为 2 的幂。T 需可默认构造、可移动赋值。
+ */
+template <typename T>
+class RingBuffer {
+public:
+    explicit RingBuffer(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_mask = size - 1;
+        m_cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    std::size_t capacity() const { return m_mask + 1; }
+
+    /** 任意线程调用；队列满时返回 false，value 保持不变 */
+    bool tryPush(T& value) {
+        Cell* cell = nullptr;
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = std::ptrdiff_t(seq) - std::ptrdiff_t(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 仅消费者线程调用；队列空时返回 false */
+    bool tryPop(T& out) {
+        const std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        Cell& cell = m_cells[pos & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != pos + 1) return false;
+        m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+        out = std::move(cell.value);
+        cell.value = T();
+        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** 仅消费者线程调用：队首槽位是否已发布 */
+    bool isEmpty() const {
+        const std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{ 0 };
+        T value{};
+    };
+
+    // 生产者与消费者的位置分处不同缓存行，避免伪共享
+    alignas(64) std::atomic<std::size_t> m_enqueuePos{ 0 };
+    alignas(64) std::atomic<std::size_t> m_dequeuePos{ 0 };
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask = 0;
+};
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,233 @@
+#include "ShadowRenderer.h"
+#include <QImage>
+#include <QPaintDevice>
+#include <QPainterPathStroker>
+#include <QPixmapCache>
+#include <QHash>
+#include <QVector>
+#include <QtMath>
+#include <vector>
+
+namespace {
+
+// 三遍 box blur 逼近高斯模糊：按 sigma 求每遍的 box 宽度（奇数）
+QVector<int> boxesForGauss(qreal sigma, int passes) {
+    const qreal wIdeal = qSqrt(12.0 * sigma * sigma / passes + 1.0);
+    int wl = qFloor(wIdeal);
+    if (wl % 2 == 0) --wl;
+    const int wu = wl + 2;
+    const qreal mIdeal = (12.0 * sigma * sigma - passes * wl * wl - 4.0 * passes * wl - 3.0 * passes)
+                         / (-4.0 * wl - 4.0);
+    const int m = qRound(mIdeal);
+    QVector<int> sizes;
+    for (int i = 0; i < passes; ++i) sizes.append(i < m ? wl : wu);
+    return sizes;
+}
+
+// 单方向 box blur，图像外按 0（透明）处理；stride/step 决定行或列方向
+void boxBlur1D(const std::vector<int>& src, std::vector<int>& dst, int lines, int length,
+               int lineStride, int step, int r, std::vector<int>& acc) {
+    const int window = 2 * r + 1;
+    acc.resize(length + 1);
+    for (int line = 0; line < lines; ++line) {
+        const int base = line * lineStride;
+        acc[0] = 0;
+        for (int i = 0; i < length; ++i) acc[i + 1] = acc[i] + src[base + i * step];
+        for (int i = 0; i < length; ++i) {
+            const int lo = qMax(0, i - r);
+            const int hi = qMin(length, i + r + 1);
+            dst[base + i * step] = (acc[hi] - acc[lo] + window / 2) / window;
+        }
+    }
+}
+
+void gaussianBlur(std::vector<int>& alpha, int w, int h, qreal sigma) {
+    if (sigma <= 0.0 || w <= 0 || h <= 0) return;
+    std::vector<int> tmp(alpha.size());
+    std::vector<int> acc;
+    for (int size : boxesForGauss(sigma, 3)) {
+        const int r = (size - 1) / 2;
+        if (r <= 0) continue;
+        boxBlur1D(alpha, tmp, h, w, w, 1, r, acc);   // 水平
+        boxBlur1D(tmp, alpha, w, h, 1, w, r, acc);   // 垂直
+    }
+}
+
+QString paramsKey(const Elevation::ShadowParams& p, qreal dpr) {
+    return QStringLiteral("%1_%2_%3_%4_%5")
+        .arg(p.blurRadius).arg(p.spreadRadius).arg(p.color.rgba()).arg(p.opacity).arg(dpr);
+}
+
+// spread 通过描边外扩实现
+QPainterPath withSpread(const QPainterPath& path, int spreadRadius) {
+    if (spreadRadius <= 0) return path;
+    QPainterPathStroker stroker;
+    stroker.setWidth(2 * spreadRadius);
+    stroker.setJoinStyle(Qt::RoundJoin);
+    return path.united(stroker.createStroke(path));
+}
+
+} // namespace
+
+int ShadowRenderer::extent(const Elevation::ShadowParams& params) {
+    return qMax(0, params.blurRadius) + qMax(0, params.spreadRadius);
+}
+
+qreal ShadowRenderer::devicePixelRatio(const QPainter& painter) {
+    const QPaintDevice* device = painter.device();
+    return device ? device->devicePixelRatioF() : 1.0;
+}
+
+QPixmap ShadowRenderer::renderShadow(const QPainterPath& shape, const QSize& size,
+                                     const Elevation::ShadowParams& params, qreal dpr) {
+    const QSize deviceSize(qCeil(size.width() * dpr), qCeil(size.height() * dpr));
+    if (deviceSize.isEmpty()) return {};
+
+    QImage image(deviceSize, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+    {
+        QPainter p(&image);
+        p.setRenderHint(QPainter::Antialiasing);
+        p.scale(dpr, dpr);
+        p.setPen(Qt::NoPen);
+        p.setBrush(Qt::black);
+        p.drawPath(shape);
+    }
+
+    const int w = image.width();
+    const int h = image.height();
+    std::vector<int> alpha(size_t(w) * size_t(h));
+    for (int y = 0; y < h; ++y) {
+        const QRgb* line = reinterpret_cast<const QRgb*>(image.constScanLine(y));
+        for (int x = 0; x < w; ++x) alpha[size_t(y) * w + x] = qAlpha(line[x]);
+    }
+
+    // CSS 约定：blurRadius = 2σ（设备像素下按 DPR 放大）
+    gaussianBlur(alpha, w, h, params.blurRadius * dpr / 2.0);
+
+    const QColor& c = params.color;
+    const qreal opacity = params.opacity * c.alphaF();
+    for (int y = 0; y < h; ++y) {
+        QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y));
+        for (int x = 0; x < w; ++x) {
+            const int a = qBound(0, qRound(alpha[size_t(y) * w + x] * opacity), 255);
+            line[x] = qPremultiply(qRgba(c.red(), c.green(), c.blue(), a));
+        }
+    }
+
+    QPixmap pixmap = QPixmap::fromImage(image);
+    pixmap.setDevicePixelRatio(dpr);
+    return pixmap;
+}
+
+void ShadowRenderer::drawRoundedRectShadow(QPainter& painter, const QRect& contentRect, int radius,
+                                           const Elevation::ShadowParams& params) {
+    if (contentRect.isEmpty() || params.opacity <= 0.0) return;
+
+    const qreal dpr = devicePixelRatio(painter);
+    const int blur = qMax(0, params.blurRadius);
+    const int spread = qMax(0, params.spreadRadius);
+    const int shapeRadius = qMax(0, radius) + spread;
+    const QRect outer = contentRect.adjusted(-blur - spread, -blur - spread, blur + spread, blur + spread)
+                                   .translated(params.offsetX, params.offsetY);
+
+    // 角块 = 外侧模糊 blur + 圆角 + 内侧 2*blur（保证中心行列已完全平坦，可任意拉伸）
+    const int corner = 3 * blur + shapeRadius;
+    const QString base = paramsKey(params, dpr) + QLatin1Char('_') + QString::number(shapeRadius);
+
+    if (outer.width() < 2 * corner + 1 || outer.height() < 2 * corner + 1) {
+        // 内容过小，九宫格角块会重叠：按实际尺寸整张渲染
+        const QString key = QStringLiteral("fluent_shadow_rect_") + base + QLatin1Char('_')
+                            + QString::number(outer.width()) + QLatin1Char('x') + QString::number(outer.height());
+        QPixmap full;
+        if (!QPixmapCache::find(key, &full)) {
+            QPainterPath shape;
+            shape.addRoundedRect(QRectF(blur, blur, outer.width() - 2 * blur, outer.height() - 2 * blur),
+                                 shapeRadius, shapeRadius);
+            full = renderShadow(shape, outer.size(), params, dpr);
+            QPixmapCache::insert(key, full);
+        }
+        painter.drawPixmap(outer.topLeft(), full);
+        return;
+    }
+
+    const int side = 2 * corner + 1;
+    const QString key = QStringLiteral("fluent_shadow_ninepatch_") + base;
+    QPixmap tile;
+    if (!QPixmapCache::find(key, &tile)) {
+        QPainterPath shape;
+        shape.addRoundedRect(QRectF(blur, blur, side - 2 * blur, side - 2 * blur), shapeRadius, shapeRadius);
+        tile = renderShadow(shape, QSize(side, side), params, dpr);
+        QPixmapCache::insert(key, tile);
+    }
+
+    // 目标与源的三段切分：角块原样、边与中心拉伸（源坐标为设备像素）
+    const qreal tx[4] = { qreal(outer.left()), qreal(outer.left() + corner),
+                          qreal(outer.left() + outer.width() - corner), qreal(outer.left() + outer.width()) };
+    const qreal ty[4] = { qreal(outer.top()), qreal(outer.top() + corner),
+                          qreal(outer.top() + outer.height() - corner), qreal(outer.top() + outer.height()) };
+    const qreal sc = corner * dpr;
+    const qreal sx[4] = { 0.0, sc, tile.width() - sc, qreal(tile.width()) };
+    const qreal sy[4] = { 0.0, sc, tile.height() - sc, qreal(tile.height()) };
+
+    for (int row = 0; row < 3; ++row) {
+        for (int col = 0; col < 3; ++col) {
+            const QRectF target(QPointF(tx[col], ty[row]), QPointF(tx[col + 1], ty[row + 1]));
+            const QRectF source(QPointF(sx[col], sy[row]), QPointF(sx[col + 1], sy[row + 1]));
+            painter.drawPixmap(target, tile, source);
+        }
+    }
+}
+
+void ShadowRenderer::drawPathShadow(QPainter& painter, const QPainterPath& path,
+                                    const Elevation::ShadowParams& params) {
+    if (path.isEmpty() || params.opacity <= 0.0) return;
+
+    const qreal dpr = devicePixelRatio(painter);
+    const int blur = qMax(0, params.blurRadius);
+
+    QPainterPath shape = withSpread(path, params.spreadRadius);
+
+    const QRect box = shape.boundingRect().toAlignedRect().adjusted(-blur, -blur, blur, blur);
+    shape.translate(-box.topLeft());
+
+    // 缓存键只取决于形状本身（与绘制位置无关）
+    QVector<qreal> coords;
+    coords.reserve(shape.elementCount() * 3);
+    for (int i = 0; i < shape.elementCount(); ++i) {
+        const QPainterPath::Element e = shape.elementAt(i);
+        coords << qreal(e.type) << e.x << e.y;
+    }
+    const QString key = QStringLiteral("fluent_shadow_path_") + paramsKey(params, dpr) + QLatin1Char('_')
+                        + QString::number(quint64(qHashBits(coords.constData(), coords.size() * sizeof(qreal))))
+                        + QLatin1Char('_') + QString::number(box.width()) + QLatin1Char('x') + QString::number(box.height());
+
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = renderShadow(shape, box.size(), params, dpr);
+        QPixmapCache::insert(key, pixmap);
+    }
+    painter.drawPixmap(box.topLeft() + QPoint(params.offsetX, params.offsetY), pixmap);
+}
+
+void ShadowRenderer::drawPathShadow(QPainter& painter, const QString& shapeKey, const QRect& bounds,
+                                    const std::function<QPainterPath()>& buildPath,
+                                    const Elevation::ShadowParams& params) {
+    if (bounds.isEmpty() || params.opacity <= 0.0) return;
+
+    const qreal dpr = devicePixelRatio(painter);
+    const int m = extent(params);
+    const QRect box = bounds.adjusted(-m, -m, m, m);
+    const QString key = QStringLiteral("fluent_shadow_shape_") + paramsKey(params, dpr) + QLatin1Char('_')
+                        + shapeKey + QLatin1Char('_')
+                        + QString::number(box.width()) + QLatin1Char('x') + QString::number(box.height());
+
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        QPainterPath shape = withSpread(buildPath(), params.spreadRadius);
+        shape.translate(-box.topLeft());
+        pixmap = renderShadow(shape, box.size(), params, dpr);
+        QPixmapCache::insert(key, pixmap);
+    }
+    painter.drawPixmap(box.topLeft() + QPoint(params.offsetX, params.offsetY), pixmap);
+}
@@ -0,0 +1,60 @@
+#ifndef SHADOWRENDERER_H
+#define SHADOWRENDERER_H
+
+#include <QPainter>
+#include <QPainterPath>
+#include <QPixmap>
+#include <QRect>
+#include <QString>
+#include <functional>
+#include "design/Elevation.h"
+
+/**
+ * @brief ShadowRenderer - 浮层阴影的共享渲染器（Dialog / FluentMenu / Popup / TeachingTip）
+ *
+ * 阴影按 ShadowParams.blurRadius 做三遍 box blur（近似高斯模糊），结果缓存到 QPixmapCache：
+ * - 圆角矩形：只渲染一张最小九宫格贴图，绘制时四角原样贴、四边与中心拉伸，
+ *   与内容尺寸无关，缓存键为 (阴影参数, 圆角, DPR)。
+ * - 任意路径：按路径内容整张缓存，形状不变时直接复用。
+ * - 调用方能给出形状键时（如 TeachingTip 气泡的尺寸/圆角/尾巴几何），按该键缓存，
+ *   命中时既不构造路径也不遍历路径元素。
+ *
+ * 阴影参数已区分 Light/Dark 主题，因此缓存键天然覆盖主题；打开/关闭的透明度动画
+ * 每帧只剩若干次 drawPixmap，开销与阴影质量无关。
+ */
+class ShadowRenderer {
+public:
+    /** 在 contentRect 外围绘制圆角矩形阴影；contentRect 为未偏移的内容区域 */
+    static void drawRoundedRectShadow(QPainter& painter, const QRect& contentRect, int radius,
+                                      const Elevation::ShadowParams& params);
+
+    /** 绘制任意闭合路径的阴影 */
+    static void drawPathShadow(QPainter& painter, const QPainterPath& path,
+                               const Elevation::ShadowParams& params);
+
+    /**
+     * @brief 按调用方提供的形状键绘制任意路径的阴影
+     * @param shapeKey  唯一确定形状（与位置无关）的键
+     * @param bounds    包含整个形状的矩形，贴图按其尺寸 + extent() 生成
+     * @param buildPath 仅在缓存未命中时调用，返回与 bounds 同坐标系的路径
+     */
+    static void drawPathShadow(QPainter& painter, const QString& shapeKey, const QRect& bounds,
+                               const std::function<QPainterPath()>& buildPath,
+                               const Elevation::ShadowParams& params);
+
+    /** 阴影超出形状边缘的最大距离（blur + spread），用于计算预留边距 */
+    static int extent(const Elevation::ShadowParams& params);
+
+    /**
+     * @brief 渲染模糊后的阴影贴图（未缓存）
+     * @param shape  形状，坐标相对贴图左上角（逻辑像素），需已留出 extent() 边距
+     * @param size   贴图逻辑尺寸
+     */
+    static QPixmap renderShadow(const QPainterPath& shape, const QSize& size,
+                                const Elevation::ShadowParams& params, qreal dpr);
+
+private:
+    static qreal devicePixelRatio(const QPainter& painter);
+};
+
+#endif // SHADOWRENDERER_H
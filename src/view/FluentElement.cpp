@@ -8,6 +8,30 @@
 #include "design/Animation.h"
 #include "design/Material.h"
 #include "design/Breakpoints.h"
+#include <QGuiApplication>
+#include <QScreen>
+#include <QHash>
+#include <QWidget>
+#include <QPointer>
+#include <QElapsedTimer>
+#include <utility>
+
+namespace {
+const Typography::FontStyle& typographyStyle(FluentElement::FontRole role) {
+    using R = FluentElement::FontRole;
+    switch (role) {
+        case R::Caption:         return Typography::Styles::Caption;
+        case R::BodyStrong:      return Typography::Styles::BodyStrong;
+        case R::BodyLarge:       return Typography::Styles::BodyLarge;
+        case R::BodyLargeStrong: return Typography::Styles::BodyLargeStrong;
+        case R::Subtitle:        return Typography::Styles::Subtitle;
+        case R::Title:           return Typography::Styles::Title;
+        case R::TitleLarge:      return Typography::Styles::TitleLarge;
+        case R::Display:         return Typography::Styles::Display;
+        default:                 return Typography::Styles::Body;
+    }
+}
+} // namespace
 
 // --- FluentElement 生命周期管理 ---
 
@@ -16,7 +40,9 @@ FluentElement::FluentElement() : d_ptr(new FluentElementPrivate(this)) {
 }
 
 FluentElement::~FluentElement() {
-    FluentThemeManager::instance()->elements.remove(this);
+    auto* mgr = FluentThemeManager::instance();
+    mgr->elements.remove(this);
+    mgr->pending.remove(this);
     delete d_ptr;
 }
 
@@ -26,6 +52,10 @@ void FluentElement::setTheme(Theme theme) {
     auto* mgr = FluentThemeManager::instance();
     if (mgr->currentTheme != theme) {
         mgr->currentTheme = theme;
+        // 整表指针切换：回调中读取到的 token 表始终与 currentTheme 一致
+        mgr->colors.store(theme == Dark ? &mgr->darkColors : &mgr->lightColors,
+                          std::memory_order_release);
+        mgr->invalidateFonts();
         mgr->notifyAll();
     }
 }
@@ -35,10 +65,193 @@ FluentElement::Theme FluentElement::currentTheme() {
     return FluentThemeManager::instance()->currentTheme;
 }
 
-// --- 数据获取实现 ---
+void FluentElement::setThemeTransitionHook(ThemeTransitionHook hook) {
+    FluentThemeManager::instance()->transitionHook = std::move(hook);
+}
+
+void FluentElement::setThemeUpdateHook(ThemeUpdateHook hook) {
+    FluentThemeManager::instance()->updateHook = std::move(hook);
+}
+
+void FluentElement::flushThemeUpdates() {
+    FluentThemeManager::instance()->flushPending(false);
+}
+
+// --- 主题切换管线 ---
+
+namespace {
+struct WindowGroup {
+    QPointer<QWidget> window;
+    QVector<FluentElement*> elements;
+};
+
+// 按顶层窗口归组；非 QWidget 元素（window 为空）单独成组
+QVector<WindowGroup> groupByWindow(const QSet<FluentElement*>& source, bool visibleOnly) {
+    QVector<WindowGroup> groups;
+    QHash<QWidget*, int> indexOf;
+    for (FluentElement* e : source) {
+        auto* w = dynamic_cast<QWidget*>(e);
+        QWidget* window = w ? w->window() : nullptr;
+        if (visibleOnly && window && !window->isVisible()) continue;
+        auto it = indexOf.find(window);
+        if (it == indexOf.end()) {
+            it = indexOf.insert(window, groups.size());
+            groups.append({ window, {} });
+        }
+        groups[it.value()].elements.append(e);
+    }
+    return groups;
+}
+} // namespace
+
+void FluentThemeManager::notifyAll() {
+    using Stats = FluentElement::ThemeTransitionStats;
+    QElapsedTimer timer;
+    timer.start();
+
+    // 1. 分组。本轮重新覆盖所有元素，上一轮遗留的 pending 一并重新归类
+    pending.clear();
+    const QVector<WindowGroup> groups = groupByWindow(elements, false);
+    QVector<const WindowGroup*> visible, hidden;
+    for (const WindowGroup& g : groups) {
+        if (!g.window || g.window->isVisible()) visible.append(&g);
+        else hidden.append(&g);
+    }
+    report(Stats::Grouping, groups.size(), elements.size(), timer.nsecsElapsed());
 
-FluentElement::Colors FluentElement::themeColors() const {
-    Colors c;
+    // 2. 可见窗口优先
+    timer.restart();
+    int count = 0;
+    for (const WindowGroup* g : visible) count += updateWindow(g->window, g->elements);
+    report(Stats::VisibleWindows, visible.size(), count, timer.nsecsElapsed());
+
+    // 3. 隐藏窗口：延迟到显示时补发
+    for (const WindowGroup* g : hidden) {
+        if (!g->window) continue;
+        for (FluentElement* e : g->elements) {
+            if (elements.contains(e)) pending.insert(e);
+        }
+        deferUntilShown(g->window);
+    }
+}
+
+void FluentThemeManager::flushPending(bool visibleOnly) {
+    if (pending.isEmpty()) return;
+    QElapsedTimer timer;
+    timer.start();
+
+    const QVector<WindowGroup> groups = groupByWindow(pending, visibleOnly);
+    int count = 0;
+    for (const WindowGroup& g : groups) {
+        for (FluentElement* e : g.elements) pending.remove(e);
+    }
+    for (const WindowGroup& g : groups) count += updateWindow(g.window, g.elements);
+
+    if (pending.isEmpty()) {
+        for (QWidget* w : std::as_const(m_watchedWindows)) w->removeEventFilter(this);
+        m_watchedWindows.clear();
+    }
+    if (count > 0)
+        report(FluentElement::ThemeTransitionStats::DeferredWindows, groups.size(), count, timer.nsecsElapsed());
+}
+
+int FluentThemeManager::updateWindow(QWidget* window, const QVector<FluentElement*>& group) {
+    // 暂停整窗重绘：组内大量 setStyleSheet/setFont 只在恢复时合并为一次 update，
+    // 其触发的 LayoutRequest 为 posted 事件，由事件循环按控件合并处理
+    QPointer<QWidget> guard(window);
+    const bool suspend = window && window->updatesEnabled();
+    if (suspend) window->setUpdatesEnabled(false);
+
+    int count = 0;
+    QElapsedTimer timer;
+    for (FluentElement* e : group) {
+        if (!elements.contains(e)) continue;   // 回调中可能销毁了其他元素
+        if (updateHook) {
+            timer.start();
+            e->onThemeUpdated();
+            if (updateHook && elements.contains(e)) updateHook(e, timer.nsecsElapsed());
+        } else {
+            e->onThemeUpdated();
+        }
+        ++count;
+    }
+
+    if (suspend && guard) guard->setUpdatesEnabled(true);
+    return count;
+}
+
+void FluentThemeManager::deferUntilShown(QWidget* window) {
+    if (m_watchedWindows.contains(window)) return;
+    m_watchedWindows.insert(window);
+    window->installEventFilter(this);
+    connect(window, &QObject::destroyed, this, &FluentThemeManager::forgetWindow, Qt::UniqueConnection);
+}
+
+void FluentThemeManager::forgetWindow(QObject* window) {
+    // 析构中的对象只用作键，不解引用
+    m_watchedWindows.remove(static_cast<QWidget*>(window));
+}
+
+bool FluentThemeManager::eventFilter(QObject* watched, QEvent* event) {
+    if (event->type() == QEvent::Show) flushPending(true);
+    return QObject::eventFilter(watched, event);
+}
+
+void FluentThemeManager::report(FluentElement::ThemeTransitionStats::Phase phase,
+                                int windows, int elementCount, qint64 nsecs) {
+    if (transitionHook) transitionHook({ phase, windows, elementCount, nsecs });
+}
+
+// --- Token 表构建（每个主题只构建一次，由 FluentThemeManager 持有） ---
+
+FluentThemeManager::FluentThemeManager()
+    : lightColors(buildColors(FluentElement::Light))
+    , darkColors(buildColors(FluentElement::Dark))
+    , colors(&lightColors) {}
+
+// --- 字体缓存 ---
+
+namespace {
+// QGuiApplication 析构前释放缓存的 QFont，避免静态单例在字体引擎销毁后才析构
+void releaseFontCache() {
+    FluentThemeManager::instance()->invalidateFonts();
+}
+} // namespace
+
+const FluentThemeManager::FontEntry& FluentThemeManager::fontEntry(FluentElement::FontRole role) {
+    const int i = qBound(0, int(role), int(FluentElement::FontRole::Count) - 1);
+    if (!fonts[i]) {
+        watchScreens();
+        const Typography::FontStyle& s = typographyStyle(FluentElement::FontRole(i));
+        fonts[i].reset(new FontEntry(s.toQFont()));
+    }
+    return *fonts[i];
+}
+
+void FluentThemeManager::invalidateFonts() {
+    for (auto& f : fonts) f.reset();
+}
+
+void FluentThemeManager::watchScreens() {
+    if (m_watchingScreens || !qGuiApp) return;
+    m_watchingScreens = true;
+    qAddPostRoutine(releaseFontCache);
+
+    auto watch = [this](QScreen* screen) {
+        connect(screen, &QScreen::logicalDotsPerInchChanged, this, &FluentThemeManager::invalidateFonts);
+        connect(screen, &QScreen::physicalDotsPerInchChanged, this, &FluentThemeManager::invalidateFonts);
+    };
+    for (QScreen* screen : QGuiApplication::screens()) watch(screen);
+    connect(qGuiApp, &QGuiApplication::screenAdded, this, [this, watch](QScreen* screen) {
+        watch(screen);
+        invalidateFonts();
+    });
+    connect(qGuiApp, &QGuiApplication::screenRemoved, this, &FluentThemeManager::invalidateFonts);
+    connect(qGuiApp, &QGuiApplication::primaryScreenChanged, this, &FluentThemeManager::invalidateFonts);
+}
+
+FluentElement::Colors FluentThemeManager::buildColors(FluentElement::Theme theme) {
+    FluentElement::Colors c;
 
     // 用 lambda 统一填充，避免 Light/Dark 两块完全重复
     auto fill = [&](
@@ -84,7 +297,7 @@ FluentElement::Colors FluentElement::themeColors() const {
         c.charts = QList<QColor>(charts.begin(), charts.end());
     };
 
-    if (currentTheme() == Dark) {
+    if (theme == FluentElement::Dark) {
         using namespace ThemeColors::Dark;
         fill(Fill::AccentDefault, Fill::AccentSecondary, Fill::AccentTertiary, Fill::AccentDisabled,
              Fill::ControlDefault, Fill::ControlSecondary, Fill::ControlTertiary, Fill::ControlDisabled,
@@ -124,21 +337,52 @@ FluentElement::Colors FluentElement::themeColors() const {
     return c;
 }
 
+// --- 数据获取实现 ---
+
+const FluentElement::Colors& FluentElement::themeColors() const {
+    return *FluentThemeManager::instance()->colors.load(std::memory_order_acquire);
+}
+
+FluentElement::FontRole FluentElement::fontRole(const QString& role) {
+    static const QHash<QString, FontRole> kRoles = {
+        { Typography::FontRole::Caption,         FontRole::Caption },
+        { Typography::FontRole::Body,            FontRole::Body },
+        { Typography::FontRole::BodyStrong,      FontRole::BodyStrong },
+        { Typography::FontRole::BodyLarge,       FontRole::BodyLarge },
+        { Typography::FontRole::BodyLargeStrong, FontRole::BodyLargeStrong },
+        { Typography::FontRole::Subtitle,        FontRole::Subtitle },
+        { Typography::FontRole::Title,           FontRole::Title },
+        { Typography::FontRole::TitleLarge,      FontRole::TitleLarge },
+        { Typography::FontRole::Display,         FontRole::Display },
+    };
+    return kRoles.value(role, FontRole::Body);
+}
+
 FluentElement::FontStyle FluentElement::themeFont(const QString& role) const {
-    Typography::FontStyle s;
-    if      (role == Typography::FontRole::Caption)         s = Typography::Styles::Caption;
-    else if (role == Typography::FontRole::BodyStrong)      s = Typography::Styles::BodyStrong;
-    else if (role == Typography::FontRole::BodyLarge)       s = Typography::Styles::BodyLarge;
-    else if (role == Typography::FontRole::BodyLargeStrong) s = Typography::Styles::BodyLargeStrong;
-    else if (role == Typography::FontRole::Subtitle)        s = Typography::Styles::Subtitle;
-    else if (role == Typography::FontRole::Title)           s = Typography::Styles::Title;
-    else if (role == Typography::FontRole::TitleLarge)      s = Typography::Styles::TitleLarge;
-    else if (role == Typography::FontRole::Display)         s = Typography::Styles::Display;
-    else                                                    s = Typography::Styles::Body;
+    return themeFont(fontRole(role));
+}
 
+FluentElement::FontStyle FluentElement::themeFont(FontRole role) const {
+    const Typography::FontStyle& s = typographyStyle(role);
     return { s.family, s.styleName, s.size, s.weight, s.lineHeight };
 }
 
+const QFont& FluentElement::themeQFont(const QString& role) const {
+    return themeQFont(fontRole(role));
+}
+
+const QFont& FluentElement::themeQFont(FontRole role) const {
+    return FluentThemeManager::instance()->fontEntry(role).font;
+}
+
+const QFontMetrics& FluentElement::themeFontMetrics(FontRole role) const {
+    return FluentThemeManager::instance()->fontEntry(role).metrics;
+}
+
+const QFontMetricsF& FluentElement::themeFontMetricsF(FontRole role) const {
+    return FluentThemeManager::instance()->fontEntry(role).metricsF;
+}
+
 FluentElement::Radius FluentElement::themeRadius() const {
     return { ::CornerRadius::None, ::CornerRadius::Control, ::CornerRadius::Overlay };
 }
@@ -3,8 +3,10 @@
 
 #include <QColor>
 #include <QFont>
+#include <QFontMetrics>
 #include <QString>
 #include <QEasingCurve>
+#include <functional>
 #include "compatibility/QtCompat.h"
 #include "design/Elevation.h"
 #include "design/Animation.h"
@@ -21,6 +23,13 @@ class FluentElement {
 public:
     enum Theme { Light, Dark };
 
+    /** 排版角色枚举：与 Typography::FontRole 字符串一一对应，用作字体缓存的 O(1) 键 */
+    enum class FontRole : int {
+        Caption, Body, BodyStrong, BodyLarge, BodyLargeStrong,
+        Subtitle, Title, TitleLarge, Display,
+        Count
+    };
+
     // --- 设计元素数据结构 ---
     
     struct Colors {
@@ -94,13 +103,42 @@ public:
         QEasingCurve standard, accelerate, decelerate, entrance, exit;
     };
 
+    /** 主题切换各阶段的耗时统计，通过 setThemeTransitionHook 上报 */
+    struct ThemeTransitionStats {
+        enum Phase {
+            Grouping,        // 按顶层窗口分组
+            VisibleWindows,  // 可见窗口的 onThemeUpdated
+            DeferredWindows  // 隐藏窗口显示时补发的 onThemeUpdated
+        };
+        Phase  phase;
+        int    windows;   // 本阶段涉及的顶层窗口数
+        int    elements;  // 本阶段回调的元素数（Grouping 阶段为待分组总数）
+        qint64 nsecs;     // 本阶段耗时
+    };
+    using ThemeTransitionHook = std::function<void(const ThemeTransitionStats&)>;
+    /** 单个元素 onThemeUpdated 的耗时，通过 setThemeUpdateHook 上报（性能 HUD 使用） */
+    using ThemeUpdateHook = std::function<void(FluentElement* element, qint64 nsecs)>;
+
     // --- 静态全局管理 ---
     static void setTheme(Theme theme);
     static Theme currentTheme();
+    static void setThemeTransitionHook(ThemeTransitionHook hook);
+    static void setThemeUpdateHook(ThemeUpdateHook hook);
+    /** 立即补发所有因窗口隐藏而延迟的 onThemeUpdated（如离屏 render 前） */
+    static void flushThemeUpdates();
 
     // --- 组件访问接口 ---
-    Colors themeColors() const;
+    const Colors& themeColors() const;   // 当前主题的不可变缓存表（跨 setTheme 持有的引用仍指向旧主题）
     FontStyle themeFont(const QString& styleName = "Body") const;
+    FontStyle themeFont(FontRole role) const;
+
+    // 已解析字体缓存：按角色缓存 QFont 与 metrics，仅在主题或屏幕 DPI 变化时失效。
+    // 返回的引用在下一次失效前有效，paint/sizeHint 中即取即用，不要长期保存。
+    const QFont& themeQFont(const QString& styleName = "Body") const;
+    const QFont& themeQFont(FontRole role) const;
+    const QFontMetrics& themeFontMetrics(FontRole role) const;
+    const QFontMetricsF& themeFontMetricsF(FontRole role) const;
+    static FontRole fontRole(const QString& styleName);  // 未知名称回退为 Body
     Radius themeRadius() const;
     Spacing themeSpacing() const;
     Animation themeAnimation() const;
@@ -115,6 +153,7 @@ public:
     /**
      * @brief 主题更新回调
      * 当全局主题变化时，所有继承自此类的活跃实例都会被调用。
+     * 所在顶层窗口隐藏时，调用延迟到该窗口显示（或 flushThemeUpdates()）为止。
      */
     virtual void onThemeUpdated() {}
 
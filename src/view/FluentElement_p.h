@@ -3,11 +3,22 @@
 
 #include <QObject>
 #include <QSet>
+#include <QVector>
+#include <QFont>
+#include <QFontMetrics>
+#include <atomic>
+#include <memory>
 #include "FluentElement.h"
 
+class QWidget;
+
 /**
  * @brief FluentThemeManager - 内部全局主题管理器
  * 负责维护所有活跃的 FluentElement 实例并分发主题变更通知。
+ * 同时持有预构建的 Light/Dark 颜色 token 表：表内容构建后不可变，
+ * setTheme 只切换 colors 指针，themeColors() 以 const 引用返回，无拷贝无分配。
+ * 字体按 FontRole 懒构建 QFont/QFontMetrics 缓存，主题切换或屏幕增删/DPI 变化时整体失效。
+ * 主题变更按顶层窗口分批分发：可见窗口优先，隐藏窗口延迟到首次显示。
  */
 class FluentThemeManager : public QObject {
     Q_OBJECT
@@ -20,15 +31,45 @@ public:
     FluentElement::Theme currentTheme = FluentElement::Light;
     QSet<FluentElement*> elements;
 
-    void notifyAll() {
-        // 使用副本遍历，防止回调中对象销毁导致迭代器失效
-        auto copy = elements;
-        for (auto* e : copy) {
-            if (elements.contains(e)) {
-                e->onThemeUpdated();
-            }
-        }
-    }
+    const FluentElement::Colors lightColors;
+    const FluentElement::Colors darkColors;
+    std::atomic<const FluentElement::Colors*> colors;   ///< 指向当前主题的 token 表
+
+    struct FontEntry {
+        QFont font;
+        QFontMetrics metrics;
+        QFontMetricsF metricsF;
+        explicit FontEntry(const QFont& f) : font(f), metrics(f), metricsF(f) {}
+    };
+    std::unique_ptr<FontEntry> fonts[int(FluentElement::FontRole::Count)];
+
+    const FontEntry& fontEntry(FluentElement::FontRole role);
+    void invalidateFonts();
+
+    // --- 主题切换管线 ---
+    // notifyAll 按顶层窗口分组：可见窗口立即更新（每个窗口内暂停重绘，结束后合并为一次），
+    // 隐藏窗口的元素记入 pending，待窗口 Show 时再补发 onThemeUpdated。
+    QSet<FluentElement*> pending;
+    FluentElement::ThemeTransitionHook transitionHook;
+    FluentElement::ThemeUpdateHook updateHook;
+
+    void notifyAll();
+    void flushPending(bool visibleOnly);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    FluentThemeManager();
+    void watchScreens();
+    bool m_watchingScreens = false;
+
+    int updateWindow(QWidget* window, const QVector<FluentElement*>& group);
+    void deferUntilShown(QWidget* window);
+    void forgetWindow(QObject* window);
+    void report(FluentElement::ThemeTransitionStats::Phase phase, int windows, int elementCount, qint64 nsecs);
+    QSet<QWidget*> m_watchedWindows;
+    static FluentElement::Colors buildColors(FluentElement::Theme theme);
 };
 
 /**
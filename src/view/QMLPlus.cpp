@@ -2,10 +2,17 @@
 #include "FluentElement.h"
 #include <QWidgetItem>
 #include <QDebug>
+#include <QColor>
+#include <QCoreApplication>
+#include <QHash>
+#include <QPointer>
+#include <QRect>
+#include <QStringList>
+#include <utility>
 
 namespace view {
 
-// --- AnchorLayout 实现 (保持不变) ---
+// --- AnchorLayout 实现 ---
 
 AnchorLayout::AnchorLayout(QWidget* parent) : QLayout(parent) {
     setContentsMargins(0, 0, 0, 0);
@@ -16,7 +23,13 @@ AnchorLayout::~AnchorLayout() {
 }
 
 void AnchorLayout::addItem(QLayoutItem* item) {
-    Item it; it.item = item; m_items.append(it); invalidate();
+    Item it; it.item = item;
+    // RTTI 只在加入时做一次，布局热路径直接使用缓存的指针
+    if (QWidget* w = item->widget()) {
+        it.host = dynamic_cast<QMLPlus*>(w);
+        it.element = dynamic_cast<FluentElement*>(w);
+    }
+    m_items.append(it); m_graphDirty = true; invalidate();
 }
 
 int AnchorLayout::count() const { return m_items.size(); }
@@ -27,6 +40,7 @@ QLayoutItem* AnchorLayout::itemAt(int index) const {
 
 QLayoutItem* AnchorLayout::takeAt(int index) {
     if (index < 0 || index >= m_items.size()) return nullptr;
+    m_graphDirty = true;
     return m_items.takeAt(index).item;
 }
 
@@ -36,32 +50,131 @@ QSize AnchorLayout::minimumSize() const { return QSize(0, 0); }
 void AnchorLayout::addAnchoredWidget(QWidget* w, const Anchors& anchors) {
     if (!w) return;
     if (parentWidget() && w->parent() != parentWidget()) w->setParent(parentWidget());
-    if (auto* qp = dynamic_cast<QMLPlus*>(w)) *(qp->anchors()) = anchors;
     for (Item& it : m_items) {
-        if (it.item->widget() == w) { it.anchors = anchors; invalidate(); return; }
+        if (it.item->widget() == w) {
+            if (it.host) { *(it.host->anchors()) = anchors; it.hostVersion = it.host->anchorsVersion(); }
+            if (!sameTargets(it.anchors, anchors)) m_graphDirty = true;
+            it.anchors = anchors;
+            it.dirty = true;
+            invalidate();
+            return;
+        }
     }
     addItem(new QWidgetItem(w));
-    m_items.last().anchors = anchors;
+    Item& added = m_items.last();
+    if (added.host) { *(added.host->anchors()) = anchors; added.hostVersion = added.host->anchorsVersion(); }
+    added.anchors = anchors;
     invalidate();
 }
 
-int AnchorLayout::getWidgetIndex(QWidget* w) const {
-    for (int i = 0; i < m_items.size(); ++i) if (m_items[i].item->widget() == w) return i;
-    return -1;
+const AnchorLayout::Anchor& AnchorLayout::anchorAt(const Anchors& anchors, int slot) {
+    switch (slot) {
+        case SlotLeft: return anchors.left; case SlotRight: return anchors.right;
+        case SlotTop: return anchors.top; case SlotBottom: return anchors.bottom;
+        case SlotHCenter: return anchors.horizontalCenter;
+        default: return anchors.verticalCenter;
+    }
+}
+
+bool AnchorLayout::slotUsed(const Anchors& anchors, int slot) {
+    if (anchors.fill || anchorAt(anchors, slot).edge == Edge::None) return false;
+    switch (slot) {
+        case SlotLeft: case SlotRight: return anchors.horizontalCenter.edge == Edge::None;
+        case SlotTop: case SlotBottom: return anchors.verticalCenter.edge == Edge::None;
+        default: return true;
+    }
 }
 
-int AnchorLayout::getEdgeValue(QWidget* target, Edge edge, const QRect& parentRect) const {
-    if (!target || target == parentWidget()) {
-        switch (edge) {
-            case Edge::Left: return parentRect.left(); case Edge::Right: return parentRect.right();
-            case Edge::Top: return parentRect.top(); case Edge::Bottom: return parentRect.bottom();
-            case Edge::HCenter: return parentRect.center().x(); case Edge::VCenter: return parentRect.center().y();
-            default: return 0;
+bool AnchorLayout::sameTargets(const Anchors& a, const Anchors& b) {
+    if (a.fill != b.fill) return false;
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        const bool used = slotUsed(a, slot);
+        if (used != slotUsed(b, slot)) return false;
+        if (used && anchorAt(a, slot).target != anchorAt(b, slot).target) return false;
+    }
+    return true;
+}
+
+bool AnchorLayout::sameAnchors(const Anchors& a, const Anchors& b) {
+    if (a.fill != b.fill || a.fillMargins != b.fillMargins) return false;
+    for (int slot = 0; slot < SlotCount; ++slot) {
+        const Anchor& x = anchorAt(a, slot);
+        const Anchor& y = anchorAt(b, slot);
+        if (x.target != y.target || x.edge != y.edge || x.offset != y.offset) return false;
+    }
+    return true;
+}
+
+void AnchorLayout::compile() {
+    m_graphDirty = false;
+    const int n = m_items.size();
+
+    QHash<const QWidget*, int> indexOf;
+    indexOf.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        if (QWidget* w = m_items[i].item->widget()) indexOf.insert(w, i);
+    }
+
+    // 解析每个锚点的来源，并建立「被依赖项 → 依赖项」的边
+    QVector<int> inDegree(n, 0);
+    QVector<QVector<int>> dependents(n);
+    for (int i = 0; i < n; ++i) {
+        Item& it = m_items[i];
+        const Anchors& a = it.anchors;
+        const bool hNone = a.left.edge == Edge::None && a.right.edge == Edge::None && a.horizontalCenter.edge == Edge::None;
+        const bool vNone = a.top.edge == Edge::None && a.bottom.edge == Edge::None && a.verticalCenter.edge == Edge::None;
+        const bool hSpan = slotUsed(a, SlotLeft) && slotUsed(a, SlotRight);
+        const bool vSpan = slotUsed(a, SlotTop) && slotUsed(a, SlotBottom);
+        it.readsParent = a.fill || hNone || vNone;
+        it.usesSizeHint = !a.fill && !(hSpan && vSpan);
+        it.inCycle = false;
+        it.dirty = true;
+        for (int slot = 0; slot < SlotCount; ++slot) {
+            int& source = it.sources[slot];
+            source = kSourceUnresolved;
+            if (!slotUsed(a, slot)) continue;
+            QWidget* target = anchorAt(a, slot).target;
+            if (!target || target == parentWidget()) { source = kSourceParent; it.readsParent = true; continue; }
+            source = indexOf.value(target, kSourceUnresolved);
+            if (source >= 0) { dependents[source].append(i); ++inDegree[i]; }
+        }
+    }
+
+    // Kahn 拓扑排序；入度为 0 的项按加入顺序入队，互不依赖的项保持原有求值顺序
+    m_order.clear();
+    m_order.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        if (inDegree[i] == 0) m_order.append(i);
+    }
+    for (int head = 0; head < m_order.size(); ++head) {
+        for (int dependent : std::as_const(dependents[m_order[head]])) {
+            if (--inDegree[dependent] == 0) m_order.append(dependent);
+        }
+    }
+
+    // 剩余项处于环中（或依赖环）：按加入顺序追加，并给出诊断
+    m_cycle.clear();
+    m_dependents = std::move(dependents);
+    if (m_order.size() == n) return;
+    QStringList names;
+    for (int i = 0; i < n; ++i) {
+        if (inDegree[i] == 0) continue;
+        m_order.append(i);
+        m_items[i].inCycle = true;
+        if (QWidget* w = m_items[i].item->widget()) {
+            m_cycle.append(w);
+            QString name = QString::fromLatin1(w->metaObject()->className());
+            if (!w->objectName().isEmpty()) name += QLatin1Char('#') + w->objectName();
+            names << name;
         }
     }
-    int idx = getWidgetIndex(target);
-    if (idx == -1) return 0;
-    const QRect& r = m_items[idx].geometry;
+    qWarning().noquote() << "AnchorLayout: anchor cycle among" << m_cycle.size()
+                         << "widgets, evaluated in insertion order:" << names.join(QStringLiteral(", "));
+}
+
+int AnchorLayout::edgeValue(int source, Edge edge, const QRect& parentRect) const {
+    if (source == kSourceUnresolved) return 0;
+    const QRect& r = source == kSourceParent ? parentRect : m_items[source].geometry;
     switch (edge) {
         case Edge::Left: return r.left(); case Edge::Right: return r.right();
         case Edge::Top: return r.top(); case Edge::Bottom: return r.bottom();
@@ -70,6 +183,36 @@ int AnchorLayout::getEdgeValue(QWidget* target, Edge edge, const QRect& parentRe
     }
 }
 
+void AnchorLayout::evaluate(Item& it, const QRect& parentRect) {
+    const Anchors& a = it.anchors;
+    if (a.fill) { it.geometry = parentRect.marginsRemoved(a.fillMargins); return; }
+
+    auto value = [&](int slot) {
+        const Anchor& anchor = anchorAt(a, slot);
+        return edgeValue(it.sources[slot], anchor.edge, parentRect) + anchor.offset;
+    };
+    QRect g(parentRect.topLeft(), it.hint);
+    if (a.horizontalCenter.edge != Edge::None) {
+        g.moveCenter(QPoint(value(SlotHCenter), g.center().y()));
+    } else if (a.left.edge != Edge::None && a.right.edge != Edge::None) {
+        g.setLeft(value(SlotLeft)); g.setRight(value(SlotRight));
+    } else if (a.left.edge != Edge::None) {
+        g.moveLeft(value(SlotLeft));
+    } else if (a.right.edge != Edge::None) {
+        g.moveRight(value(SlotRight));
+    }
+    if (a.verticalCenter.edge != Edge::None) {
+        g.moveCenter(QPoint(g.center().x(), value(SlotVCenter)));
+    } else if (a.top.edge != Edge::None && a.bottom.edge != Edge::None) {
+        g.setTop(value(SlotTop)); g.setBottom(value(SlotBottom));
+    } else if (a.top.edge != Edge::None) {
+        g.moveTop(value(SlotTop));
+    } else if (a.bottom.edge != Edge::None) {
+        g.moveBottom(value(SlotBottom));
+    }
+    it.geometry = g;
+}
+
 void AnchorLayout::setGeometry(const QRect& rect) {
     QLayout::setGeometry(rect);
     if (m_items.isEmpty()) return;
@@ -86,50 +229,50 @@ void AnchorLayout::setGeometry(const QRect& rect) {
         for (const Item& it : m_items) {
             if (QWidget* w = it.item->widget()) {
                 w->ensurePolished();
-                if (auto* fe = dynamic_cast<FluentElement*>(w)) {
-                    fe->onThemeUpdated();
-                }
+                if (it.element) it.element->onThemeUpdated();
             }
         }
     }
 
-    QRect parentRect = contentsRect();
+    // 仅当 host 的锚点版本变化时才比较 / 拷贝；版本号变化但内容相同（只读式调用 anchors()）不置脏
     for (Item& it : m_items) {
+        if (!it.host || it.host->anchorsVersion() == it.hostVersion) continue;
+        it.hostVersion = it.host->anchorsVersion();
+        const Anchors& current = it.host->currentAnchors();
+        if (sameAnchors(it.anchors, current)) continue;
+        if (!sameTargets(it.anchors, current)) m_graphDirty = true;
+        it.anchors = current;
+        it.dirty = true;
+    }
+
+    // 锚点目标变化时才重新编译依赖图（全部项置脏）；之后按拓扑序单趟扫描，
+    // 只重新求值脏项：自身锚点 / sizeHint 变化、父矩形变化且依赖父矩形、或上游几何变化。
+    // 结果与上次相同则不再向下游传播，也不调用 QWidget::setGeometry。
+    if (m_graphDirty) compile();
+    const QRect parentRect = contentsRect();
+    const bool parentChanged = parentRect != m_parentRect;
+    m_parentRect = parentRect;
+    m_lastEvaluated = 0;
+
+    for (int index : std::as_const(m_order)) {
+        Item& it = m_items[index];
+        if (it.usesSizeHint) {
+            const QSize hint = it.item->sizeHint();
+            if (hint != it.hint) { it.hint = hint; it.dirty = true; }
+        }
+        if (!it.dirty && !it.inCycle && !(parentChanged && it.readsParent)) continue;
+
+        it.dirty = false;
+        const QRect old = it.geometry;
+        evaluate(it, parentRect);
+        ++m_lastEvaluated;
+        if (it.geometry != old) {
+            for (int dependent : std::as_const(m_dependents[index])) m_items[dependent].dirty = true;
+        }
         if (QWidget* w = it.item->widget()) {
-            if (auto* qp = dynamic_cast<QMLPlus*>(w)) it.anchors = *(qp->anchors());
-        }
-        it.geometry = QRect(parentRect.topLeft(), it.item->sizeHint());
-    }
-    for (int pass = 0; pass < 5; ++pass) {
-        bool changed = false;
-        for (Item& it : m_items) {
-            QRect old = it.geometry; QSize s = it.item->sizeHint();
-            if (it.anchors.fill) { it.geometry = parentRect.marginsRemoved(it.anchors.fillMargins); }
-            else {
-                if (it.anchors.horizontalCenter.edge != Edge::None) {
-                    it.geometry.moveCenter(QPoint(getEdgeValue(it.anchors.horizontalCenter.target, it.anchors.horizontalCenter.edge, parentRect) + it.anchors.horizontalCenter.offset, it.geometry.center().y()));
-                } else {
-                    int l = getEdgeValue(it.anchors.left.target, it.anchors.left.edge, parentRect) + it.anchors.left.offset;
-                    int r = getEdgeValue(it.anchors.right.target, it.anchors.right.edge, parentRect) + it.anchors.right.offset;
-                    if (it.anchors.left.edge != Edge::None && it.anchors.right.edge != Edge::None) { it.geometry.setLeft(l); it.geometry.setRight(r); }
-                    else if (it.anchors.left.edge != Edge::None) { it.geometry.moveLeft(l); it.geometry.setWidth(s.width()); }
-                    else if (it.anchors.right.edge != Edge::None) { it.geometry.moveRight(r); it.geometry.setWidth(s.width()); }
-                }
-                if (it.anchors.verticalCenter.edge != Edge::None) {
-                    it.geometry.moveCenter(QPoint(it.geometry.center().x(), getEdgeValue(it.anchors.verticalCenter.target, it.anchors.verticalCenter.edge, parentRect) + it.anchors.verticalCenter.offset));
-                } else {
-                    int t = getEdgeValue(it.anchors.top.target, it.anchors.top.edge, parentRect) + it.anchors.top.offset;
-                    int b = getEdgeValue(it.anchors.bottom.target, it.anchors.bottom.edge, parentRect) + it.anchors.bottom.offset;
-                    if (it.anchors.top.edge != Edge::None && it.anchors.bottom.edge != Edge::None) { it.geometry.setTop(t); it.geometry.setBottom(b); }
-                    else if (it.anchors.top.edge != Edge::None) { it.geometry.moveTop(t); it.geometry.setHeight(s.height()); }
-                    else if (it.anchors.bottom.edge != Edge::None) { it.geometry.moveBottom(b); it.geometry.setHeight(s.height()); }
-                }
-            }
-            if (it.geometry != old) changed = true;
+            if (w->geometry() != it.geometry) w->setGeometry(it.geometry);
         }
-        if (!changed) break;
     }
-    for (const Item& it : m_items) it.item->widget()->setGeometry(it.geometry);
 }
 
 // --- PropertyBinder 实现 (保持不变) ---
@@ -143,6 +286,15 @@ void PropertyLink::syncToTarget() {
     if (val.isValid() && m_toProp.read(m_to) != val) m_toProp.write(m_to, val);
 }
 
+namespace {
+// syncToTarget() 的 QMetaMethod 只解析一次，避免每次 bind 都按签名字符串查找
+const QMetaMethod& syncToTargetMethod() {
+    static const QMetaMethod method = PropertyLink::staticMetaObject.method(
+        PropertyLink::staticMetaObject.indexOfMethod("syncToTarget()"));
+    return method;
+}
+} // namespace
+
 void PropertyBinder::bind(QObject* s, const char* sp, QObject* t, const char* tp, Direction dir) {
     if (!s || !t) return;
     auto sProp = s->metaObject()->property(s->metaObject()->indexOfProperty(sp));
@@ -150,18 +302,268 @@ void PropertyBinder::bind(QObject* s, const char* sp, QObject* t, const char* tp
     if (!sProp.isValid() || !tProp.isValid()) return;
     
     auto* link1 = new PropertyLink(s, sProp, t, tProp, t);
-    
-    // 使用新的信号槽连接语法，更安全且跨版本兼容
-    QObject::connect(s, sProp.notifySignal(), link1, link1->metaObject()->method(link1->metaObject()->indexOfMethod("syncToTarget()")));
+    QObject::connect(s, sProp.notifySignal(), link1, syncToTargetMethod());
     
     link1->syncToTarget();
     
     if (dir == TwoWay) {
         auto* link2 = new PropertyLink(t, tProp, s, sProp, s);
-        QObject::connect(t, tProp.notifySignal(), link2, link2->metaObject()->method(link2->metaObject()->indexOfMethod("syncToTarget()")));
+        QObject::connect(t, tProp.notifySignal(), link2, syncToTargetMethod());
+    }
+}
+
+// --- BindingEngine 实现 ---
+
+QVariant BindingScope::get(QObject* object, const char* property) {
+    if (!object) return QVariant();
+    const int index = object->metaObject()->indexOfProperty(property);
+    if (index < 0) return object->property(property);   // 动态属性没有 notify 信号，不登记依赖
+    return get(object, object->metaObject()->property(index));
+}
+
+QVariant BindingScope::get(QObject* object, const QMetaProperty& property) {
+    if (!object) return QVariant();
+    if (property.hasNotifySignal()) {
+        const QPair<QObject*, int> dependency(object, property.notifySignalIndex());
+        if (!m_dependencies.contains(dependency)) m_dependencies.append(dependency);
+    }
+    return property.read(object);
+}
+
+BindingEngine& BindingEngine::instance() {
+    static QPointer<BindingEngine> engine;
+    if (!engine) engine = new BindingEngine(QCoreApplication::instance());
+    return *engine;
+}
+
+BindingEngine::BindingEngine(QObject* parent) : QObject(parent) {
+    m_onChangedIndex = staticMetaObject.indexOfSlot("onDependencyChanged()");
+}
+
+int BindingEngine::bindExpression(QObject* target, const char* targetProp, Expression expression) {
+    if (!target || !expression) return 0;
+    const int index = target->metaObject()->indexOfProperty(targetProp);
+    if (index < 0) {
+        qWarning() << "BindingEngine::bindExpression: no property" << targetProp << "on" << target;
+        return 0;
+    }
+
+    auto binding = std::make_shared<Binding>();
+    binding->target = target;
+    binding->property = target->metaObject()->property(index);
+    binding->expression = std::move(expression);
+
+    const int id = m_nextId++;
+    m_bindings.insert(id, binding);
+    m_targets[target].append(id);
+    watchDestroyed(target);
+    evaluate(id);   // 建立时立即同步一次
+    return id;
+}
+
+int BindingEngine::bindProperty(QObject* target, const char* targetProp, QObject* source, const char* sourceProp) {
+    if (!source) return 0;
+    const int index = source->metaObject()->indexOfProperty(sourceProp);
+    if (index < 0) return 0;
+    const QMetaProperty property = source->metaObject()->property(index);
+    QPointer<QObject> guard(source);
+    return bindExpression(target, targetProp, [guard, property](BindingScope& scope) {
+        return guard ? scope.get(guard.data(), property) : QVariant();
+    });
+}
+
+void BindingEngine::unbind(int id) {
+    const std::shared_ptr<Binding> binding = m_bindings.take(id);
+    if (!binding) return;
+    for (const Dependency& dependency : std::as_const(binding->dependencies)) unsubscribe(id, dependency);
+    auto target = m_targets.find(binding->target);
+    if (target != m_targets.end()) {
+        target->removeOne(id);
+        if (target->isEmpty()) m_targets.erase(target);
+    }
+    m_dirty.removeOne(id);
+}
+
+void BindingEngine::beginBatch() {
+    ++m_batchDepth;
+}
+
+void BindingEngine::endBatch() {
+    if (m_batchDepth == 0) return;
+    if (--m_batchDepth == 0) flush();
+}
+
+void BindingEngine::flush() {
+    // 求值期间新产生的脏绑定（链式绑定）在本次 flush 内逐轮处理，不再另行调度
+    m_flushScheduled = true;
+    for (int round = 0; round < kMaxFlushRounds && !m_dirty.isEmpty(); ++round) {
+        const QVector<int> dirty = std::exchange(m_dirty, QVector<int>());
+        for (int id : dirty) evaluate(id);
+    }
+    m_flushScheduled = false;
+    if (!m_dirty.isEmpty()) {
+        qWarning() << "BindingEngine: bindings did not settle after" << kMaxFlushRounds << "rounds";
+        scheduleFlush();
+    }
+}
+
+void BindingEngine::evaluate(int id) {
+    const std::shared_ptr<Binding> binding = m_bindings.value(id);
+    if (!binding) return;
+    binding->dirty = false;
+
+    BindingScope scope;
+    const QVariant value = binding->expression(scope);
+    if (!m_bindings.contains(id)) return;   // 求值过程中被解除
+
+    // 按本次实际读取的依赖增减订阅
+    for (const Dependency& dependency : std::as_const(binding->dependencies)) {
+        if (!scope.m_dependencies.contains(dependency)) unsubscribe(id, dependency);
+    }
+    for (const Dependency& dependency : std::as_const(scope.m_dependencies)) {
+        if (!binding->dependencies.contains(dependency)) subscribe(id, dependency);
+    }
+    binding->dependencies = std::move(scope.m_dependencies);
+
+    if (value.isValid() && binding->property.read(binding->target) != value)
+        binding->property.write(binding->target, value);
+}
+
+void BindingEngine::subscribe(int id, const Dependency& dependency) {
+    QVector<int>& subscribers = m_subscribers[dependency];
+    if (subscribers.isEmpty()) {
+        m_connections.insert(dependency, QMetaObject::connect(dependency.first, dependency.second, this, m_onChangedIndex));
+        watchDestroyed(dependency.first);
+    }
+    subscribers.append(id);
+}
+
+void BindingEngine::unsubscribe(int id, const Dependency& dependency) {
+    auto it = m_subscribers.find(dependency);
+    if (it == m_subscribers.end()) return;
+    it->removeOne(id);
+    if (it->isEmpty()) {
+        m_subscribers.erase(it);
+        QObject::disconnect(m_connections.take(dependency));
+    }
+}
+
+void BindingEngine::watchDestroyed(QObject* object) {
+    if (m_watched.contains(object)) return;
+    m_watched.insert(object);
+    connect(object, &QObject::destroyed, this, &BindingEngine::onObjectDestroyed);
+}
+
+void BindingEngine::markDirty(int id) {
+    const std::shared_ptr<Binding> binding = m_bindings.value(id);
+    if (!binding || binding->dirty) return;
+    binding->dirty = true;
+    m_dirty.append(id);
+    scheduleFlush();
+}
+
+void BindingEngine::scheduleFlush() {
+    if (m_flushScheduled || m_batchDepth > 0) return;
+    m_flushScheduled = true;
+    QMetaObject::invokeMethod(this, &BindingEngine::flush, Qt::QueuedConnection);
+}
+
+void BindingEngine::onDependencyChanged() {
+    const Dependency dependency(sender(), senderSignalIndex());
+    const QVector<int> subscribers = m_subscribers.value(dependency);
+    for (int id : subscribers) markDirty(id);
+}
+
+void BindingEngine::onObjectDestroyed(QObject* object) {
+    m_watched.remove(object);
+
+    // 作为目标：移除其上的全部绑定
+    const QVector<int> bound = m_targets.take(object);
+    for (int id : bound) {
+        const std::shared_ptr<Binding> binding = m_bindings.take(id);
+        if (!binding) continue;
+        for (const Dependency& dependency : std::as_const(binding->dependencies)) unsubscribe(id, dependency);
+        m_dirty.removeOne(id);
+    }
+
+    // 作为依赖：只移除订阅，连接已随对象销毁断开
+    for (auto it = m_subscribers.begin(); it != m_subscribers.end();) {
+        if (it.key().first != object) { ++it; continue; }
+        for (int id : std::as_const(*it)) {
+            if (const std::shared_ptr<Binding> binding = m_bindings.value(id)) binding->dependencies.removeOne(it.key());
+        }
+        m_connections.remove(it.key());
+        it = m_subscribers.erase(it);
     }
 }
 
+namespace {
+
+// 状态过渡补间的 key 空间：取 quintptr 高位，避开控件自身使用的小整数 key
+constexpr quintptr kStateTweenKeyBase = quintptr(1) << (sizeof(quintptr) * 8 - 2);
+
+bool isInterpolatable(int type) {
+    switch (type) {
+        case QMetaType::Int: case QMetaType::Double: case QMetaType::Float:
+        case QMetaType::QColor:
+        case QMetaType::QPoint: case QMetaType::QPointF:
+        case QMetaType::QSize: case QMetaType::QSizeF:
+        case QMetaType::QRect: case QMetaType::QRectF:
+            return true;
+        default:
+            return false;
+    }
+}
+
+qreal lerp(qreal a, qreal b, qreal t) { return a + (b - a) * t; }
+int lerpInt(int a, int b, qreal t) { return qRound(lerp(a, b, t)); }
+
+/** 按属性类型插值；t 可超出 [0, 1]（回弹缓动），颜色分量截断到有效范围 */
+QVariant interpolate(int type, const QVariant& from, const QVariant& to, qreal t) {
+    switch (type) {
+        case QMetaType::Int:    return lerpInt(from.toInt(), to.toInt(), t);
+        case QMetaType::Double: return lerp(from.toDouble(), to.toDouble(), t);
+        case QMetaType::Float:  return float(lerp(from.toFloat(), to.toFloat(), t));
+        case QMetaType::QColor: {
+            const QColor a = from.value<QColor>();
+            const QColor b = to.value<QColor>();
+            auto channel = [t](qreal x, qreal y) { return qBound<qreal>(0.0, lerp(x, y, t), 1.0); };
+            return QColor::fromRgbF(channel(a.redF(), b.redF()), channel(a.greenF(), b.greenF()),
+                                    channel(a.blueF(), b.blueF()), channel(a.alphaF(), b.alphaF()));
+        }
+        case QMetaType::QPoint: {
+            const QPoint a = from.toPoint(), b = to.toPoint();
+            return QPoint(lerpInt(a.x(), b.x(), t), lerpInt(a.y(), b.y(), t));
+        }
+        case QMetaType::QPointF: {
+            const QPointF a = from.toPointF(), b = to.toPointF();
+            return QPointF(lerp(a.x(), b.x(), t), lerp(a.y(), b.y(), t));
+        }
+        case QMetaType::QSize: {
+            const QSize a = from.toSize(), b = to.toSize();
+            return QSize(lerpInt(a.width(), b.width(), t), lerpInt(a.height(), b.height(), t));
+        }
+        case QMetaType::QSizeF: {
+            const QSizeF a = from.toSizeF(), b = to.toSizeF();
+            return QSizeF(lerp(a.width(), b.width(), t), lerp(a.height(), b.height(), t));
+        }
+        case QMetaType::QRect: {
+            const QRect a = from.toRect(), b = to.toRect();
+            return QRect(lerpInt(a.x(), b.x(), t), lerpInt(a.y(), b.y(), t),
+                         lerpInt(a.width(), b.width(), t), lerpInt(a.height(), b.height(), t));
+        }
+        case QMetaType::QRectF: {
+            const QRectF a = from.toRectF(), b = to.toRectF();
+            return QRectF(lerp(a.x(), b.x(), t), lerp(a.y(), b.y(), t),
+                          lerp(a.width(), b.width(), t), lerp(a.height(), b.height(), t));
+        }
+        default:
+            return t < 1.0 ? from : to;
+    }
+}
+
+} // namespace
+
 // --- QMLPlus 实现 (优化后) ---
 
 QMLPlus::QMLPlus() : m_anchors(nullptr), m_currentState("") {}
@@ -169,40 +571,147 @@ QMLPlus::~QMLPlus() { delete m_anchors; }
 
 AnchorLayout::Anchors* QMLPlus::anchors() { 
     if (!m_anchors) m_anchors = new AnchorLayout::Anchors(); 
+    ++m_anchorsVersion;
     return m_anchors; 
 }
 
+const AnchorLayout::Anchors& QMLPlus::currentAnchors() const {
+    static const AnchorLayout::Anchors kNone;
+    return m_anchors ? *m_anchors : kNone;
+}
+
+void QMLPlus::bind(const char* tp, QObject* s, const char* sp, PropertyBinder::Direction dir) {
+    // 自动发现混入 QMLPlus 的 QWidget 宿主
+    auto* host = dynamic_cast<QWidget*>(this);
+    if (!host) {
+        qWarning() << "QMLPlus::bind failed: Host is not a QWidget!";
+        return;
+    }
+    if (dir == PropertyBinder::TwoWay) PropertyBinder::bind(s, sp, host, tp, dir);
+    else BindingEngine::instance().bindProperty(host, tp, s, sp);
+}
+
+int QMLPlus::bindExpression(const char* tp, BindingEngine::Expression expression) {
+    auto* host = dynamic_cast<QWidget*>(this);
+    if (!host) {
+        qWarning() << "QMLPlus::bindExpression failed: Host is not a QWidget!";
+        return 0;
+    }
+    return BindingEngine::instance().bindExpression(host, tp, std::move(expression));
+}
+
 void QMLPlus::setState(const QString& name) { 
     if (m_currentState != name) { applyState(name); m_currentState = name; } 
 }
 
-void QMLPlus::addState(const QMLState& state) { 
-    m_states[state.name] = state; 
+void QMLPlus::addState(const QMLState& state) {
+    CompiledState compiled;
+    compiled.name = state.name;
+    compiled.changes.reserve(state.changes.size());
+    for (const PropertyChange& c : state.changes) {
+        if (!c.target) continue;
+        compiled.changes.append({ slotFor(c.target, c.propertyName), c.value });
+    }
+    const auto it = m_stateIndex.constFind(state.name);
+    if (it != m_stateIndex.cend()) {
+        m_states[*it] = std::move(compiled);
+    } else {
+        m_stateIndex.insert(state.name, m_states.size());
+        m_states.append(std::move(compiled));
+    }
 }
 
-void QMLPlus::bind(const char* tp, QObject* s, const char* sp, PropertyBinder::Direction dir) {
-    // 自动发现混入 QMLPlus 的 QWidget 宿主
-    if (auto* host = dynamic_cast<QWidget*>(this)) {
-        PropertyBinder::bind(s, sp, host, tp, dir);
+void QMLPlus::addTransition(const QMLTransition& transition) {
+    m_transitions.append(transition);
+}
+
+int QMLPlus::slotFor(QObject* target, const QByteArray& propertyName) {
+    const int index = target->metaObject()->indexOfProperty(propertyName.constData());
+    for (int i = 0; i < m_stateSlots.size(); ++i) {
+        const StateSlot& s = m_stateSlots.at(i);
+        if (s.target != target) continue;
+        if (index >= 0 ? s.property.propertyIndex() == index : s.dynamicName == propertyName) return i;
+    }
+    StateSlot s;
+    s.target = target;
+    if (index >= 0) {
+        s.property = target->metaObject()->property(index);
+        s.interpolatable = isInterpolatable(s.property.userType());
     } else {
-        qWarning() << "QMLPlus::bind failed: Host is not a QWidget!";
+        s.dynamicName = propertyName;
     }
+    m_stateSlots.append(s);
+    return m_stateSlots.size() - 1;
+}
+
+const QMLTransition* QMLPlus::findTransition(const QString& from, const QString& to) const {
+    const QString any = QStringLiteral("*");
+    for (const QMLTransition& t : m_transitions) {
+        if ((t.from == any || t.from == from) && (t.to == any || t.to == to)) return &t;
+    }
+    return nullptr;
+}
+
+void QMLPlus::writeSlot(int slot, const QVariant& value, const QMLTransition* transition) {
+    const StateSlot& s = m_stateSlots.at(slot);
+    QObject* target = s.target;
+    if (!target) return;
+    if (!s.property.isValid()) {
+        target->setProperty(s.dynamicName.constData(), value);
+        return;
+    }
+
+    auto& scheduler = ::Animation::Scheduler::instance();
+    const quintptr key = kStateTweenKeyBase + quintptr(s.property.propertyIndex());
+    const bool animated = transition && s.interpolatable
+        && (transition->properties.isEmpty() || transition->properties.contains(QByteArray(s.property.name())));
+    if (!animated) {
+        if (s.interpolatable) scheduler.cancel(target, key);
+        s.property.write(target, value);
+        return;
+    }
+
+    // owner 为目标对象：目标销毁后补间自动回收；同一属性再次过渡时从当前值重新开始
+    const QMetaProperty property = s.property;
+    const QVariant from = property.read(target);
+    scheduler.animate(target, key, 0.0, 1.0, transition->duration, transition->easing,
+        [target, property, from, value](qreal t) { property.write(target, interpolate(property.userType(), from, value, t)); },
+        nullptr,
+        [target, property, value]() { property.write(target, value); });
 }
 
 void QMLPlus::applyState(const QString& name) {
-    if (name.isEmpty()) {
-        for (auto it = m_defaultValues.begin(); it != m_defaultValues.end(); ++it) {
-            if (!it.key()) continue;
-            for (auto pIt = it.value().begin(); pIt != it.value().end(); ++pIt) it.key()->setProperty(pIt.key().constData(), pIt.value());
+    const CompiledState* next = nullptr;
+    if (!name.isEmpty()) {
+        const auto it = m_stateIndex.constFind(name);
+        if (it == m_stateIndex.cend()) return;
+        next = &m_states.at(*it);
+    }
+    const QMLTransition* transition = findTransition(m_currentState, name);
+
+    // 新状态涉及的槽位在首次被修改前记录默认值
+    QVector<int> nextSlots;
+    if (next) {
+        nextSlots.reserve(next->changes.size());
+        for (const CompiledChange& c : next->changes) {
+            StateSlot& s = m_stateSlots[c.slot];
+            if (!s.target) continue;
+            if (!s.hasDefault) {
+                s.defaultValue = s.property.isValid() ? s.property.read(s.target) : s.target->property(s.dynamicName.constData());
+                s.hasDefault = true;
+            }
+            nextSlots.append(c.slot);
         }
-        return;
     }
-    if (!m_states.contains(name)) return;
-    for (const auto& c : m_states[name].changes) {
-        if (!c.target) continue;
-        if (!m_defaultValues[c.target.data()].contains(c.propertyName)) m_defaultValues[c.target.data()][c.propertyName] = c.target->property(c.propertyName.constData());
-        c.target->setProperty(c.propertyName.constData(), c.value);
+
+    // 上一状态修改过、新状态不再涉及的槽位恢复默认值
+    for (int slot : std::as_const(m_overriddenSlots)) {
+        if (!nextSlots.contains(slot)) writeSlot(slot, m_stateSlots.at(slot).defaultValue, transition);
+    }
+    if (next) {
+        for (const CompiledChange& c : next->changes) writeSlot(c.slot, c.value, transition);
     }
+    m_overriddenSlots = std::move(nextSlots);
 }
 
 } // namespace view
@@ -10,9 +10,21 @@
 #include <QPointer>
 #include <QMargins>
 #include <QMetaProperty>
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "design/Animation.h"
+
+class FluentElement;
 
 namespace view {
 
+class QMLPlus;
+
 // =============================================================================
 // 1. Anchors 核心定义
 // =============================================================================
@@ -50,16 +62,54 @@ public:
 
     void addAnchoredWidget(QWidget* w, const Anchors& anchors);
 
+    /**
+     * 最近一次编译锚点图时检测到的环（含依赖环的下游控件），按加入顺序排列；无环时为空。
+     * 环内控件按加入顺序各求值一次，尚未求值的兄弟项取其上一次布局结果。
+     */
+    QVector<QWidget*> anchorCycle() const { return m_cycle; }
+
+    /** 最近一次 setGeometry 实际重新求值的布局项数（未受影响的项直接沿用上次结果） */
+    int lastEvaluatedCount() const { return m_lastEvaluated; }
+
 private:
+    /// 锚点槽位，与 Anchors 中六个 Anchor 一一对应
+    enum Slot { SlotLeft, SlotRight, SlotTop, SlotBottom, SlotHCenter, SlotVCenter, SlotCount };
+    /// 编译后的锚点来源：父控件 / 不在本布局中的控件（取值为 0）；其余为兄弟项下标
+    static constexpr int kSourceParent = -1;
+    static constexpr int kSourceUnresolved = -2;
+
     struct Item {
         QLayoutItem* item = nullptr;
+        QMLPlus* host = nullptr;             ///< 控件混入 QMLPlus 时其锚点的来源（加入时解析一次）
+        FluentElement* element = nullptr;    ///< 首次布局需重新应用主题的元素（加入时解析一次）
+        quint64 hostVersion = ~quint64(0);   ///< 已同步的 host 锚点版本
         Anchors anchors;
         QRect geometry;
+        QSize hint;                  ///< 上次求值使用的 sizeHint
+        int sources[SlotCount] = { kSourceUnresolved, kSourceUnresolved, kSourceUnresolved,
+                                   kSourceUnresolved, kSourceUnresolved, kSourceUnresolved };
+        bool dirty = true;           ///< 锚点 / sizeHint / 上游边变化，需重新求值
+        bool readsParent = false;    ///< 求值依赖父控件矩形（锚定父控件、fill 或某轴未锚定）
+        bool usesSizeHint = true;    ///< 某轴未被两端约束，尺寸取自 sizeHint
+        bool inCycle = false;        ///< 处于依赖环中，每次布局都重新求值
     };
     QVector<Item> m_items;
+    QVector<int> m_order;       ///< 拓扑序：被依赖项先于依赖项
+    QVector<QVector<int>> m_dependents;  ///< 被依赖项下标 → 依赖它的项
+    QVector<QWidget*> m_cycle;
+    QRect m_parentRect;         ///< 上次布局使用的 contentsRect
+    int m_lastEvaluated = 0;
+    bool m_graphDirty = true;   ///< 锚点目标或布局项变化后需重新编译
     bool m_firstLayout = true; ///< 首次 setGeometry 标志，用于延迟 theme 初始化
-    int getWidgetIndex(QWidget* w) const;
-    int getEdgeValue(QWidget* target, Edge edge, const QRect& parentRect) const;
+
+    static const Anchor& anchorAt(const Anchors& anchors, int slot);
+    /** 当前锚点实际参与求值的槽位（fill / 居中会屏蔽其他槽位） */
+    static bool slotUsed(const Anchors& anchors, int slot);
+    static bool sameTargets(const Anchors& a, const Anchors& b);
+    static bool sameAnchors(const Anchors& a, const Anchors& b);
+    void compile();
+    void evaluate(Item& it, const QRect& parentRect);
+    int edgeValue(int source, Edge edge, const QRect& parentRect) const;
 };
 
 // =============================================================================
@@ -82,7 +132,140 @@ private:
 class PropertyBinder {
 public:
     enum Direction { OneWay, TwoWay };
+
+    /**
+     * 按属性名绑定：运行期经 QMetaProperty 读写 QVariant 并比较后写入。
+     * 适用于只在运行期才知道属性名的场景；类型已知时优先使用下面的类型化重载。
+     */
     static void bind(QObject* source, const char* sPropName, QObject* target, const char* tPropName, Direction dir = OneWay);
+
+    /**
+     * 类型化单向绑定：编译期生成 getter → setter 的直接成员调用，无 QVariant 装箱、无属性名查找。
+     * notify 为源对象的变更信号；连接以 target 为上下文，任一方销毁后自动断开。
+     * 去重交给 setter 自身（按 Qt 惯例 setter 在值不变时直接返回）。
+     *
+     *   PropertyBinder::bind<&Slider::value, &ProgressRing::setValue>(slider, &Slider::valueChanged, ring);
+     *
+     * @return 绑定对应的连接，可用于 QObject::disconnect 解除绑定
+     */
+    template <auto Getter, auto Setter, typename Source, typename Signal, typename Target>
+    static QMetaObject::Connection bind(Source* source, Signal notify, Target* target) {
+        using Value = std::invoke_result_t<decltype(Getter), Source*>;
+        static_assert(std::is_invocable_v<decltype(Setter), Target*, Value>,
+                      "PropertyBinder::bind: setter 无法接受 getter 的返回类型");
+        if (!source || !target) return {};
+        auto sync = [source, target]() { std::invoke(Setter, target, std::invoke(Getter, source)); };
+        sync();
+        return QObject::connect(source, notify, target, sync);
+    }
+
+    /**
+     * 类型化双向绑定：两侧均提供 getter / setter / notify，写入前比较当前值，避免往返回写。
+     * 初始同步方向为 source → target。
+     */
+    template <auto SourceGetter, auto SourceSetter, auto TargetGetter, auto TargetSetter,
+              typename Source, typename SourceSignal, typename Target, typename TargetSignal>
+    static void bind(Source* source, SourceSignal sourceNotify, Target* target, TargetSignal targetNotify) {
+        if (!source || !target) return;
+        auto toTarget = [source, target]() {
+            auto value = std::invoke(SourceGetter, source);
+            if (!(std::invoke(TargetGetter, target) == value)) std::invoke(TargetSetter, target, value);
+        };
+        auto toSource = [source, target]() {
+            auto value = std::invoke(TargetGetter, target);
+            if (!(std::invoke(SourceGetter, source) == value)) std::invoke(SourceSetter, source, value);
+        };
+        toTarget();
+        QObject::connect(source, sourceNotify, target, toTarget);
+        QObject::connect(target, targetNotify, source, toSource);
+    }
+};
+
+/**
+ * @brief BindingScope - 表达式绑定求值时的依赖收集器
+ *
+ * 表达式内经 get() 读取的属性自动登记为依赖（对象 + 属性的 notify 信号），
+ * 每次求值后按本次实际读取到的集合更新订阅，条件分支中的依赖随之增减。
+ */
+class BindingScope {
+public:
+    QVariant get(QObject* object, const char* property);
+    /** 已解析的属性：省去按名查找 */
+    QVariant get(QObject* object, const QMetaProperty& property);
+    template <typename T>
+    T get(QObject* object, const char* property) { return get(object, property).template value<T>(); }
+
+private:
+    friend class BindingEngine;
+    QVector<QPair<QObject*, int>> m_dependencies;   ///< (对象, notify 信号下标)
+};
+
+/**
+ * @brief BindingEngine - 合并更新的绑定引擎（QMLPlus::bind / bindExpression 的实现）
+ *
+ * - 依赖变化只把绑定标记为脏，不立即求值；同一轮事件循环内的多次变化
+ *   在下一轮统一求值一次，每个目标属性至多写入一次（值未变则不写）；
+ * - beginBatch() / endBatch() 可嵌套，批处理期间不调度求值，最外层结束时同步 flush()，
+ *   ViewModel::beginUpdate() / endUpdate() 即基于此；
+ * - 目标对象销毁时其绑定自动移除；依赖对象销毁时只移除订阅。
+ */
+class BindingEngine : public QObject {
+    Q_OBJECT
+public:
+    using Expression = std::function<QVariant(BindingScope&)>;
+
+    static BindingEngine& instance();
+
+    /** 创建表达式绑定并立即求值写入一次，返回绑定 id */
+    int bindExpression(QObject* target, const char* targetProp, Expression expression);
+    /** 单属性绑定：source.sourceProp → target.targetProp */
+    int bindProperty(QObject* target, const char* targetProp, QObject* source, const char* sourceProp);
+    void unbind(int id);
+
+    void beginBatch();
+    void endBatch();
+    bool isBatching() const { return m_batchDepth > 0; }
+
+    /** 立即求值所有脏绑定（通常由事件循环调度，无需手动调用） */
+    void flush();
+
+    int bindingCount() const { return m_bindings.size(); }
+    int pendingCount() const { return m_dirty.size(); }
+
+private slots:
+    void onDependencyChanged();
+    void onObjectDestroyed(QObject* object);
+
+private:
+    using Dependency = QPair<QObject*, int>;
+    struct Binding {
+        QObject* target = nullptr;
+        QMetaProperty property;
+        Expression expression;
+        QVector<Dependency> dependencies;
+        bool dirty = false;
+    };
+
+    explicit BindingEngine(QObject* parent);
+    void evaluate(int id);
+    void subscribe(int id, const Dependency& dependency);
+    void unsubscribe(int id, const Dependency& dependency);
+    void watchDestroyed(QObject* object);
+    void markDirty(int id);
+    void scheduleFlush();
+
+    static constexpr int kMaxFlushRounds = 16;   ///< 链式绑定逐轮稳定的上限，防止互相依赖的绑定振荡
+
+    QHash<int, std::shared_ptr<Binding>> m_bindings;
+    QHash<Dependency, QVector<int>> m_subscribers;        ///< 依赖 → 订阅它的绑定
+    QHash<Dependency, QMetaObject::Connection> m_connections;
+    QHash<QObject*, QVector<int>> m_targets;              ///< 目标对象 → 其上的绑定
+    QSet<QObject*> m_watched;                             ///< 已连接 destroyed 的对象
+    QVector<int> m_dirty;
+    int m_nextId = 1;
+    int m_batchDepth = 0;
+    bool m_flushScheduled = false;
+    int m_onChangedIndex = -1;
 };
 
 // =============================================================================
@@ -100,6 +283,21 @@ struct QMLState {
     QVector<PropertyChange> changes;
 };
 
+/**
+ * @brief QMLTransition - 状态切换时的属性过渡（对标 QML Transition）
+ *
+ * from / to 为状态名，"*" 匹配任意状态（空字符串为默认状态）；按添加顺序取第一个匹配项。
+ * 可插值类型：int / double / float、QColor、QPoint(F) / QSize(F) / QRect(F)；
+ * 其他类型在过渡结束时直接写入终值。
+ */
+struct QMLTransition {
+    QString from = QStringLiteral("*");
+    QString to = QStringLiteral("*");
+    int duration = ::Animation::Duration::Normal;
+    ::Animation::EasingType easing = ::Animation::EasingType::Standard;
+    QVector<QByteArray> properties;   ///< 参与过渡的属性名；为空表示全部可插值属性
+};
+
 // =============================================================================
 // 4. QMLPlus Mixin (自动发现宿主模式)
 // =============================================================================
@@ -110,25 +308,78 @@ public:
     virtual ~QMLPlus();
 
     // --- 核心能力 ---
+    /**
+     * 可写访问锚点：每次调用都视为可能修改，版本号递增；
+     * 所在 AnchorLayout 下次布局时按版本号判断是否需要重新同步，稳态布局无需比较或拷贝。
+     */
     AnchorLayout::Anchors* anchors();
-    
+    /** 只读访问锚点，不改变版本号 */
+    const AnchorLayout::Anchors& currentAnchors() const;
+    quint64 anchorsVersion() const { return m_anchorsVersion; }
+
+    /**
+     * 切换状态：未出现在新状态中的属性恢复为默认值（首次被任一状态修改前的值）；
+     * 空字符串为默认状态。匹配到 QMLTransition 时经 Animation::Scheduler 插值过渡。
+     */
     void setState(const QString& name);
     QString state() const { return m_currentState; }
+    /** 编译状态：属性名在此解析为 QMetaProperty，切换状态时不再按名查找；同名状态覆盖 */
     void addState(const QMLState& state);
+    void addTransition(const QMLTransition& transition);
 
     /**
      * @brief 属性绑定接口，自动将宿主 QWidget 作为 Target
+     *
+     * OneWay 经 BindingEngine 合并更新：建立时立即同步一次，之后源属性的多次变化
+     * 在下一轮事件循环只写入一次。TwoWay 仍为即时同步（PropertyBinder）。
      */
     void bind(const char* targetProp, QObject* source, const char* sourceProp, PropertyBinder::Direction dir = PropertyBinder::OneWay);
 
+    /**
+     * @brief 表达式绑定：expression 内经 BindingScope::get() 读取的属性自动成为依赖
+     *
+     *   label->bindExpression("text", [vm](BindingScope& s) {
+     *       return s.get<QString>(vm, "title") + " - " + s.get<QString>(vm, "text");
+     *   });
+     *
+     * @return 绑定 id，可用于 BindingEngine::unbind；宿主不是 QWidget 时返回 0
+     */
+    int bindExpression(const char* targetProp, BindingEngine::Expression expression);
+
 protected:
     void applyState(const QString& name);
 
 private:
     AnchorLayout::Anchors* m_anchors = nullptr;
+    quint64 m_anchorsVersion = 0;
+    /// 一个 (目标对象, 属性) 对；状态中的修改以下标引用，默认值按下标存放
+    struct StateSlot {
+        QPointer<QObject> target;
+        QMetaProperty property;           ///< 无效时为动态属性，按 dynamicName 读写
+        QByteArray dynamicName;
+        QVariant defaultValue;
+        bool hasDefault = false;
+        bool interpolatable = false;
+    };
+    struct CompiledChange {
+        int slot;
+        QVariant value;
+    };
+    struct CompiledState {
+        QString name;
+        QVector<CompiledChange> changes;
+    };
+
+    int slotFor(QObject* target, const QByteArray& propertyName);
+    const QMLTransition* findTransition(const QString& from, const QString& to) const;
+    void writeSlot(int slot, const QVariant& value, const QMLTransition* transition);
+
     QString m_currentState;
-    QMap<QString, QMLState> m_states;
-    QMap<QObject*, QMap<QByteArray, QVariant>> m_defaultValues;
+    QVector<StateSlot> m_stateSlots;
+    QVector<CompiledState> m_states;
+    QHash<QString, int> m_stateIndex;
+    QVector<QMLTransition> m_transitions;
+    QVector<int> m_overriddenSlots;   ///< 当前状态修改过的槽位（切换时据此恢复默认值）
 };
 
 } // namespace view
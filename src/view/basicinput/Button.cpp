@@ -4,12 +4,12 @@ namespace view::basicinput {
 
 Button::Button(const QString& text, QWidget* parent) : QPushButton(text, parent) {
     setAttribute(Qt::WA_Hover);
-    setFont(themeFont("Body").toQFont()); // 默认 Body，后续可用 setFont() 覆盖
+    setFont(themeQFont("Body")); // 默认 Body，后续可用 setFont() 覆盖
 }
 
 Button::Button(QWidget* parent) : QPushButton(parent) {
     setAttribute(Qt::WA_Hover);
-    setFont(themeFont("Body").toQFont());
+    setFont(themeQFont("Body"));
 }
 
 void Button::setFluentStyle(ButtonStyle style) {
@@ -82,12 +82,10 @@ void ComboBoxItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem&
     painter->save();
     painter->setRenderHint(QPainter::Antialiasing);
 
-    FluentElement::Colors colors{};
+    static const FluentElement::Colors kNoColors{};
+    const FluentElement::Colors& colors = m_themeHost ? m_themeHost->themeColors() : kNoColors;
     FluentElement::Radius radius{};
-    if (m_themeHost) {
-        colors = m_themeHost->themeColors();
-        radius = m_themeHost->themeRadius();
-    }
+    if (m_themeHost) radius = m_themeHost->themeRadius();
 
     int itemRightInset = 5;
     if (m_view && m_view->verticalScrollBar() &&
@@ -185,7 +183,7 @@ ComboBox::ComboBoxPopup::ComboBoxPopup(ComboBox* comboBox)
 
     m_delegate = new ComboBoxItemDelegate(comboBox, m_listView, this);
     m_listView->setItemDelegate(m_delegate);
-    m_listView->setFont(comboBox->themeFont(comboBox->fontRole()).toQFont());
+    m_listView->setFont(comboBox->themeQFont(comboBox->fontRole()));
 
     m_listView->setMouseTracking(true);
     m_listView->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
@@ -207,7 +205,7 @@ ComboBox::ComboBoxPopup::ComboBoxPopup(ComboBox* comboBox)
 
 void ComboBox::ComboBoxPopup::showForComboBox() {
     m_listView->setModel(m_comboBox->model());
-    m_listView->setFont(m_comboBox->themeFont(m_comboBox->fontRole()).toQFont());
+    m_listView->setFont(m_comboBox->themeQFont(m_comboBox->fontRole()));
 
     if (m_comboBox->currentIndex() >= 0) {
         m_listView->setSelectedIndex(m_comboBox->currentIndex());
@@ -254,7 +252,7 @@ void ComboBox::ComboBoxPopup::onThemeUpdated() {
     setPalette(pal);
 
     if (m_comboBox) {
-        m_listView->setFont(m_comboBox->themeFont(m_comboBox->fontRole()).toQFont());
+        m_listView->setFont(m_comboBox->themeQFont(m_comboBox->fontRole()));
     }
     if (m_listView && m_listView->viewport()) m_listView->viewport()->update();
 }
@@ -304,7 +302,7 @@ bool ComboBox::ComboBoxPopup::eventFilter(QObject* watched, QEvent* event) {
 
 ComboBox::ComboBox(QWidget* parent) : QComboBox(parent) {
     setAttribute(Qt::WA_Hover);
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
     setFixedHeight(::Spacing::ControlHeight::Standard);
 
     initAnimation();
@@ -324,7 +322,7 @@ void ComboBox::initAnimation() {
 void ComboBox::setFontRole(const QString& role) {
     if (m_fontRole == role) return;
     m_fontRole = role;
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
     updateGeometry();
     emit fontRoleChanged();
     update();
@@ -379,7 +377,7 @@ void ComboBox::setPressProgress(qreal p) {
 }
 
 void ComboBox::onThemeUpdated() {
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
     if (m_popup) {
         m_popup->onThemeUpdated();
     }
@@ -93,7 +93,7 @@ void RatingControl::setFontRole(const QString& role)
 {
     if (m_fontRole == role) return;
     m_fontRole = role;
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
     updateGeometry();
     update();
     emit fontRoleChanged();
@@ -232,7 +232,7 @@ void RatingControl::paintEvent(QPaintEvent* /*event*/)
 
     // 标题文字
     if (!m_caption.isEmpty()) {
-        QFont captionFont = themeFont(m_captionFontRole).toQFont();
+        QFont captionFont = themeQFont(m_captionFontRole);
         p.setFont(captionFont);
         p.setPen(isDisabled ? c.textDisabled : c.textSecondary);
         int captionX = starsAreaWidth() + m_itemSpacing * 2;
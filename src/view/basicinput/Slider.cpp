@@ -6,9 +6,9 @@
 #include <QStyleOptionSlider>
 #include <QStyle>
 #include <QMouseEvent>
-#include <QPropertyAnimation>
 #include <algorithm>
 
+#include "design/Animation.h"
 #include "design/Typography.h"
 
 namespace view::basicinput {
@@ -20,16 +20,23 @@ Slider::Slider(Qt::Orientation orientation, QWidget* parent)
     setAttribute(Qt::WA_Hover);
     
     // m_handleSize is initialized to 20 in header
+}
 
-    const auto& anim = themeAnimation();
+// hover / press 两条补间共用全局调度器，以 owner + key 区分
+namespace {
+enum : quintptr { HoverTween, PressTween };
+}
 
-    m_hoverAnim = new QPropertyAnimation(this, "hoverRatio");
-    m_hoverAnim->setDuration(anim.normal);
-    m_hoverAnim->setEasingCurve(anim.decelerate);
+void Slider::animateHover(qreal to) {
+    ::Animation::Scheduler::instance().animate(
+        this, HoverTween, m_hoverRatio, to, themeAnimation().normal,
+        ::Animation::EasingType::Decelerate, [this](qreal v) { m_hoverRatio = v; }, this);
+}
 
-    m_pressAnim = new QPropertyAnimation(this, "pressRatio");
-    m_pressAnim->setDuration(anim.normal);
-    m_pressAnim->setEasingCurve(anim.decelerate);
+void Slider::animatePress(qreal to) {
+    ::Animation::Scheduler::instance().animate(
+        this, PressTween, m_pressRatio, to, themeAnimation().normal,
+        ::Animation::EasingType::Decelerate, [this](qreal v) { m_pressRatio = v; }, this);
 }
 
 Slider::Slider(QWidget* parent)
@@ -72,17 +79,13 @@ void Slider::paintEvent(QPaintEvent*) {
 }
 
 void Slider::enterEvent(FluentEnterEvent* event) {
-    m_hoverAnim->stop();
-    m_hoverAnim->setEndValue(1.0);
-    m_hoverAnim->start();
+    animateHover(1.0);
     QSlider::enterEvent(event);
 }
 
 void Slider::leaveEvent(QEvent* event) {
     if (!m_isPressed) { // Only fade out if not currently dragging
-        m_hoverAnim->stop();
-        m_hoverAnim->setEndValue(0.0);
-        m_hoverAnim->start();
+        animateHover(0.0);
     }
     QSlider::leaveEvent(event);
 }
@@ -97,9 +100,7 @@ void Slider::mousePressEvent(QMouseEvent *event) {
     setSliderDown(true);
     
     // Animate Press
-    m_pressAnim->stop();
-    m_pressAnim->setEndValue(1.0);
-    m_pressAnim->start();
+    animatePress(1.0);
 
     // Show ToolTip
     showToolTip();
@@ -136,15 +137,11 @@ void Slider::mouseReleaseEvent(QMouseEvent *event) {
     setSliderDown(false);
     
     // Animate Release
-    m_pressAnim->stop();
-    m_pressAnim->setEndValue(0.0);
-    m_pressAnim->start();
+    animatePress(0.0);
 
     // Reset Hover if mouse left during drag
     if (!rect().contains(mapFromGlobal(QCursor::pos()))) {
-        m_hoverAnim->stop();
-        m_hoverAnim->setEndValue(0.0);
-        m_hoverAnim->start();
+        animateHover(0.0);
     }
 
     hideToolTip();
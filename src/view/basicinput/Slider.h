@@ -2,7 +2,6 @@
 #define SLIDER_H
 
 #include <QSlider>
-#include <QPropertyAnimation>
 #include "view/FluentElement.h"
 #include "view/QMLPlus.h"
 #include "design/Spacing.h"
@@ -70,6 +69,8 @@ private:
     void showToolTip();
     void updateToolTipPos();
     void hideToolTip();
+    void animateHover(qreal to);
+    void animatePress(qreal to);
 
     int m_handleSize = 20; // WinUI 3 Standard Thumb (5 * BaseUnit)
     int m_trackHeight = ::Spacing::XSmall; // 默认 4px
@@ -80,8 +81,6 @@ private:
     // 动画状态
     qreal m_hoverRatio = 0.0;
     qreal m_pressRatio = 0.0;
-    QPropertyAnimation* m_hoverAnim = nullptr;
-    QPropertyAnimation* m_pressAnim = nullptr;
 
     view::status_info::ToolTip* m_toolTip = nullptr;
 };
@@ -3,7 +3,7 @@
 #include <QPainterPath>
 #include <QMouseEvent>
 #include <QKeyEvent>
-#include <QPropertyAnimation>
+#include "design/Animation.h"
 #include "design/Typography.h"
 #include "design/Spacing.h"
 
@@ -32,10 +32,6 @@ ToggleSwitch::ToggleSwitch(QWidget* parent)
 
     auto fs = themeFont(m_fontRole);
     setFont(fs.toQFont());
-
-    m_knobAnimation = new QPropertyAnimation(this, "knobPosition");
-    m_knobAnimation->setDuration(themeAnimation().fast);
-    m_knobAnimation->setEasingCurve(themeAnimation().decelerate);
 }
 
 void ToggleSwitch::onThemeUpdated()
@@ -171,12 +167,18 @@ QSize ToggleSwitch::minimumSizeHint() const
 
 // ── 动画 ─────────────────────────────────────────────────────────────────────
 
+// 滑块补间挂在全局调度器上，以 owner + key 区分
+namespace {
+enum : quintptr { KnobTween };
+}
+
 void ToggleSwitch::animateKnob(bool toOn)
 {
-    m_knobAnimation->stop();
-    m_knobAnimation->setStartValue(m_knobPosition);
-    m_knobAnimation->setEndValue(toOn ? 1.0 : 0.0);
-    m_knobAnimation->start();
+    // 共享调度器逐帧写入 m_knobPosition，重绘由调度器统一提交
+    ::Animation::Scheduler::instance().animate(
+        this, KnobTween, m_knobPosition, toOn ? 1.0 : 0.0, themeAnimation().fast,
+        ::Animation::EasingType::Decelerate,
+        [this](qreal v) { m_knobPosition = v; }, this);
 }
 
 void ToggleSwitch::toggle()
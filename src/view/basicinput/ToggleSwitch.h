@@ -5,7 +5,6 @@
 #include "view/FluentElement.h"
 #include "view/QMLPlus.h"
 
-class QPropertyAnimation;
 
 namespace view::basicinput {
 
@@ -83,8 +82,6 @@ private:
     qreal m_knobPosition = 0.0;  // 0.0 = Off, 1.0 = On
     bool m_isHovered = false;
     bool m_isPressed = false;
-
-    QPropertyAnimation* m_knobAnimation = nullptr;
 };
 
 } // namespace view::basicinput
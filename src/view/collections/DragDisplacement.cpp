@@ -0,0 +1,96 @@
+#include "DragDisplacement.h"
+
+#include <QtMath>
+
+#include "design/Animation.h"
+
+namespace view::collections {
+
+namespace {
+bool samePoint(const QPointF& a, const QPointF& b) {
+    return qAbs(a.x() - b.x()) < 0.01 && qAbs(a.y() - b.y()) < 0.01;
+}
+} // namespace
+
+DragDisplacement::DragDisplacement(QObject* parent)
+    : QAbstractAnimation(parent)
+    , m_durationMs(::Animation::Duration::Fast)
+    , m_easing(::Animation::getEasing(::Animation::EasingType::Decelerate)) {}
+
+void DragDisplacement::setRange(int first, int last) {
+    if (last < first) {
+        clear();
+        return;
+    }
+    if (!m_slots.isEmpty() && first == m_first && last == this->last()) return;
+
+    QVector<Slot> next(last - first + 1);
+    m_animating = 0;
+    for (int row = qMax(first, m_first); row <= qMin(last, this->last()); ++row) {
+        const Slot& old = m_slots.at(row - m_first);
+        next[row - first] = old;
+        if (old.animating) ++m_animating;
+    }
+    m_slots = std::move(next);
+    m_first = first;
+    if (m_animating == 0) stop();
+}
+
+void DragDisplacement::setTarget(int row, const QPointF& target) {
+    const int i = row - m_first;
+    if (i < 0 || i >= m_slots.size()) return;
+
+    Slot& s = m_slots[i];
+    if (s.fresh) {
+        s.fresh = false;
+        s.from = s.to = s.value = target;
+        return;
+    }
+    if (samePoint(s.to, target)) return;
+
+    if (samePoint(s.value, target)) {
+        // Already there (e.g. reversed before the tween moved): settle without a tween
+        if (s.animating) --m_animating;
+        s.from = s.to = s.value = target;
+        s.animating = false;
+        return;
+    }
+
+    if (state() != Running) start();
+    s.from = s.value;
+    s.to = target;
+    s.startTime = currentTime();
+    if (!s.animating) {
+        s.animating = true;
+        ++m_animating;
+    }
+}
+
+void DragDisplacement::clear() {
+    stop();
+    m_slots.clear();
+    m_first = 0;
+    m_animating = 0;
+}
+
+void DragDisplacement::updateCurrentTime(int currentTime) {
+    if (m_animating == 0) {
+        stop();
+        return;
+    }
+    for (Slot& s : m_slots) {
+        if (!s.animating) continue;
+        const qreal t = qBound(0.0, qreal(currentTime - s.startTime) / m_durationMs, 1.0);
+        const qreal p = m_easing.valueForProgress(t);
+        s.value = s.from + (s.to - s.from) * p;
+        if (t >= 1.0) {
+            s.value = s.to;
+            s.animating = false;
+            --m_animating;
+        }
+    }
+    emit offsetsChanged();
+    if (m_animating == 0) stop();
+}
+
+} // namespace view::collections
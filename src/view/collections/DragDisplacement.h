@@ -0,0 +1,71 @@
+#ifndef DRAGDISPLACEMENT_H
+#define DRAGDISPLACEMENT_H
+
+#include <QAbstractAnimation>
+#include <QEasingCurve>
+#include <QPointF>
+#include <QVector>
+
+namespace view::collections {
+
+/**
+ * @brief DragDisplacement - 拖拽换位时的行 / 格位移引擎（ListView / GridView 共用）
+ *
+ * 只跟踪一个连续的行区间 [first, last]（视口可见范围 + 边距），位移存放在按
+ * (row - first) 索引的平坦数组中；区间外的行位移恒为 0。所有正在补间的行由自身
+ * 这一个动画时钟（Qt 统一动画定时器）驱动，每帧只发出一次 offsetsChanged()，
+ * 开销与可见行数成正比，与 model 大小无关。
+ */
+class DragDisplacement : public QAbstractAnimation {
+    Q_OBJECT
+
+public:
+    explicit DragDisplacement(QObject* parent = nullptr);
+
+    int duration() const override { return -1; }
+
+    /**
+     * 设置参与位移的行区间。与旧区间重叠的行保留当前位移与补间；
+     * 新进入区间的行在第一次 setTarget 时直接跳到目标（它们此前在视口外）。
+     */
+    void setRange(int first, int last);
+    int first() const { return m_first; }
+    int last() const { return m_first + int(m_slots.size()) - 1; }
+    bool isEmpty() const { return m_slots.isEmpty(); }
+
+    /** 设置行的目标位移；目标变化时从当前值开始补间 */
+    void setTarget(int row, const QPointF& target);
+    QPointF offset(int row) const {
+        const int i = row - m_first;
+        return i >= 0 && i < m_slots.size() ? m_slots.at(i).value : QPointF();
+    }
+
+    /** 停止补间并清空区间 */
+    void clear();
+
+signals:
+    void offsetsChanged();
+
+protected:
+    void updateCurrentTime(int currentTime) override;
+
+private:
+    struct Slot {
+        QPointF from;
+        QPointF to;
+        QPointF value;
+        int  startTime = 0;
+        bool animating = false;
+        bool fresh = true;     // 尚未设置过目标
+    };
+
+    QVector<Slot> m_slots;
+    int m_first = 0;
+    int m_animating = 0;
+    int m_durationMs;
+    QEasingCurve m_easing;
+};
+
+} // namespace view::collections
+
+#endif // DRAGDISPLACEMENT_H
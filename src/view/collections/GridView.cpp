@@ -7,6 +7,7 @@
 #include <QAbstractItemModel>
 #include <QAbstractItemView>
 #include <QApplication>
+#include <QCursor>
 #include <QLabel>
 #include <QMouseEvent>
 #include <QPainter>
@@ -24,6 +25,9 @@
 #include "design/CornerRadius.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
+#include "view/collections/DragDisplacement.h"
+#include "view/collections/IncrementalLoading.h"
+#include "view/collections/ItemPaintCache.h"
 #include "view/scrolling/ScrollBar.h"
 
 namespace view::collections {
@@ -34,6 +38,7 @@ GridView::GridView(QWidget* parent)
     m_fontRole = Typography::FontRole::Body;
 
     // --- QListView IconMode + Wrapping = GridView ---
+    // Kept for API compatibility; item geometry comes from the fixed-cell layout below
     setViewMode(QListView::IconMode);
     setWrapping(true);
     setResizeMode(QListView::Adjust);
@@ -56,6 +61,12 @@ GridView::GridView(QWidget* parent)
         emit itemClicked(idx.row());
     });
 
+    m_displacement = new DragDisplacement(this);
+    connect(m_displacement, &DragDisplacement::offsetsChanged, this, [this]() { viewport()->update(); });
+
+    m_loading = new IncrementalLoading(this);
+    connect(m_loading, &IncrementalLoading::rangeChanged, this, &GridView::visibleRangeChanged);
+
     // --- Header label ---
     m_headerLabel = new QLabel(this);
     m_headerLabel->hide();
@@ -178,10 +189,47 @@ void GridView::setMaxColumns(int maxCols) {
     emit maxColumnsChanged();
 }
 
+bool GridView::incrementalLoading() const {
+    return m_loading->isEnabled();
+}
+
+void GridView::setIncrementalLoading(bool enabled) {
+    if (m_loading->isEnabled() == enabled) return;
+    m_loading->setEnabled(enabled);
+    viewport()->update();
+    emit incrementalLoadingChanged();
+}
+
+int GridView::prefetchDistance() const {
+    return m_loading->prefetchDistance();
+}
+
+void GridView::setPrefetchDistance(int items) {
+    if (m_loading->prefetchDistance() == qMax(0, items)) return;
+    m_loading->setPrefetchDistance(items);
+    emit prefetchDistanceChanged();
+}
+
+void GridView::setPaintCacheEnabled(bool enabled) {
+    if (ItemPaintCache::install(m_paintCache, enabled, m_paintCacheBudget, this)) emit paintCacheEnabledChanged();
+}
+
+void GridView::setPaintCacheBudget(int kilobytes) {
+    if (ItemPaintCache::applyBudget(m_paintCache, m_paintCacheBudget, kilobytes)) emit paintCacheBudgetChanged();
+}
+
+void GridView::setModel(QAbstractItemModel* model) {
+    QListView::setModel(model);
+    m_loading->refresh();
+}
+
 void GridView::updateGridSize() {
-    // gridSize 包含 cell + spacing (QListView 用 gridSize 来布局 IconMode 的每格)
+    // gridSize 包含 cell + spacing（保留 QListView 属性供外部读取；布局见 cellRect）
     setGridSize(QSize(m_cellSize.width() + m_hSpacing,
                       m_cellSize.height() + m_vSpacing));
+    updateGeometries();
+    viewport()->update();
+    m_loading->refresh();
 }
 
 // ── Selection API ─────────────────────────────────────────────────────────────
@@ -233,16 +281,23 @@ void GridView::paintEvent(QPaintEvent* event) {
         QPainter ph(viewport());
         ph.setRenderHint(QPainter::Antialiasing);
         ph.setPen(c.textTertiary);
-        ph.setFont(themeFont(m_fontRole).toQFont());
+        ph.setFont(themeQFont(m_fontRole));
         ph.drawText(viewport()->rect(), Qt::AlignCenter, m_placeholderText);
         ph.end();
     }
 
-    // --- 3. 绘制网格项（QListView 默认绘制，拖拽时应用位移偏移） ---
-    m_paintingWithOffsets = !m_dragOffsets.isEmpty();
-    QListView::paintEvent(event);
+    // --- 3. 绘制网格项（只绘制与重绘区域相交的 cell，拖拽时应用位移偏移） ---
+    m_paintingWithOffsets = !m_displacement->isEmpty();
+    paintCells(event);
     m_paintingWithOffsets = false;
 
+    // 加载中 cell 的骨架占位（增量加载）
+    if (m_loading->isEnabled()) {
+        QPainter lp(viewport());
+        m_loading->paintPlaceholders(&lp, c);
+        lp.end();
+    }
+
     // --- 3.1 拖拽源项半透明遮罩 ---
     if (m_isDragging && !m_dragSourceIndices.isEmpty() && model()) {
         QPainter ghost(viewport());
@@ -251,7 +306,7 @@ void GridView::paintEvent(QPaintEvent* event) {
         overlay.setAlphaF(0.7f);
         for (int srcIdx : m_dragSourceIndices) {
             if (srcIdx >= 0 && srcIdx < model()->rowCount()) {
-                QRect srcRect = QListView::visualRect(model()->index(srcIdx, 0));
+                QRect srcRect = itemRect(model()->index(srcIdx, 0, rootIndex()));
                 if (!srcRect.isEmpty())
                     ghost.fillRect(srcRect, overlay);
             }
@@ -261,24 +316,20 @@ void GridView::paintEvent(QPaintEvent* event) {
 
     // --- 3.2 拖拽指示线 ---
     if (m_isDragging && m_dropTargetIndex >= 0 && model()) {
-        m_paintingWithOffsets = !m_dragOffsets.isEmpty();
+        m_paintingWithOffsets = !m_displacement->isEmpty();
         QPainter dp(viewport());
         dp.setRenderHint(QPainter::Antialiasing);
 
         // m_dropTargetIndex is a slot among non-source items.
         // Find the visual rect of the item at that slot (or after last).
-        const QSet<int> srcSet(m_dragSourceIndices.begin(), m_dragSourceIndices.end());
-        QList<int> remaining;
-        for (int i = 0; i < model()->rowCount(); ++i)
-            if (!srcSet.contains(i)) remaining.append(i);
-
+        const int remainingCount = model()->rowCount() - int(m_dragSourceIndices.size());
         QRect targetRect;
-        if (m_dropTargetIndex < remaining.size()) {
-            int modelIdx = remaining[m_dropTargetIndex];
+        if (m_dropTargetIndex < remainingCount) {
+            int modelIdx = nonSourceIndexForSlot(m_dropTargetIndex);
             targetRect = visualRect(model()->index(modelIdx, 0));
-        } else if (!remaining.isEmpty()) {
+        } else if (remainingCount > 0) {
             // Drop at end: draw after the last remaining item
-            int lastIdx = remaining.last();
+            int lastIdx = nonSourceIndexForSlot(remainingCount - 1);
             targetRect = visualRect(model()->index(lastIdx, 0));
             targetRect.moveLeft(targetRect.right() + m_hSpacing);
         }
@@ -351,9 +402,11 @@ void GridView::paintEvent(QPaintEvent* event) {
 // ── Layout ────────────────────────────────────────────────────────────────────
 
 void GridView::resizeEvent(QResizeEvent* event) {
-    QListView::resizeEvent(event);
+    // Skip QListView's delayed IconMode relayout: columns follow the viewport width directly
+    QAbstractItemView::resizeEvent(event);
     syncFluentScrollBar();
     layoutHeader();
+    m_loading->refresh();
 }
 
 void GridView::showEvent(QShowEvent* event) {
@@ -460,13 +513,25 @@ void GridView::wheelEvent(QWheelEvent* event) {
 }
 
 int GridView::verticalOffset() const {
-    return QListView::verticalOffset() - qRound(m_overscrollY);
+    return verticalScrollBar()->value() - qRound(m_overscrollY);
+}
+
+int GridView::horizontalOffset() const {
+    return horizontalScrollBar()->value();
+}
+
+void GridView::scrollContentsBy(int dx, int dy) {
+    QListView::scrollContentsBy(dx, dy);
+    // Items scrolled into view during a drag need their displacement too
+    if (m_isDragging && dy != 0)
+        updateDragDisplacement();
+    m_loading->refresh();
 }
 
 QRect GridView::visualRect(const QModelIndex& index) const {
-    QRect r = QListView::visualRect(index);
+    QRect r = itemRect(index);
     if (m_paintingWithOffsets && index.isValid()) {
-        const QPointF off = m_dragOffsets.value(index.row(), QPointF(0.0, 0.0));
+        const QPointF off = m_displacement->offset(index.row());
         r.translate(qRound(off.x()), qRound(off.y()));
     }
     return r;
@@ -488,6 +553,268 @@ void GridView::setViewportHovered(bool hovered) {
     emit viewportHoveredChanged();
 }
 
+// ── Fixed-cell grid layout ────────────────────────────────────────────────────
+// QListView IconMode keeps a geometry record per item and re-lays out all of them on
+// every resize or column change. Every GridView cell has the same size, so geometry is
+// computed on demand instead:
+//   stride = cellSize + spacing,  cols = min(viewportWidth / stride.width, maxColumns)
+//   rect(i) = (i % cols * stride.w + hSpacing / 2, i / cols * stride.h + vSpacing / 2, cellSize)
+// Layout is O(1), visualRect / indexAt are O(1), and painting only visits the grid rows
+// inside the exposed rect.
+
+int GridView::itemCount() const {
+    const QAbstractItemModel* m = model();
+    return m ? m->rowCount(rootIndex()) : 0;
+}
+
+QSize GridView::cellStride() const {
+    return QSize(qMax(1, m_cellSize.width() + m_hSpacing),
+                 qMax(1, m_cellSize.height() + m_vSpacing));
+}
+
+QRect GridView::cellRect(int row) const {
+    if (row < 0 || row >= itemCount()) return {};
+    const QSize stride = cellStride();
+    const int cols = gridColumns();
+    return QRect((row % cols) * stride.width() + m_hSpacing / 2,
+                 (row / cols) * stride.height() + m_vSpacing / 2,
+                 m_cellSize.width(), m_cellSize.height());
+}
+
+int GridView::contentHeight() const {
+    const int count = itemCount();
+    if (count == 0) return 0;
+    const int cols = gridColumns();
+    return (count + cols - 1) / cols * cellStride().height();
+}
+
+/**
+ * Item at a content position. With exact=false the nearest cell is returned (clamped
+ * to the grid, spacing resolves to the cell before it, the empty tail of the last grid
+ * row to the last item) — used for range selection and painting.
+ */
+int GridView::cellAt(const QPoint& contentPos, bool exact) const {
+    const int count = itemCount();
+    if (count == 0) return -1;
+
+    const QSize stride = cellStride();
+    const int cols = gridColumns();
+    const int x = contentPos.x() - m_hSpacing / 2;
+    const int y = contentPos.y() - m_vSpacing / 2;
+    if (exact) {
+        if (x < 0 || y < 0) return -1;
+        const int col = x / stride.width();
+        if (col >= cols) return -1;
+        if (x % stride.width() >= m_cellSize.width() || y % stride.height() >= m_cellSize.height())
+            return -1;   // spacing gap between cells
+        const qint64 row = qint64(y / stride.height()) * cols + col;
+        return row < count ? int(row) : -1;
+    }
+    const int rows = (count + cols - 1) / cols;
+    const int col = qBound(0, x < 0 ? 0 : x / stride.width(), cols - 1);
+    const int gridRow = qBound(0, y < 0 ? 0 : y / stride.height(), rows - 1);
+    return qMin(gridRow * cols + col, count - 1);
+}
+
+QRect GridView::itemRect(const QModelIndex& index) const {
+    if (!index.isValid() || index.parent() != rootIndex() || index.column() != 0)
+        return {};
+    return cellRect(index.row()).translated(-horizontalOffset(), -verticalOffset());
+}
+
+void GridView::paintCells(QPaintEvent* event) {
+    QAbstractItemDelegate* del = itemDelegate();
+    const int count = itemCount();
+    if (count == 0 || !del) return;
+
+    // Whole grid rows intersecting the exposed area
+    const QRect area = event->rect();
+    const int offset = verticalOffset();
+    const int cols = gridColumns();
+    int first = cellAt(QPoint(0, area.top() + offset), false) / cols * cols;
+    int last = qMin(count - 1, cellAt(QPoint(0, area.bottom() + offset), false) / cols * cols + cols - 1);
+    if (m_paintingWithOffsets) {
+        // Displaced cells can slide in from outside the exposed rows
+        int dragFirst = 0, dragLast = -1;
+        dragItemWindow(&dragFirst, &dragLast);
+        first = qMin(first, dragFirst);
+        last = qMax(last, dragLast);
+    }
+
+    QStyleOptionViewItem opt;
+    FLUENT_INIT_VIEW_ITEM_OPTION(&opt);
+    const QStyle::State baseState = opt.state;
+
+    const QModelIndex current = currentIndex();
+    const bool showFocus = hasFocus() && current.isValid();
+    const QModelIndex hover = viewport()->underMouse()
+        ? indexAt(viewport()->mapFromGlobal(QCursor::pos())) : QModelIndex();
+    const QItemSelectionModel* sel = selectionModel();
+
+    QPainter painter(viewport());
+    for (int row = first; row <= last; ++row) {
+        const QModelIndex idx = model()->index(row, 0, rootIndex());
+        opt.rect = visualRect(idx);
+        if (!opt.rect.intersects(area)) continue;
+        opt.state = baseState;
+        if (sel && sel->isSelected(idx)) opt.state |= QStyle::State_Selected;
+        if (idx == hover) opt.state |= QStyle::State_MouseOver;
+        if (showFocus && idx == current) opt.state |= QStyle::State_HasFocus;
+        del->paint(&painter, opt, idx);
+    }
+}
+
+QModelIndex GridView::indexAt(const QPoint& point) const {
+    const int row = cellAt(point + QPoint(horizontalOffset(), verticalOffset()), true);
+    return row < 0 ? QModelIndex() : model()->index(row, 0, rootIndex());
+}
+
+void GridView::doItemsLayout() {
+    // Skip QListView's per-item IconMode layout; geometry comes from cellRect()
+    QAbstractItemView::doItemsLayout();
+}
+
+void GridView::updateGeometries() {
+    QAbstractItemView::updateGeometries();
+
+    const int vh = viewport()->height();
+    auto* vsb = verticalScrollBar();
+    vsb->setSingleStep(cellStride().height());
+    vsb->setPageStep(vh);
+    vsb->setRange(0, qMax(0, contentHeight() - vh));
+    horizontalScrollBar()->setRange(0, 0);
+}
+
+void GridView::scrollTo(const QModelIndex& index, ScrollHint hint) {
+    if (!index.isValid() || index.parent() != rootIndex()) return;
+
+    // The whole grid row band, including its share of the vertical spacing
+    const QRect cell = cellRect(index.row());
+    if (cell.isNull()) return;
+    const QRect r = cell.adjusted(0, -(m_vSpacing / 2), 0, m_vSpacing - m_vSpacing / 2);
+
+    auto* vsb = verticalScrollBar();
+    const int vh = viewport()->height();
+    const int current = vsb->value();
+    int value = current;
+    switch (hint) {
+    case EnsureVisible:
+        if (r.top() < current || r.height() > vh)
+            value = r.top();
+        else if (r.bottom() >= current + vh)
+            value = r.bottom() - vh + 1;
+        break;
+    case PositionAtTop:
+        value = r.top();
+        break;
+    case PositionAtBottom:
+        value = r.bottom() - vh + 1;
+        break;
+    case PositionAtCenter:
+        value = r.center().y() - vh / 2;
+        break;
+    }
+    vsb->setValue(value);
+}
+
+QModelIndex GridView::moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers) {
+    Q_UNUSED(modifiers)
+    const int count = itemCount();
+    if (count == 0) return {};
+
+    const QModelIndex current = currentIndex();
+    if (!current.isValid() || current.parent() != rootIndex())
+        return model()->index(0, 0, rootIndex());
+
+    const int row = current.row();
+    const int cols = gridColumns();
+    const int lastGridRow = (count - 1) / cols;
+    const int pageRows = qMax(1, viewport()->height() / cellStride().height());
+    // Same column `rows` grid rows down, clamped to the last grid row that has that column
+    auto below = [&](int rows) {
+        const int col = row % cols;
+        int gridRow = qMin(row / cols + rows, lastGridRow);
+        if (gridRow * cols + col >= count) --gridRow;
+        return qMax(row, gridRow * cols + col);
+    };
+
+    int target = row;
+    switch (cursorAction) {
+    case MoveLeft:
+    case MovePrevious:
+        target = row - 1;
+        break;
+    case MoveRight:
+    case MoveNext:
+        target = row + 1;
+        break;
+    case MoveUp:
+        target = row >= cols ? row - cols : row;
+        break;
+    case MoveDown:
+        // The last grid row may be shorter: fall back to its last item
+        target = row / cols < lastGridRow ? qMin(row + cols, count - 1) : row;
+        break;
+    case MovePageUp:
+        target = qMax(row % cols, row - pageRows * cols);
+        break;
+    case MovePageDown:
+        target = below(pageRows);
+        break;
+    case MoveHome:
+        target = 0;
+        break;
+    case MoveEnd:
+        target = count - 1;
+        break;
+    }
+    return model()->index(qBound(0, target, count - 1), 0, rootIndex());
+}
+
+void GridView::setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) {
+    if (!selectionModel()) return;
+
+    const int count = itemCount();
+    const QPoint offset(horizontalOffset(), verticalOffset());
+    QItemSelection selection;
+    if (count > 0) {
+        // No rubber band (mouseMoveEvent never reaches QListView), so this is only click,
+        // shift-click and shift+arrow: QAbstractItemView passes the anchor and the target
+        // as the (unnormalized) corners; select the run of items between them
+        const int from = cellAt(rect.topLeft() + offset, true);
+        const int to = cellAt(rect.bottomRight() + offset, true);
+        if (from >= 0 && to >= 0)
+            selection.select(model()->index(qMin(from, to), 0, rootIndex()),
+                             model()->index(qMax(from, to), 0, rootIndex()));
+    }
+    selectionModel()->select(selection, command);
+}
+
+QRegion GridView::visualRegionForSelection(const QItemSelection& selection) const {
+    // At most three rects per selected range (partial first row, full middle rows,
+    // partial last row), clipped to the viewport — no per-item iteration
+    const QRect viewportRect = viewport()->rect();
+    const int cols = gridColumns();
+    const int rowLeft = m_hSpacing / 2 - horizontalOffset();
+    const int rowRight = rowLeft + (cols - 1) * cellStride().width() + m_cellSize.width() - 1;
+    QRegion region;
+    for (const QItemSelectionRange& range : selection) {
+        if (!range.isValid() || range.parent() != rootIndex() || range.left() > 0) continue;
+        const QRect top = itemRect(model()->index(range.top(), 0, rootIndex()));
+        const QRect bottom = itemRect(model()->index(range.bottom(), 0, rootIndex()));
+        if (top.isNull() || bottom.isNull()) continue;
+        if (top.top() == bottom.top()) {
+            region += QRect(top.topLeft(), bottom.bottomRight()) & viewportRect;
+            continue;
+        }
+        region += QRect(QPoint(top.left(), top.top()), QPoint(rowRight, top.bottom())) & viewportRect;
+        if (bottom.top() > top.bottom() + 1)
+            region += QRect(QPoint(rowLeft, top.bottom() + 1), QPoint(rowRight, bottom.top() - 1)) & viewportRect;
+        region += QRect(QPoint(rowLeft, bottom.top()), QPoint(bottom.right(), bottom.bottom())) & viewportRect;
+    }
+    return region;
+}
+
 // ── Theme ─────────────────────────────────────────────────────────────────────
 
 void GridView::onThemeUpdated() {
@@ -496,6 +823,7 @@ void GridView::onThemeUpdated() {
 
 void GridView::applyThemeStyle() {
     const auto& c = themeColors();
+    ItemPaintCache::invalidateStyle(m_paintCache);
 
     QPalette pal = palette();
     pal.setColor(QPalette::Base, Qt::transparent);
@@ -505,7 +833,7 @@ void GridView::applyThemeStyle() {
     pal.setColor(QPalette::HighlightedText, c.textPrimary);
     setPalette(pal);
 
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
 
     if (viewport()) {
         viewport()->setAutoFillBackground(false);
@@ -516,7 +844,7 @@ void GridView::applyThemeStyle() {
     }
 
     if (m_headerLabel) {
-        m_headerLabel->setFont(themeFont(Typography::FontRole::Subtitle).toQFont());
+        m_headerLabel->setFont(themeQFont(Typography::FontRole::Subtitle));
         QPalette hpal = m_headerLabel->palette();
         hpal.setColor(QPalette::WindowText, c.textPrimary);
         m_headerLabel->setPalette(hpal);
@@ -740,8 +1068,8 @@ QPixmap GridView::renderItemPixmap(int row) const {
     if (!model() || row < 0 || row >= model()->rowCount())
         return {};
 
-    QModelIndex idx = model()->index(row, 0);
-    QRect rect = QListView::visualRect(idx);
+    QModelIndex idx = model()->index(row, 0, rootIndex());
+    QRect rect = itemRect(idx);
     if (rect.isEmpty()) return {};
 
     const qreal dpr = devicePixelRatioF();
@@ -837,17 +1165,22 @@ QPixmap GridView::renderDragPixmap() const {
 int GridView::dropIndicatorIndex(const QPoint& pos) const {
     if (!model()) return 0;
 
-    const QSet<int> srcSet(m_dragSourceIndices.begin(), m_dragSourceIndices.end());
-    const int count = model()->rowCount();
+    // Only items in the displacement window can be nearest to the cursor. A non-source
+    // item's slot is its row minus the number of (sorted) source rows before it.
+    int first = 0, last = -1;
+    dragItemWindow(&first, &last);
+    const auto& srcs = m_dragSourceIndices;
 
-    int slot = 0;
     int bestSlot = 0;
     qreal bestDist = std::numeric_limits<qreal>::max();
 
-    for (int i = 0; i < count; ++i) {
-        if (srcSet.contains(i)) continue;
-        QRect r = QListView::visualRect(model()->index(i, 0));
-        QPointF off = m_dragOffsets.value(i, QPointF(0, 0));
+    for (int i = first; i <= last; ++i) {
+        const auto it = std::lower_bound(srcs.cbegin(), srcs.cend(), i);
+        if (it != srcs.cend() && *it == i) continue;
+        const int slot = i - int(it - srcs.cbegin());
+
+        QRect r = itemRect(model()->index(i, 0, rootIndex()));
+        const QPointF off = m_displacement->offset(i);
         r.translate(qRound(off.x()), qRound(off.y()));
 
         // Distance to left edge (insert before this item)
@@ -863,12 +1196,41 @@ int GridView::dropIndicatorIndex(const QPoint& pos) const {
             bestDist = distR;
             bestSlot = slot + 1;
         }
-
-        slot++;
     }
     return bestSlot;
 }
 
+int GridView::nonSourceIndexForSlot(int slot) const {
+    int index = slot;
+    for (int src : m_dragSourceIndices) {
+        if (src <= index) ++index;
+        else break;
+    }
+    return index;
+}
+
+int GridView::gridColumns() const {
+    int cols = viewport()->width() / cellStride().width();
+    if (cols < 1) cols = 1;
+    if (m_maxColumns > 0 && cols > m_maxColumns) cols = m_maxColumns;
+    return cols;
+}
+
+void GridView::dragItemWindow(int* first, int* last) const {
+    const int count = model() ? model()->rowCount() : 0;
+    const int cols = gridColumns();
+    const int cellH = cellStride().height();
+    const int offset = qMax(0, verticalScrollBar()->value());
+    const int topRow = offset / cellH;
+    const int bottomRow = (offset + viewport()->height()) / cellH;
+
+    // An item moves by at most dragCount slots, so that many items (plus one grid
+    // row of slack) beyond each visible edge can slide into view.
+    const int margin = int(m_dragSourceIndices.size()) + cols;
+    *first = qMax(0, topRow * cols - margin);
+    *last = qMin(count - 1, (bottomRow + 1) * cols - 1 + margin);
+}
+
 void GridView::updateDragDisplacement() {
     if (m_dragSourceIndices.isEmpty() || m_dropTargetIndex < 0 || !model()) {
         clearDragAnimations();
@@ -876,17 +1238,12 @@ void GridView::updateDragDisplacement() {
     }
 
     const int itemCount = model()->rowCount();
-    const int dragCount = m_dragSourceIndices.size();
-    const QSet<int> srcSet(m_dragSourceIndices.begin(), m_dragSourceIndices.end());
+    const auto& srcs = m_dragSourceIndices;   // sorted ascending
+    const int dragCount = srcs.size();
 
     // Grid cell size including spacing
     const QSize cell(m_cellSize.width() + m_hSpacing, m_cellSize.height() + m_vSpacing);
-
-    // Calculate columns from viewport width
-    const int vpW = viewport()->width();
-    int cols = vpW / cell.width();
-    if (cols < 1) cols = 1;
-    if (m_maxColumns > 0 && cols > m_maxColumns) cols = m_maxColumns;
+    const int cols = gridColumns();
 
     // Helper: compute grid position for a given flat index
     auto gridPos = [&](int idx) -> QPointF {
@@ -895,77 +1252,31 @@ void GridView::updateDragDisplacement() {
         return QPointF(col * cell.width(), row * cell.height());
     };
 
-    // Build ordered list of non-source indices
-    QList<int> remaining;
-    remaining.reserve(itemCount - dragCount);
-    for (int i = 0; i < itemCount; ++i) {
-        if (!srcSet.contains(i)) remaining.append(i);
-    }
+    const int dst = qBound(0, m_dropTargetIndex, itemCount - dragCount);
 
-    const int dst = qBound(0, m_dropTargetIndex, remaining.size());
+    int first = 0, last = -1;
+    dragItemWindow(&first, &last);
+    m_displacement->setRange(first, last);
 
-    for (int i = 0; i < itemCount; ++i) {
+    for (int i = first; i <= last; ++i) {
         QPointF target(0.0, 0.0);
-        if (srcSet.contains(i)) {
-            // Source items: no displacement (follow cursor via drag pixmap)
-            target = QPointF(0.0, 0.0);
-        } else {
-            // Find rank among remaining items
-            int rank = remaining.indexOf(i);
+        const auto it = std::lower_bound(srcs.cbegin(), srcs.cend(), i);
+        if (it == srcs.cend() || *it != i) {
+            // Rank among remaining items = row minus sources before it.
             // Items before dst keep compact position;
             // items at/after dst shift right by dragCount slots
-            int finalSlot = (rank < dst) ? rank : rank + dragCount;
+            const int rank = i - int(it - srcs.cbegin());
+            const int finalSlot = (rank < dst) ? rank : rank + dragCount;
             target = gridPos(finalSlot) - gridPos(i);
         }
-
-        const QPointF current(m_dragOffsets.value(i, QPointF(0.0, 0.0)));
-        if (qFuzzyCompare(current.x(), target.x()) &&
-            qFuzzyCompare(current.y(), target.y()) &&
-            !m_dragAnims.contains(i)) {
-            continue;
-        }
-
-        if (auto* oldAnim = m_dragAnims.value(i)) {
-            oldAnim->stop();
-            oldAnim->deleteLater();
-            m_dragAnims.remove(i);
-        }
-
-        if (qFuzzyCompare(current.x(), target.x()) &&
-            qFuzzyCompare(current.y(), target.y())) {
-            continue;
-        }
-
-        auto* anim = new QVariantAnimation(this);
-        anim->setStartValue(current);
-        anim->setEndValue(target);
-        anim->setDuration(::Animation::Duration::Fast);
-        anim->setEasingCurve(::Animation::getEasing(::Animation::EasingType::Decelerate));
-        connect(anim, &QVariantAnimation::valueChanged, this, [this, i](const QVariant& v) {
-            m_dragOffsets[i] = v.toPointF();
-            viewport()->update();
-        });
-        connect(anim, &QVariantAnimation::finished, this, [this, i, target]() {
-            m_dragOffsets[i] = target;
-            if (auto* a = m_dragAnims.value(i)) {
-                a->deleteLater();
-                m_dragAnims.remove(i);
-            }
-        });
-        m_dragAnims[i] = anim;
-        anim->start(QAbstractAnimation::DeleteWhenStopped);
+        // Source items: no displacement (follow cursor via drag pixmap)
+        m_displacement->setTarget(i, target);
     }
+    viewport()->update();
 }
 
 void GridView::clearDragAnimations() {
-    for (auto it = m_dragAnims.begin(); it != m_dragAnims.end(); ++it) {
-        if (it.value()) {
-            it.value()->stop();
-            it.value()->deleteLater();
-        }
-    }
-    m_dragAnims.clear();
-    m_dragOffsets.clear();
+    m_displacement->clear();
     viewport()->update();
 }
 
@@ -19,10 +19,17 @@ namespace view::scrolling { class ScrollBar; }
 
 namespace view::collections {
 
+class DragDisplacement;
+class IncrementalLoading;
+class ItemPaintCache;
+
 /**
  * Fluent 网格视图（仅视图层）。
  *
- * 基于 QListView IconMode + Wrapping 实现 WinUI 3 GridView 语义。
+ * 基于 QListView 实现 WinUI 3 GridView 语义；viewMode / wrapping 等属性保持 IconMode 以兼容旧接口，
+ * 但布局不再经由 QListView：所有 cell 同尺寸，item 矩形由 cellSize、spacing 与列数直接算出，
+ * 不逐项询问 delegate sizeHint，也不保存逐项几何。缩放窗口、修改 cellSize / maxColumns 均为 O(1)；
+ * visualRect / indexAt 为 O(1)，绘制只遍历重绘区域内的 cell。固定布局下忽略 setRowHidden。
  * 不负责注入 QAbstractItemModel 或 QStyledItemDelegate；由业务 / 页面层或测试组装。
  *
  * 提供：主题调色板与字体、Fluent 纵向滚动条、WinUI 风格选择模式映射、
@@ -68,6 +75,14 @@ public:
     Q_PROPERTY(int verticalSpacing READ verticalSpacing WRITE setVerticalSpacing NOTIFY verticalSpacingChanged)
     /** 最大列数 (0 = 不限制，自动根据容器宽度计算) */
     Q_PROPERTY(int maxColumns READ maxColumns WRITE setMaxColumns NOTIFY maxColumnsChanged)
+    /** 增量加载：按视口向 model 请求数据，未加载的 cell 绘制骨架占位（同 ListView） */
+    Q_PROPERTY(bool incrementalLoading READ incrementalLoading WRITE setIncrementalLoading NOTIFY incrementalLoadingChanged)
+    /** 增量加载时视口上下额外请求的 item 数 */
+    Q_PROPERTY(int prefetchDistance READ prefetchDistance WRITE setPrefetchDistance NOTIFY prefetchDistanceChanged)
+    /** item 绘制缓存（同 ListView）：启用后再 setItemDelegate 会替换掉缓存层，需重新开启 */
+    Q_PROPERTY(bool paintCacheEnabled READ paintCacheEnabled WRITE setPaintCacheEnabled NOTIFY paintCacheEnabledChanged)
+    /** 绘制缓存上限（KB） */
+    Q_PROPERTY(int paintCacheBudget READ paintCacheBudget WRITE setPaintCacheBudget NOTIFY paintCacheBudgetChanged)
 
     explicit GridView(QWidget* parent = nullptr);
     ~GridView() override = default;
@@ -108,6 +123,25 @@ public:
     int maxColumns() const { return m_maxColumns; }
     void setMaxColumns(int maxCols);
 
+    // --- Incremental loading ---
+    bool incrementalLoading() const;
+    void setIncrementalLoading(bool enabled);
+    int prefetchDistance() const;
+    void setPrefetchDistance(int items);
+
+    // --- Paint cache ---
+    bool paintCacheEnabled() const { return m_paintCache != nullptr; }
+    void setPaintCacheEnabled(bool enabled);
+    int paintCacheBudget() const { return m_paintCacheBudget; }
+    void setPaintCacheBudget(int kilobytes);
+    /** 未启用时为 nullptr */
+    ItemPaintCache* paintCache() const { return m_paintCache; }
+
+    void setModel(QAbstractItemModel* model) override;
+    QModelIndex indexAt(const QPoint& point) const override;
+    void scrollTo(const QModelIndex& index, ScrollHint hint = EnsureVisible) override;
+    void doItemsLayout() override;
+
     // --- Selection API ---
     int selectedIndex() const;
     QList<int> selectedRows() const;
@@ -128,6 +162,12 @@ signals:
     void horizontalSpacingChanged();
     void verticalSpacingChanged();
     void maxColumnsChanged();
+    void incrementalLoadingChanged();
+    void prefetchDistanceChanged();
+    void paintCacheEnabledChanged();
+    void paintCacheBudgetChanged();
+    /** 增量加载请求的 item 范围（可见项 ± prefetchDistance）；无可见项时为 (-1, -1) */
+    void visibleRangeChanged(int first, int last);
     void canReorderItemsChanged();
     void itemReordered(int fromIndex, int toIndex);
     void itemClicked(int index);
@@ -141,6 +181,12 @@ protected:
     void leaveEvent(QEvent* event) override;
     void wheelEvent(QWheelEvent* event) override;
     int verticalOffset() const override;
+    int horizontalOffset() const override;
+    void scrollContentsBy(int dx, int dy) override;
+    void updateGeometries() override;
+    QModelIndex moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers) override;
+    void setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) override;
+    QRegion visualRegionForSelection(const QItemSelection& selection) const override;
 
     // Drag-reorder (custom mouse handling)
     void mousePressEvent(QMouseEvent* event) override;
@@ -160,6 +206,22 @@ private:
     int dropIndicatorIndex(const QPoint& pos) const;
     void updateDragDisplacement();
     void clearDragAnimations();
+    int gridColumns() const;
+
+    // --- Fixed-cell layout ---
+    int itemCount() const;
+    /** cell + spacing */
+    QSize cellStride() const;
+    QRect cellRect(int row) const;            // 内容坐标（未扣除滚动偏移）
+    int cellAt(const QPoint& contentPos, bool exact) const;
+    int contentHeight() const;
+    /** 不含拖拽位移的基础 item 矩形（viewport 坐标） */
+    QRect itemRect(const QModelIndex& index) const;
+    void paintCells(QPaintEvent* event);
+    /** 拖拽位移参与的 item 区间：可见网格行 ± 被拖拽数量与一行的边距 */
+    void dragItemWindow(int* first, int* last) const;
+    /** 非拖拽源 item 中第 slot 个对应的 model 行；m_dragSourceIndices 需已升序 */
+    int nonSourceIndexForSlot(int slot) const;
     QPixmap renderItemPixmap(int row) const;
     QPixmap renderDragPixmap() const;
 
@@ -192,10 +254,16 @@ private:
     int  m_dragSourceIndex = -1;
     QList<int> m_dragSourceIndices;
     int  m_dropTargetIndex = -1;
-    QHash<int, QPointF>            m_dragOffsets;
-    QHash<int, QVariantAnimation*> m_dragAnims;
+    DragDisplacement* m_displacement = nullptr;
     mutable bool m_paintingWithOffsets = false;
 
+    // --- Incremental loading ---
+    IncrementalLoading* m_loading = nullptr;
+
+    // --- Paint cache ---
+    ItemPaintCache* m_paintCache = nullptr;
+    int m_paintCacheBudget = 32 * 1024;
+
     // --- Overscroll bounce ---
     qreal m_overscrollY = 0.0;
     QVariantAnimation* m_bounceAnim = nullptr;
@@ -0,0 +1,211 @@
+#include "IncrementalLoading.h"
+
+#include <QAbstractItemView>
+#include <QLinearGradient>
+#include <QPainter>
+#include <QPainterPath>
+
+#include "design/Animation.h"
+#include "design/CornerRadius.h"
+#include "design/Spacing.h"
+
+namespace view::collections {
+
+namespace {
+constexpr int kProbeStepPx = 4;          // 视口顶部探测首个可见行的步长
+constexpr int kShimmerCycleMs = 1200;    // 亮带扫过视口一次的时长
+constexpr int kSkeletonBarHeight = 12;
+constexpr int kShimmerAlphaBoost = 3;    // 亮带相对骨架底色的不透明度倍数
+enum : quintptr { ShimmerTween };        // 全局调度器上的补间键
+} // namespace
+
+IncrementalLoading::IncrementalLoading(QAbstractItemView* view)
+    : QObject(view), m_view(view) {}
+
+void IncrementalLoading::setEnabled(bool enabled) {
+    if (m_enabled == enabled) return;
+    m_enabled = enabled;
+    if (!enabled) {
+        for (const auto& c : m_modelConnections) disconnect(c);
+        m_modelConnections.clear();
+        m_model = nullptr;
+        m_first = m_last = -1;
+        ::Animation::Scheduler::instance().cancel(this, ShimmerTween);
+        return;
+    }
+    refresh();
+}
+
+void IncrementalLoading::setPrefetchDistance(int rows) {
+    rows = qMax(0, rows);
+    if (m_prefetchDistance == rows) return;
+    m_prefetchDistance = rows;
+    refresh();
+}
+
+void IncrementalLoading::syncModel() {
+    QAbstractItemModel* model = m_view->model();
+    if (model == m_model) return;
+
+    for (const auto& c : m_modelConnections) disconnect(c);
+    m_modelConnections.clear();
+    m_model = model;
+    m_first = m_last = -1;
+    if (!model) return;
+
+    // 行数变化后视口内的行也会变，合并到下一次事件循环统一刷新
+    m_modelConnections
+        << connect(model, &QAbstractItemModel::rowsInserted, this, &IncrementalLoading::scheduleRefresh)
+        << connect(model, &QAbstractItemModel::rowsRemoved, this, &IncrementalLoading::scheduleRefresh)
+        << connect(model, &QAbstractItemModel::modelReset, this, &IncrementalLoading::scheduleRefresh)
+        << connect(model, &QAbstractItemModel::layoutChanged, this, &IncrementalLoading::scheduleRefresh);
+
+    // 约定：model 提供 setVisibleRange(int, int) 槽时自动接收请求范围
+    const QMetaObject* meta = model->metaObject();
+    const int slot = meta->indexOfSlot("setVisibleRange(int,int)");
+    if (slot >= 0) {
+        m_modelConnections << QMetaObject::connect(
+            this, metaObject()->indexOfSignal("rangeChanged(int,int)"), model, slot);
+    }
+}
+
+void IncrementalLoading::scheduleRefresh() {
+    if (m_refreshQueued) return;
+    m_refreshQueued = true;
+    QMetaObject::invokeMethod(this, [this]() {
+        m_refreshQueued = false;
+        refresh();
+    }, Qt::QueuedConnection);
+}
+
+void IncrementalLoading::refresh() {
+    if (!m_enabled) return;
+    syncModel();
+    if (!m_model) return;
+
+    const QModelIndex root = m_view->rootIndex();
+    const int rows = m_model->rowCount(root);
+    int visibleFirst = -1;
+    int visibleLast = -1;
+    int first = -1;
+    int last = -1;
+    if (visibleRows(&visibleFirst, &visibleLast)) {
+        first = qMax(0, visibleFirst - m_prefetchDistance);
+        last = qMin(rows - 1, visibleLast + m_prefetchDistance);
+    }
+    if (first != m_first || last != m_last) {
+        m_first = first;
+        m_last = last;
+        emit rangeChanged(first, last);
+    }
+
+    // 追加式 model：预取范围够到末尾就提前取下一批，而不是等滚动条到底
+    if ((rows == 0 || visibleLast + m_prefetchDistance >= rows - 1) && m_model->canFetchMore(root))
+        m_model->fetchMore(root);
+}
+
+bool IncrementalLoading::visibleRows(int* first, int* last) const {
+    if (!m_model) return false;
+    const QModelIndex root = m_view->rootIndex();
+    const int rows = m_model->rowCount(root);
+    if (rows == 0) return false;
+
+    // 自顶向下探测首个可见项，再按行号向后走到首个离开视口的项为止
+    // （纵向列表越出底边、横向列表越出右边、网格换行后越出底边）
+    const QRect area = m_view->viewport()->rect();
+    const int xs[] = { area.left() + ::Spacing::XSmall, area.center().x(), area.right() - ::Spacing::XSmall };
+    QModelIndex top;
+    for (int y = area.top(); y <= area.bottom() && !top.isValid(); y += kProbeStepPx) {
+        for (int x : xs) {
+            top = m_view->indexAt(QPoint(x, y));
+            if (top.isValid()) break;
+        }
+    }
+    if (!top.isValid()) return false;
+
+    int row = top.row();
+    while (row + 1 < rows) {
+        const QRect r = m_view->visualRect(m_model->index(row + 1, 0, root));
+        if (!r.isEmpty() && !r.intersects(area)) break;
+        ++row;
+    }
+    *first = top.row();
+    *last = row;
+    return true;
+}
+
+void IncrementalLoading::paintPlaceholders(QPainter* painter, const FluentElement::Colors& colors) {
+    if (!m_enabled || !m_model) return;
+    int first = -1;
+    int last = -1;
+    if (!visibleRows(&first, &last)) return;
+
+    // 亮带横向扫过整个视口：所有占位行共用一个渐变，视觉上是同一道光
+    const qreal width = m_view->viewport()->width();
+    const qreal band = width * 0.3;
+    const qreal center = -band + m_shimmerPhase * (width + 2 * band);
+    QColor highlight = colors.subtleSecondary;
+    highlight.setAlpha(qMin(255, highlight.alpha() * kShimmerAlphaBoost));
+    QLinearGradient gradient(center - band, 0, center + band, 0);
+    gradient.setColorAt(0.0, colors.subtleSecondary);
+    gradient.setColorAt(0.5, highlight);
+    gradient.setColorAt(1.0, colors.subtleSecondary);
+    const QBrush brush(gradient);
+
+    const QModelIndex root = m_view->rootIndex();
+    bool painted = false;
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(Qt::NoPen);
+    for (int row = first; row <= last; ++row) {
+        const QModelIndex index = m_model->index(row, 0, root);
+        if (!index.data(ItemLoadingRole).toBool()) continue;
+        const QRect rect = m_view->visualRect(index);
+        if (rect.isEmpty()) continue;
+        paintSkeleton(painter, rect, row, brush);
+        painted = true;
+    }
+    painter->restore();
+
+    if (painted) keepShimmerRunning();
+}
+
+void IncrementalLoading::paintSkeleton(QPainter* painter, const QRect& rect, int row, const QBrush& brush) const {
+    const int padding = ::Spacing::Padding::ListItemHorizontal;
+    const qreal radius = ::CornerRadius::Control;
+    QPainterPath path;
+    if (rect.height() > rect.width() / 2) {
+        // 网格单元：上方缩略图块 + 下方一条标题
+        const QRect inner = rect.adjusted(padding / 2, padding / 2, -padding / 2, -padding / 2);
+        const int thumbHeight = inner.height() - kSkeletonBarHeight - padding / 2;
+        path.addRoundedRect(QRectF(inner.left(), inner.top(), inner.width(), thumbHeight), radius, radius);
+        path.addRoundedRect(QRectF(inner.left(), inner.bottom() - kSkeletonBarHeight + 1,
+                                   inner.width() * 0.7, kSkeletonBarHeight), radius, radius);
+    } else {
+        // 列表行：一条垂直居中的文本条，宽度随行号在 45%–85% 间变化，避免整齐划一
+        const int available = rect.width() - 2 * padding;
+        const qreal fraction = 0.45 + ((row * 37) % 41) / 100.0;
+        const int height = qMin(kSkeletonBarHeight, rect.height() / 2);
+        path.addRoundedRect(QRectF(rect.left() + padding, rect.center().y() - height / 2.0,
+                                   available * fraction, height), radius, radius);
+    }
+    painter->fillPath(path, brush);
+}
+
+void IncrementalLoading::keepShimmerRunning() {
+    m_placeholdersPainted = true;
+    auto& scheduler = ::Animation::Scheduler::instance();
+    if (scheduler.isRunning(this, ShimmerTween)) return;
+
+    m_placeholdersPainted = false;
+    scheduler.animate(this, ShimmerTween, 0.0, 1.0, kShimmerCycleMs, ::Animation::EasingType::Standard,
+        [this](qreal v) { m_shimmerPhase = v; },
+        m_view->viewport(),
+        [this]() {
+            // 一轮结束时若期间仍绘制过占位行则继续，否则停在起点
+            m_shimmerPhase = 0.0;
+            if (m_placeholdersPainted) keepShimmerRunning();
+        });
+}
+
+} // namespace view::collections
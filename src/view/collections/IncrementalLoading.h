@@ -0,0 +1,74 @@
+#ifndef INCREMENTALLOADING_H
+#define INCREMENTALLOADING_H
+
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+#include "view/FluentElement.h"
+
+class QAbstractItemModel;
+class QAbstractItemView;
+class QBrush;
+class QPainter;
+class QRect;
+
+namespace view::collections {
+
+/// 尚未加载的行：data(index, ItemLoadingRole) 返回 true，视图在该行绘制骨架占位
+constexpr int ItemLoadingRole = Qt::UserRole + 0x4C4F;
+
+/**
+ * @brief IncrementalLoading - 增量加载的视口跟踪与占位绘制（ListView / GridView 共用）
+ *
+ * - 视图滚动 / 尺寸 / 行数变化时 refresh()：取视口首末行，向两侧扩展 prefetchDistance 行后
+ *   发出 rangeChanged(first, last)。model 若有 setVisibleRange(int, int) 槽则自动连接，
+ *   由 model 按页请求数据、取消远离视口的请求（见 PagedListModel）。
+ * - 预取范围越过末行且 model->canFetchMore() 时提前调用 fetchMore()（总数未知的追加式 model）。
+ * - paintPlaceholders() 在视口内 ItemLoadingRole 为 true 的行上绘制圆角骨架条，
+ *   亮带由 Animation::Scheduler 驱动循环扫过；视口内不再有占位行时自动停止。
+ */
+class IncrementalLoading : public QObject {
+    Q_OBJECT
+
+public:
+    explicit IncrementalLoading(QAbstractItemView* view);
+
+    bool isEnabled() const { return m_enabled; }
+    void setEnabled(bool enabled);
+    int prefetchDistance() const { return m_prefetchDistance; }
+    void setPrefetchDistance(int rows);
+
+    /** 当前请求范围（含预取）；未启用或无可见行时为 -1 */
+    int first() const { return m_first; }
+    int last() const { return m_last; }
+
+    void refresh();
+    void paintPlaceholders(QPainter* painter, const FluentElement::Colors& colors);
+
+signals:
+    void rangeChanged(int first, int last);
+
+private:
+    void syncModel();
+    void scheduleRefresh();
+    /** 视口内首末行（按行号）；无可见行时返回 false */
+    bool visibleRows(int* first, int* last) const;
+    void paintSkeleton(QPainter* painter, const QRect& rect, int row, const QBrush& brush) const;
+    void keepShimmerRunning();
+
+    QAbstractItemView* m_view;
+    QPointer<QAbstractItemModel> m_model;
+    QVector<QMetaObject::Connection> m_modelConnections;
+    bool m_enabled = false;
+    bool m_refreshQueued = false;
+    int m_prefetchDistance = 50;
+    int m_first = -1;
+    int m_last = -1;
+    qreal m_shimmerPhase = 0.0;
+    bool m_placeholdersPainted = false;   // 本轮亮带扫过期间是否仍有占位行被绘制
+};
+
+} // namespace view::collections
+
+#endif // INCREMENTALLOADING_H
@@ -0,0 +1,232 @@
+#include "ItemPaintCache.h"
+
+#include <QAbstractItemModel>
+#include <QAbstractItemView>
+#include <QPaintDevice>
+#include <QPainter>
+#include <QStyleOptionViewItem>
+#include <QWidget>
+
+#include "view/FluentElement.h"
+
+namespace view::collections {
+
+namespace {
+constexpr int kDefaultBudgetKb = 32 * 1024;
+// dataChanged 覆盖的 item 超过此数时直接清空缓存，而不是逐个提升版本
+constexpr int kMaxTrackedChange = 512;
+} // namespace
+
+bool ItemPaintCache::Key::operator==(const Key& other) const {
+    return internalId == other.internalId && row == other.row && column == other.column
+        && revision == other.revision && state == other.state && features == other.features
+        && size == other.size && theme == other.theme && dprPercent == other.dprPercent;
+}
+
+FluentHashValue qHash(const ItemPaintCache::Key& key, FluentHashValue seed) {
+    const quint64 words[] = {
+        quint64(key.internalId),
+        quint64(quint32(key.row)) << 32 | quint32(key.column),
+        quint64(key.revision) << 32 | key.state,
+        quint64(quint32(key.size.width())) << 32 | quint32(key.size.height()),
+        quint64(key.features) << 32 | quint32(key.theme) << 16 | quint32(key.dprPercent),
+    };
+    return qHashBits(words, sizeof(words), seed);
+}
+
+ItemPaintCache::ItemPaintCache(QAbstractItemDelegate* inner, QObject* parent)
+    : QAbstractItemDelegate(parent), m_inner(inner) {
+    m_cache.setMaxCost(kDefaultBudgetKb);
+    if (!inner) return;
+
+    // 视图只连接当前 delegate 的信号：内层发出的编辑 / 尺寸信号经代理转发
+    connect(inner, &QAbstractItemDelegate::commitData, this, &QAbstractItemDelegate::commitData);
+    connect(inner, &QAbstractItemDelegate::closeEditor, this, &QAbstractItemDelegate::closeEditor);
+    connect(inner, &QAbstractItemDelegate::sizeHintChanged, this, [this](const QModelIndex& index) {
+        invalidate(index);
+        emit sizeHintChanged(index);
+    });
+}
+
+bool ItemPaintCache::install(ItemPaintCache*& cache, bool enabled, int budget, QAbstractItemView* view,
+                             const DelegateSlot& slot) {
+    if ((cache != nullptr) == enabled) return false;
+    QAbstractItemDelegate* current = slot.get ? slot.get() : view->itemDelegate();
+    auto place = [&](QAbstractItemDelegate* delegate) {
+        if (slot.set) slot.set(delegate);
+        else view->setItemDelegate(delegate);
+    };
+    if (enabled) {
+        cache = new ItemPaintCache(current, view);
+        cache->setBudget(budget);
+        place(cache);
+    } else {
+        if (current == cache) place(cache->innerDelegate());
+        cache->deleteLater();
+        cache = nullptr;
+    }
+    return true;
+}
+
+bool ItemPaintCache::applyBudget(ItemPaintCache* cache, int& budget, int kilobytes) {
+    kilobytes = qMax(0, kilobytes);
+    if (budget == kilobytes) return false;
+    budget = kilobytes;
+    if (cache) cache->setBudget(kilobytes);
+    return true;
+}
+
+void ItemPaintCache::setBudget(int kilobytes) {
+    m_cache.setMaxCost(qMax(0, kilobytes));
+}
+
+void ItemPaintCache::invalidate() {
+    m_cache.clear();
+    m_revisions.clear();
+}
+
+void ItemPaintCache::invalidate(const QModelIndex& index) {
+    if (index.isValid()) ++m_revisions[index];
+}
+
+quint32 ItemPaintCache::revisionOf(const QModelIndex& index) const {
+    return m_revisions.value(index, 0);
+}
+
+void ItemPaintCache::syncModel(const QAbstractItemModel* model) const {
+    if (model == m_model) return;
+
+    for (const auto& c : std::as_const(m_modelConnections)) disconnect(c);
+    m_modelConnections.clear();
+    m_cache.clear();
+    m_revisions.clear();
+    m_model = model;
+    if (!model) return;
+
+    // 结构变化后 (row, column) 与 item 的对应关系失效，整体丢弃
+    auto* self = const_cast<ItemPaintCache*>(this);
+    auto clearAll = [self]() { self->invalidate(); };
+    m_modelConnections
+        << connect(model, &QAbstractItemModel::dataChanged, self, &ItemPaintCache::onDataChanged)
+        << connect(model, &QAbstractItemModel::rowsInserted, self, clearAll)
+        << connect(model, &QAbstractItemModel::rowsRemoved, self, clearAll)
+        << connect(model, &QAbstractItemModel::rowsMoved, self, clearAll)
+        << connect(model, &QAbstractItemModel::columnsInserted, self, clearAll)
+        << connect(model, &QAbstractItemModel::columnsRemoved, self, clearAll)
+        << connect(model, &QAbstractItemModel::columnsMoved, self, clearAll)
+        << connect(model, &QAbstractItemModel::layoutChanged, self, clearAll)
+        << connect(model, &QAbstractItemModel::modelReset, self, clearAll);
+}
+
+void ItemPaintCache::onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight) {
+    if (!topLeft.isValid() || !bottomRight.isValid()) {
+        invalidate();
+        return;
+    }
+    const int rows = bottomRight.row() - topLeft.row() + 1;
+    const int columns = bottomRight.column() - topLeft.column() + 1;
+    if (qint64(rows) * columns > kMaxTrackedChange) {
+        invalidate();
+        return;
+    }
+    // 旧版本的条目不再被命中，由 LRU 自然淘汰
+    const QModelIndex parent = topLeft.parent();
+    for (int r = topLeft.row(); r <= bottomRight.row(); ++r) {
+        for (int c = topLeft.column(); c <= bottomRight.column(); ++c)
+            invalidate(m_model->index(r, c, parent));
+    }
+}
+
+void ItemPaintCache::paint(QPainter* painter, const QStyleOptionViewItem& option,
+                           const QModelIndex& index) const {
+    if (!m_inner) return;
+
+    const QSize size = option.rect.size();
+    const qreal dpr = painter->device() ? painter->device()->devicePixelRatioF() : 1.0;
+    const int costKb = int(qint64(size.width() * dpr) * qint64(size.height() * dpr) * 4 / 1024) + 1;
+    auto* aware = dynamic_cast<const PaintCacheAware*>(m_inner.data());
+    const bool cacheable = index.isValid() && !size.isEmpty()
+        && painter->worldTransform().type() <= QTransform::TxTranslate
+        && costKb <= m_cache.maxCost() / 4
+        && !(aware && aware->isPaintVolatile(index))
+        && !(m_volatileFunc && m_volatileFunc(index));
+    if (!cacheable) {
+        m_inner->paint(painter, option, index);
+        return;
+    }
+    syncModel(index.model());
+
+    Key key;
+    key.internalId = index.internalId();
+    key.row = index.row();
+    key.column = index.column();
+    key.revision = revisionOf(index);
+    key.state = quint32(option.state);
+    key.features = quint32(option.features) | quint32(option.viewItemPosition) << 16;
+    key.size = size;
+    key.theme = int(FluentElement::currentTheme());
+    key.dprPercent = qRound(dpr * 100);
+
+    if (const QPixmap* cached = m_cache.object(key)) {
+        ++m_hits;
+        painter->drawPixmap(option.rect.topLeft(), *cached);
+        return;
+    }
+    ++m_misses;
+
+    auto* pixmap = new QPixmap(size * dpr);
+    pixmap->setDevicePixelRatio(dpr);
+    pixmap->fill(Qt::transparent);
+    {
+        QPainter p(pixmap);
+        p.setRenderHints(painter->renderHints());
+        p.setFont(painter->font());
+        p.setPen(painter->pen());
+        QStyleOptionViewItem local = option;
+        local.rect.moveTo(0, 0);
+        m_inner->paint(&p, local, index);
+    }
+    painter->drawPixmap(option.rect.topLeft(), *pixmap);
+    m_cache.insert(key, pixmap, costKb);
+}
+
+QSize ItemPaintCache::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const {
+    return m_inner ? m_inner->sizeHint(option, index) : QSize();
+}
+
+QWidget* ItemPaintCache::createEditor(QWidget* parent, const QStyleOptionViewItem& option,
+                                      const QModelIndex& index) const {
+    return m_inner ? m_inner->createEditor(parent, option, index) : nullptr;
+}
+
+void ItemPaintCache::destroyEditor(QWidget* editor, const QModelIndex& index) const {
+    if (m_inner) m_inner->destroyEditor(editor, index);
+    else QAbstractItemDelegate::destroyEditor(editor, index);
+}
+
+void ItemPaintCache::setEditorData(QWidget* editor, const QModelIndex& index) const {
+    if (m_inner) m_inner->setEditorData(editor, index);
+}
+
+void ItemPaintCache::setModelData(QWidget* editor, QAbstractItemModel* model,
+                                  const QModelIndex& index) const {
+    if (m_inner) m_inner->setModelData(editor, model, index);
+}
+
+void ItemPaintCache::updateEditorGeometry(QWidget* editor, const QStyleOptionViewItem& option,
+                                          const QModelIndex& index) const {
+    if (m_inner) m_inner->updateEditorGeometry(editor, option, index);
+}
+
+bool ItemPaintCache::editorEvent(QEvent* event, QAbstractItemModel* model,
+                                 const QStyleOptionViewItem& option, const QModelIndex& index) {
+    return m_inner && m_inner->editorEvent(event, model, option, index);
+}
+
+bool ItemPaintCache::helpEvent(QHelpEvent* event, QAbstractItemView* view,
+                               const QStyleOptionViewItem& option, const QModelIndex& index) {
+    return m_inner ? m_inner->helpEvent(event, view, option, index)
+                   : QAbstractItemDelegate::helpEvent(event, view, option, index);
+}
+
+} // namespace view::collections
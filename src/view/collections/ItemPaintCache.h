@@ -0,0 +1,142 @@
+#ifndef ITEMPAINTCACHE_H
+#define ITEMPAINTCACHE_H
+
+#include <QAbstractItemDelegate>
+#include <QCache>
+#include <QHash>
+#include <QModelIndex>
+#include <QPixmap>
+#include <QPointer>
+#include <QSize>
+#include <QVector>
+#include <functional>
+
+class QAbstractItemView;
+
+#include "compatibility/QtCompat.h"
+
+namespace view::collections {
+
+/**
+ * 带动画的 delegate 实现此接口：isPaintVolatile() 为 true 的 item（动画进行中）
+ * 每帧直接绘制、不写入缓存；动画结束后下一次绘制重新进入缓存。
+ */
+class PaintCacheAware {
+public:
+    virtual ~PaintCacheAware() = default;
+    virtual bool isPaintVolatile(const QModelIndex& index) const = 0;
+};
+
+/**
+ * @brief ItemPaintCache - item 绘制结果的 LRU 缓存（ListView / GridView / TreeView 共用）
+ *
+ * 作为透明代理包在用户 delegate 外层：paint() 先按
+ * (item, 数据版本, state, 尺寸, 主题, DPR) 查缓存，命中时直接贴图；未命中时把内层 delegate
+ * 画进透明 QPixmap 再贴图并写入缓存。其余接口（sizeHint / 编辑器 / editorEvent）原样转发。
+ *
+ * - 数据版本：model 的 dataChanged 只提升受影响 item 的版本；行的插入 / 删除 / 移动、
+ *   layoutChanged、modelReset 以及大范围 dataChanged 清空整个缓存。
+ * - 预算以 KB 计（同 QPixmapCache），超出时淘汰最久未使用的 item；单个 item 超过预算 1/4 时不缓存。
+ * - 内层 delegate 绘制超出 option.rect 的部分会被裁掉；painter 带缩放 / 旋转时不走缓存。
+ * - delegate 依赖 model 数据与 option 之外的状态（如视图属性）时，变化后需调用 invalidate()。
+ *
+ * 视图通过 install() / applyBudget() / invalidateStyle() 挂载与维护缓存，三个集合视图共用同一实现：
+ * - 关闭时只在视图当前 delegate 仍是缓存本身时才还原内层 delegate；开启后用户又调用过
+ *   setItemDelegate() 的话，缓存已被替换，保留用户的 delegate。
+ * - 缓存位图固化了绘制时的调色板与字体，主题切换时视图需调用 invalidateStyle()。
+ */
+class ItemPaintCache : public QAbstractItemDelegate {
+    Q_OBJECT
+
+public:
+    explicit ItemPaintCache(QAbstractItemDelegate* inner, QObject* parent = nullptr);
+
+    QAbstractItemDelegate* innerDelegate() const { return m_inner; }
+
+    /** 视图放置 delegate 的位置；缺省为 view->itemDelegate() / setItemDelegate() */
+    struct DelegateSlot {
+        std::function<QAbstractItemDelegate*()> get;
+        std::function<void(QAbstractItemDelegate*)> set;
+    };
+    /**
+     * 在 view 的当前 delegate 外包一层缓存（enabled）或拆除并还原（!enabled）。
+     * cache 为视图持有的指针，随之更新；状态未变时返回 false。
+     */
+    static bool install(ItemPaintCache*& cache, bool enabled, int budget, QAbstractItemView* view,
+                        const DelegateSlot& slot = {});
+    /** 更新视图记录的预算（KB，下限 0）并同步到缓存；未变化时返回 false */
+    static bool applyBudget(ItemPaintCache* cache, int& budget, int kilobytes);
+    /** 主题（调色板 / 字体）变化：丢弃已固化旧样式的位图 */
+    static void invalidateStyle(ItemPaintCache* cache) { if (cache) cache->invalidate(); }
+
+    /** 缓存上限（KB） */
+    int budget() const { return m_cache.maxCost(); }
+    void setBudget(int kilobytes);
+    /** 当前占用（KB） */
+    int usage() const { return m_cache.totalCost(); }
+    int count() const { return m_cache.count(); }
+
+    /** 视图自身驱动的 item 动画（如 TreeView 的 chevron 旋转）：返回 true 的 item 不走缓存 */
+    using VolatileFunc = std::function<bool(const QModelIndex& index)>;
+    void setVolatileFunction(VolatileFunc func) { m_volatileFunc = std::move(func); }
+
+    int hitCount() const { return m_hits; }
+    int missCount() const { return m_misses; }
+
+    /** 丢弃全部缓存（主题、字体或 delegate 外部状态变化时调用） */
+    void invalidate();
+    /** 丢弃单个 item 的缓存 */
+    void invalidate(const QModelIndex& index);
+
+    void paint(QPainter* painter, const QStyleOptionViewItem& option,
+               const QModelIndex& index) const override;
+    QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override;
+
+    QWidget* createEditor(QWidget* parent, const QStyleOptionViewItem& option,
+                          const QModelIndex& index) const override;
+    void destroyEditor(QWidget* editor, const QModelIndex& index) const override;
+    void setEditorData(QWidget* editor, const QModelIndex& index) const override;
+    void setModelData(QWidget* editor, QAbstractItemModel* model,
+                      const QModelIndex& index) const override;
+    void updateEditorGeometry(QWidget* editor, const QStyleOptionViewItem& option,
+                              const QModelIndex& index) const override;
+    bool editorEvent(QEvent* event, QAbstractItemModel* model,
+                     const QStyleOptionViewItem& option, const QModelIndex& index) override;
+    bool helpEvent(QHelpEvent* event, QAbstractItemView* view,
+                   const QStyleOptionViewItem& option, const QModelIndex& index) override;
+
+    /** 缓存键；item 以 (internalId, row, column) 标识 */
+    struct Key {
+        quintptr internalId = 0;
+        int row = -1;
+        int column = -1;
+        quint32 revision = 0;
+        quint32 state = 0;
+        quint32 features = 0;     // QStyleOptionViewItem::features | viewItemPosition << 16
+        QSize size;
+        int theme = 0;
+        int dprPercent = 100;
+
+        bool operator==(const Key& other) const;
+    };
+
+private:
+    void syncModel(const QAbstractItemModel* model) const;
+    void onDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight);
+    quint32 revisionOf(const QModelIndex& index) const;
+
+    QPointer<QAbstractItemDelegate> m_inner;
+    VolatileFunc m_volatileFunc;
+    mutable QCache<Key, QPixmap> m_cache;
+    mutable QPointer<const QAbstractItemModel> m_model;
+    mutable QVector<QMetaObject::Connection> m_modelConnections;
+    mutable QHash<QModelIndex, quint32> m_revisions;   // 只记录版本被提升过的 item；缺省为 0
+    mutable int m_hits = 0;
+    mutable int m_misses = 0;
+};
+
+FluentHashValue qHash(const ItemPaintCache::Key& key, FluentHashValue seed = 0);
+
+} // namespace view::collections
+
+#endif // ITEMPAINTCACHE_H
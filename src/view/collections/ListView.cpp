@@ -17,13 +17,15 @@
 #include <QStandardItemModel>
 #include <QStyledItemDelegate>
 #include <QTimer>
-#include <QVariantAnimation>
 #include <QWheelEvent>
 
 #include "design/Animation.h"
 #include "design/CornerRadius.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
+#include "view/collections/DragDisplacement.h"
+#include "view/collections/IncrementalLoading.h"
+#include "view/collections/ItemPaintCache.h"
 #include "view/scrolling/ScrollBar.h"
 
 namespace view::collections {
@@ -38,6 +40,9 @@ constexpr qreal kDiscreteWheelStepPx = ::Spacing::ControlHeight::Large;
 constexpr qreal kDiscreteBoundaryOverscrollMinPx = 12.0;
 constexpr qreal kDiscreteBoundaryOverscrollMaxPx = 48.0;
 constexpr int   kScrollBarEdgeInset = ::Spacing::XSmall / 2;
+// Rows beyond the viewport edge that take part in drag displacement (a row shifts by
+// at most one source-row height, so a small margin covers everything that can scroll in)
+constexpr int   kDragDisplacementMarginRows = 4;
 
 int scrollSign(qreal value) {
     if (value > 0.0) return 1;
@@ -59,22 +64,19 @@ public:
     QAbstractItemDelegate* innerDelegate() const { return m_inner; }
 
     int sectionHeaderHeight() const {
-        const QFont titleFont = m_listView->themeFont(Typography::FontRole::Title).toQFont();
-        const QFontMetrics fm(titleFont);
+        // Cached metrics: sizeHint runs per row, so no QFont/QFontMetrics construction here
+        const QFontMetrics& fm = m_listView->themeFontMetrics(FluentElement::FontRole::Title);
         return fm.height() + 4; // text + separator(1px) + padding(3px)
     }
 
+    // Both lookups go through ListView's section index (binary search, no SectionKeyFunc call)
     bool isSectionStart(int row) const {
         if (!m_listView->sectionEnabled() || !m_listView->m_sectionKeyFunc) return false;
-        if (row == 0) return true;
-        auto* model = m_listView->model();
-        if (!model || row >= model->rowCount()) return false;
-        return m_listView->m_sectionKeyFunc(row) != m_listView->m_sectionKeyFunc(row - 1);
+        return m_listView->isSectionStartRow(row);
     }
 
     QString sectionKey(int row) const {
-        if (!m_listView->m_sectionKeyFunc) return {};
-        return m_listView->m_sectionKeyFunc(row);
+        return m_listView->sectionKey(m_listView->sectionForRow(row));
     }
 
     QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const override {
@@ -93,33 +95,9 @@ public:
         const int headerH = isStart ? sectionHeaderHeight() : 0;
 
         if (isStart) {
-            const auto& c = m_listView->themeColors();
-            const QFont titleFont = m_listView->themeFont(Typography::FontRole::Title).toQFont();
-            const QFontMetrics titleFm(titleFont);
-            const int hPad = ::Spacing::Padding::ListItemHorizontal;
-            const int textH = titleFm.height();
-
-            // Fill section header area with background to clear any hover artifacts
-            QRect headerArea(option.rect.left(), option.rect.top(),
-                             option.rect.width(), headerH);
-            painter->save();
-            painter->setRenderHint(QPainter::Antialiasing);
-            painter->fillRect(headerArea, c.bgLayer);
-
-            // Section title text
-            QRect textRect(option.rect.left() + hPad, option.rect.top(),
-                           option.rect.width() - 2 * hPad, textH);
-            painter->setFont(titleFont);
-            painter->setPen(c.textPrimary);
-            painter->drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter, sectionKey(row));
-
-            // Separator line below text
-            const int lineY = option.rect.top() + textH + 2;
-            painter->setPen(QPen(c.strokeDefault, 1.0));
-            painter->drawLine(option.rect.left() + hPad, lineY,
-                              option.rect.right() - hPad, lineY);
-
-            painter->restore();
+            m_listView->paintSectionHeader(painter,
+                QRect(option.rect.left(), option.rect.top(), option.rect.width(), headerH),
+                sectionKey(row));
         }
 
         // Adjust rect for inner delegate (item content area only)
@@ -170,6 +148,12 @@ ListView::ListView(QWidget* parent)
 
     // Header/footer 初始为空 —— 由 setHeader() / setHeaderText() 按需创建
 
+    m_displacement = new DragDisplacement(this);
+    connect(m_displacement, &DragDisplacement::offsetsChanged, this, [this]() { viewport()->update(); });
+
+    m_loading = new IncrementalLoading(this);
+    connect(m_loading, &IncrementalLoading::rangeChanged, this, &ListView::visibleRangeChanged);
+
     // --- Fluent scroll bar (vertical) ---
     m_vScrollBar = new ::view::scrolling::ScrollBar(Qt::Vertical, this);
     m_vScrollBar->setObjectName(QStringLiteral("fluentListViewScrollBar"));
@@ -190,22 +174,6 @@ ListView::ListView(QWidget* parent)
     connect(m_hScrollBar, &QScrollBar::valueChanged, nativeHBar,  &QScrollBar::setValue);
     connect(nativeHBar, &QScrollBar::rangeChanged, this, &ListView::syncFluentHScrollBar);
 
-    // --- Overscroll bounce ---
-    m_bounceAnim = new QVariantAnimation(this);
-    m_bounceAnim->setDuration(::Animation::Duration::Normal);
-    m_bounceAnim->setEasingCurve(::Animation::getEasing(::Animation::EasingType::Decelerate));
-    connect(m_bounceAnim, &QVariantAnimation::valueChanged, this, [this](const QVariant& v) {
-        if (flow() == LeftToRight)
-            m_overscrollX = v.toReal();
-        else
-            m_overscrollY = v.toReal();
-        viewport()->update();
-    });
-    connect(m_bounceAnim, &QVariantAnimation::finished, this, [this]() {
-        resetNoPhaseCluster();
-        resetNoPhaseBoundaryBounce();
-    });
-
     m_bounceTimer = new QTimer(this);
     m_bounceTimer->setSingleShot(true);
     m_bounceTimer->setInterval(kNoPhaseBoundaryBounceDelayMs);
@@ -222,7 +190,7 @@ ListView::ListView(QWidget* parent)
 ListView::~ListView() {
     // Stop bounce animation/timer before destruction so no pending tick can fire on
     // a half-destroyed object (defensive — also helps Qt5 path stability).
-    if (m_bounceAnim) m_bounceAnim->stop();
+    stopBounce();
     if (m_bounceTimer) m_bounceTimer->stop();
     resetNoPhaseBoundaryBounce();
 }
@@ -259,7 +227,7 @@ ListView::Flow ListView::flow() const {
 void ListView::setFlow(Flow f) {
     if (QListView::flow() == f) return;
     if (m_bounceTimer) m_bounceTimer->stop();
-    if (m_bounceAnim) m_bounceAnim->stop();
+    stopBounce();
     m_overscrollX = 0.0;
     m_overscrollY = 0.0;
     resetNoPhaseCluster();
@@ -415,6 +383,7 @@ void ListView::setSectionEnabled(bool enabled) {
     if (m_sectionEnabled == enabled) return;
     m_sectionEnabled = enabled;
     installSectionProxy();
+    invalidateSectionIndex();
     if (viewport()) viewport()->update();
     emit sectionEnabledChanged();
 }
@@ -422,6 +391,7 @@ void ListView::setSectionEnabled(bool enabled) {
 void ListView::setSectionKeyFunction(SectionKeyFunc func) {
     m_sectionKeyFunc = std::move(func);
     installSectionProxy();
+    invalidateSectionIndex();
     if (m_sectionEnabled && viewport()) viewport()->update();
 }
 
@@ -448,6 +418,612 @@ void ListView::installSectionProxy() {
     }
 }
 
+void ListView::replaceUserDelegate(QAbstractItemDelegate* delegate) {
+    if (m_sectionProxy) {
+        static_cast<SectionProxyDelegate*>(m_sectionProxy)->setInnerDelegate(delegate);
+        m_userDelegate = delegate;
+        if (viewport()) viewport()->update();
+    } else {
+        QAbstractItemView::setItemDelegate(delegate);
+    }
+}
+
+void ListView::setStickySectionHeader(bool enabled) {
+    if (m_stickySectionHeader == enabled) return;
+    m_stickySectionHeader = enabled;
+    if (viewport()) viewport()->update();
+    emit stickySectionHeaderChanged();
+}
+
+// ── Section index ─────────────────────────────────────────────────────────────
+// Section start rows and one key per section, kept sorted. Built once with a single
+// pass over SectionKeyFunc, then patched from the model's row signals so only the
+// touched rows (plus one neighbour on each side) are re-evaluated. Paint, sizeHint
+// and layout only do binary searches on it.
+
+bool ListView::sectionIndexActive() const {
+    return m_sectionEnabled && m_sectionKeyFunc && model();
+}
+
+void ListView::invalidateSectionIndex() {
+    m_sectionIndexDirty = true;
+    m_sectionStarts.clear();
+    m_sectionKeys.clear();
+    onSectionsChanged();
+}
+
+void ListView::ensureSectionIndex() const {
+    if (!m_sectionIndexDirty) return;
+    m_sectionIndexDirty = false;
+    m_sectionStarts.clear();
+    m_sectionKeys.clear();
+    if (sectionIndexActive())
+        rescanSections(0, model()->rowCount(rootIndex()) - 1);
+}
+
+bool ListView::rescanSections(int from, int to) const {
+    const int count = model() ? model()->rowCount(rootIndex()) : 0;
+    from = qMax(0, from);
+    to = qMin(count - 1, to);
+    if (from > to) return false;
+
+    QVector<int> starts;
+    QVector<QString> keys;
+    QString prev = from > 0 ? m_sectionKeyFunc(from - 1) : QString();
+    for (int row = from; row <= to; ++row) {
+        QString key = m_sectionKeyFunc(row);
+        if (row == 0 || key != prev) {
+            starts.append(row);
+            keys.append(key);
+        }
+        prev = std::move(key);
+    }
+
+    const int i0 = int(std::lower_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), from)
+                       - m_sectionStarts.cbegin());
+    const int i1 = int(std::upper_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), to)
+                       - m_sectionStarts.cbegin());
+    if (i1 - i0 == starts.size()
+        && std::equal(starts.cbegin(), starts.cend(), m_sectionStarts.cbegin() + i0)
+        && std::equal(keys.cbegin(), keys.cend(), m_sectionKeys.cbegin() + i0)) {
+        return false;
+    }
+
+    if (i0 == 0 && i1 == m_sectionStarts.size()) {
+        m_sectionStarts = std::move(starts);
+        m_sectionKeys = std::move(keys);
+    } else {
+        m_sectionStarts = m_sectionStarts.mid(0, i0) + starts + m_sectionStarts.mid(i1);
+        m_sectionKeys = m_sectionKeys.mid(0, i0) + keys + m_sectionKeys.mid(i1);
+    }
+    return true;
+}
+
+void ListView::onSectionRowsInserted(const QModelIndex& parent, int first, int last) {
+    if (parent != rootIndex() || m_sectionIndexDirty || !sectionIndexActive()) return;
+    const int n = last - first + 1;
+    const int i = int(std::lower_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), first)
+                      - m_sectionStarts.cbegin());
+    for (int k = i; k < m_sectionStarts.size(); ++k)
+        m_sectionStarts[k] += n;
+    // The old row at `first` now sits at last + 1 and may join the inserted section
+    rescanSections(first, last + 1);
+    onSectionsChanged();
+}
+
+void ListView::onSectionRowsRemoved(const QModelIndex& parent, int first, int last) {
+    if (parent != rootIndex() || m_sectionIndexDirty || !sectionIndexActive()) return;
+    const int n = last - first + 1;
+    const int i0 = int(std::lower_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), first)
+                       - m_sectionStarts.cbegin());
+    const int i1 = int(std::upper_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), last)
+                       - m_sectionStarts.cbegin());
+    m_sectionStarts.remove(i0, i1 - i0);
+    m_sectionKeys.remove(i0, i1 - i0);
+    for (int k = i0; k < m_sectionStarts.size(); ++k)
+        m_sectionStarts[k] -= n;
+    // The row that followed the removed block now starts at `first`
+    rescanSections(first, first);
+    onSectionsChanged();
+}
+
+void ListView::onSectionsChanged() {
+    // Section start rows carry the header height, so row geometry changes with the index
+    if (usesUniformRows())
+        invalidateRowLayout();
+    else if (m_sectionProxy)
+        scheduleDelayedItemsLayout();
+}
+
+bool ListView::isSectionStartRow(int row) const {
+    ensureSectionIndex();
+    return std::binary_search(m_sectionStarts.cbegin(), m_sectionStarts.cend(), row);
+}
+
+int ListView::sectionCount() const {
+    ensureSectionIndex();
+    return int(m_sectionStarts.size());
+}
+
+int ListView::sectionForRow(int row) const {
+    ensureSectionIndex();
+    if (row < 0 || !model() || row >= model()->rowCount(rootIndex())) return -1;
+    return int(std::upper_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), row)
+               - m_sectionStarts.cbegin()) - 1;
+}
+
+int ListView::sectionStartRow(int section) const {
+    ensureSectionIndex();
+    return section >= 0 && section < m_sectionStarts.size() ? m_sectionStarts.at(section) : -1;
+}
+
+QString ListView::sectionKey(int section) const {
+    ensureSectionIndex();
+    return section >= 0 && section < m_sectionKeys.size() ? m_sectionKeys.at(section) : QString();
+}
+
+void ListView::scrollToSection(int section) {
+    const int row = sectionStartRow(section);
+    if (row < 0) return;
+    scrollTo(model()->index(row, 0, rootIndex()), PositionAtTop);
+}
+
+void ListView::paintSectionHeader(QPainter* painter, const QRect& rect, const QString& key) const {
+    const auto& c = themeColors();
+    const QFont& titleFont = themeQFont(FluentElement::FontRole::Title);
+    const QFontMetrics& titleFm = themeFontMetrics(FluentElement::FontRole::Title);
+    const int hPad = ::Spacing::Padding::ListItemHorizontal;
+    const int textH = titleFm.height();
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    // Fill section header area with background to clear any hover artifacts
+    painter->fillRect(rect, c.bgLayer);
+
+    // Section title text
+    QRect textRect(rect.left() + hPad, rect.top(), rect.width() - 2 * hPad, textH);
+    painter->setFont(titleFont);
+    painter->setPen(c.textPrimary);
+    painter->drawText(textRect, Qt::AlignLeft | Qt::AlignVCenter, key);
+
+    // Separator line below text
+    const int lineY = rect.top() + textH + 2;
+    painter->setPen(QPen(c.strokeDefault, 1.0));
+    painter->drawLine(rect.left() + hPad, lineY, rect.right() - hPad, lineY);
+    painter->restore();
+}
+
+QRect ListView::stickyHeaderRect(int* section) const {
+    if (!m_stickySectionHeader || !m_sectionProxy || !model()) return {};
+    if (sectionCount() == 0) return {};
+
+    // Row under the viewport top; the second probe skips a spacing gap at y = 0
+    int topRow = -1;
+    if (usesUniformRows()) {
+        topRow = uniformRowAt(verticalOffset(), false);
+    } else {
+        const int x = viewport()->width() / 2;
+        QModelIndex idx = indexAt(QPoint(x, 0));
+        if (!idx.isValid()) idx = indexAt(QPoint(x, spacing()));
+        topRow = idx.row();
+    }
+    const int current = sectionForRow(topRow);
+    if (current < 0) return {};
+
+    const QRect startRect = itemRect(model()->index(sectionStartRow(current), 0, rootIndex()));
+    if (startRect.top() >= 0) return {};   // inline header is already visible
+
+    const int headerH = static_cast<SectionProxyDelegate*>(m_sectionProxy)->sectionHeaderHeight();
+    int top = 0;
+    if (current + 1 < sectionCount()) {
+        // Next section's header pushes the sticky one up
+        const QRect next = itemRect(model()->index(sectionStartRow(current + 1), 0, rootIndex()));
+        top = qMin(0, next.top() - headerH);
+    }
+    if (section) *section = current;
+    return QRect(startRect.left(), top, startRect.width(), headerH);
+}
+
+// ── Virtualized uniform rows ──────────────────────────────────────────────────
+// QListView lays out every row up front (one delegate sizeHint per row, and with
+// sections two SectionKeyFunc calls on top). In virtualized mode all rows share one
+// height, section start rows add a fixed header height, and geometry is computed on
+// demand from the sorted section start rows:
+//   top(r) = spacing + r * (rowHeight + spacing) + sectionsBefore(r) * headerHeight
+// so layout is a single pass over the section keys and every lookup is a binary search.
+
+void ListView::setVirtualized(bool enabled) {
+    if (m_virtualized == enabled) return;
+    m_virtualized = enabled;
+    m_rowLayoutDirty = true;
+    // Switching back rebuilds QListView's own layout; switching on drops it.
+    doItemsLayout();
+    emit virtualizedChanged();
+}
+
+void ListView::setUniformRowHeight(int height) {
+    height = qMax(0, height);
+    if (m_uniformRowHeight == height) return;
+    m_uniformRowHeight = height;
+    invalidateRowLayout();
+    emit uniformRowHeightChanged();
+}
+
+bool ListView::incrementalLoading() const {
+    return m_loading->isEnabled();
+}
+
+void ListView::setIncrementalLoading(bool enabled) {
+    if (m_loading->isEnabled() == enabled) return;
+    m_loading->setEnabled(enabled);
+    viewport()->update();
+    emit incrementalLoadingChanged();
+}
+
+int ListView::prefetchDistance() const {
+    return m_loading->prefetchDistance();
+}
+
+void ListView::setPrefetchDistance(int rows) {
+    if (m_loading->prefetchDistance() == qMax(0, rows)) return;
+    m_loading->setPrefetchDistance(rows);
+    emit prefetchDistanceChanged();
+}
+
+// ── Paint cache ───────────────────────────────────────────────────────────────
+// The cache wraps the user's delegate directly (inside the section proxy, if any),
+// so section headers are still painted live and only item content is cached.
+
+void ListView::setPaintCacheEnabled(bool enabled) {
+    const ItemPaintCache::DelegateSlot userSlot {
+        [this]() { return m_sectionProxy ? m_userDelegate : itemDelegate(); },
+        [this](QAbstractItemDelegate* delegate) { replaceUserDelegate(delegate); },
+    };
+    if (ItemPaintCache::install(m_paintCache, enabled, m_paintCacheBudget, this, userSlot))
+        emit paintCacheEnabledChanged();
+}
+
+void ListView::setPaintCacheBudget(int kilobytes) {
+    if (ItemPaintCache::applyBudget(m_paintCache, m_paintCacheBudget, kilobytes)) emit paintCacheBudgetChanged();
+}
+
+bool ListView::usesUniformRows() const {
+    return m_virtualized && flow() == TopToBottom && !isWrapping();
+}
+
+void ListView::invalidateRowLayout() {
+    m_rowLayoutDirty = true;
+    if (!usesUniformRows()) return;
+    updateGeometries();
+    if (viewport()) viewport()->update();
+}
+
+void ListView::ensureRowLayout() const {
+    const QAbstractItemModel* m = model();
+    const int count = m ? m->rowCount(rootIndex()) : 0;
+    // Row count is checked too: rows may change between a model signal and the
+    // delayed doItemsLayout() that would normally mark the layout dirty.
+    if (!m_rowLayoutDirty && count == m_layoutRowCount) return;
+
+    m_rowLayoutDirty = false;
+    m_layoutRowCount = count;
+    m_layoutHeaderHeight = 0;
+    m_layoutRowHeight = 0;
+    if (count == 0) return;
+
+    if (m_uniformRowHeight > 0) {
+        m_layoutRowHeight = m_uniformRowHeight;
+    } else {
+        // Measure row 0 with the user's delegate (the section proxy would add header height)
+        QAbstractItemDelegate* del = m_sectionProxy ? m_userDelegate : itemDelegate();
+        QStyleOptionViewItem opt;
+        FLUENT_INIT_VIEW_ITEM_OPTION(&opt);
+        const QModelIndex first = m->index(0, 0, rootIndex());
+        m_layoutRowHeight = del ? del->sizeHint(opt, first).height() : fontMetrics().height();
+    }
+    m_layoutRowHeight = qMax(1, m_layoutRowHeight);
+
+    ensureSectionIndex();
+    if (m_sectionProxy && !m_sectionStarts.isEmpty())
+        m_layoutHeaderHeight = static_cast<SectionProxyDelegate*>(m_sectionProxy)->sectionHeaderHeight();
+}
+
+int ListView::sectionsBefore(int row) const {
+    return int(std::lower_bound(m_sectionStarts.cbegin(), m_sectionStarts.cend(), row)
+               - m_sectionStarts.cbegin());
+}
+
+QRect ListView::uniformRowRect(int row) const {
+    ensureRowLayout();
+    if (row < 0 || row >= m_layoutRowCount) return {};
+    const int s = spacing();
+    const int stride = m_layoutRowHeight + s;
+    const int headers = sectionsBefore(row);
+    const bool isStart = headers < m_sectionStarts.size() && m_sectionStarts.at(headers) == row;
+    const int top = s + row * stride + headers * m_layoutHeaderHeight;
+    const int h = m_layoutRowHeight + (isStart ? m_layoutHeaderHeight : 0);
+    const int w = qMax(0, viewport()->width() - 2 * s);
+    return QRect(s, top, w, h);
+}
+
+int ListView::uniformContentHeight() const {
+    ensureRowLayout();
+    if (m_layoutRowCount == 0) return 0;
+    const int s = spacing();
+    return s + m_layoutRowCount * (m_layoutRowHeight + s)
+             + int(m_sectionStarts.size()) * m_layoutHeaderHeight;
+}
+
+/**
+ * Row at content y. With exact=false the nearest row is returned (clamped to the
+ * first/last row, gaps resolve to the row above) — used for range selection and paging.
+ */
+int ListView::uniformRowAt(int contentY, bool exact) const {
+    ensureRowLayout();
+    const int count = m_layoutRowCount;
+    if (count == 0) return -1;
+
+    const int s = spacing();
+    const int stride = m_layoutRowHeight + s;
+    const int hh = m_layoutHeaderHeight;
+
+    // Locate the section segment: last k with top(starts[k]) <= y
+    int lo = 0, hi = int(m_sectionStarts.size());
+    while (lo < hi) {
+        const int mid = (lo + hi) / 2;
+        const int top = s + m_sectionStarts.at(mid) * stride + mid * hh;
+        if (top <= contentY) lo = mid + 1; else hi = mid;
+    }
+    const int k = lo - 1;
+
+    int begin = 0, end = count, segTop = s, head = 0;
+    if (k >= 0) {
+        begin = m_sectionStarts.at(k);
+        end = k + 1 < m_sectionStarts.size() ? m_sectionStarts.at(k + 1) : count;
+        segTop = s + begin * stride + k * hh;
+        head = hh;
+    } else if (!m_sectionStarts.isEmpty()) {
+        end = m_sectionStarts.first();
+    }
+
+    const int local = contentY - segTop;
+    if (local < 0)
+        return exact ? -1 : 0;
+    if (local < head)
+        return begin;   // inside the section header band of the start row
+
+    const int offset = local - head;
+    const int row = begin + offset / stride;
+    if (row >= end)
+        return exact ? -1 : end - 1;  // trailing spacing of the segment
+    if (exact && offset % stride >= m_layoutRowHeight)
+        return -1;      // spacing gap between rows
+    return row;
+}
+
+QRect ListView::itemRect(const QModelIndex& index) const {
+    if (!usesUniformRows())
+        return QListView::visualRect(index);
+    if (!index.isValid() || index.parent() != rootIndex() || index.column() != 0)
+        return {};
+    return uniformRowRect(index.row()).translated(-horizontalOffset(), -verticalOffset());
+}
+
+void ListView::setModel(QAbstractItemModel* model) {
+    for (const auto& c : m_modelConnections)
+        disconnect(c);
+    m_modelConnections.clear();
+
+    QListView::setModel(model);
+
+    if (model) {
+        m_modelConnections
+            << connect(model, &QAbstractItemModel::rowsInserted, this, &ListView::onSectionRowsInserted)
+            << connect(model, &QAbstractItemModel::rowsRemoved, this, &ListView::onSectionRowsRemoved)
+            << connect(model, &QAbstractItemModel::rowsMoved, this, [this]() { invalidateSectionIndex(); })
+            << connect(model, &QAbstractItemModel::layoutChanged, this, [this]() { invalidateSectionIndex(); })
+            << connect(model, &QAbstractItemModel::modelReset, this, [this]() { invalidateSectionIndex(); });
+    }
+    invalidateSectionIndex();
+    m_loading->refresh();
+}
+
+QModelIndex ListView::indexAt(const QPoint& point) const {
+    if (!usesUniformRows())
+        return QListView::indexAt(point);
+    const int row = uniformRowAt(point.y() + verticalOffset(), true);
+    if (row < 0) return {};
+    const QModelIndex idx = model()->index(row, 0, rootIndex());
+    return itemRect(idx).contains(point) ? idx : QModelIndex();
+}
+
+void ListView::doItemsLayout() {
+    if (!usesUniformRows()) {
+        QListView::doItemsLayout();
+        return;
+    }
+    // Skip QListView's per-row layout; geometry comes from the uniform row index
+    m_rowLayoutDirty = true;
+    QAbstractItemView::doItemsLayout();
+}
+
+void ListView::updateGeometries() {
+    if (!usesUniformRows()) {
+        QListView::updateGeometries();
+        return;
+    }
+    QAbstractItemView::updateGeometries();
+    ensureRowLayout();
+
+    const int vh = viewport()->height();
+    auto* vsb = verticalScrollBar();
+    vsb->setSingleStep(m_layoutRowHeight + spacing());
+    vsb->setPageStep(vh);
+    vsb->setRange(0, qMax(0, uniformContentHeight() - vh));
+    horizontalScrollBar()->setRange(0, 0);
+}
+
+void ListView::scrollTo(const QModelIndex& index, ScrollHint hint) {
+    if (!usesUniformRows()) {
+        QListView::scrollTo(index, hint);
+        return;
+    }
+    if (!index.isValid() || index.parent() != rootIndex()) return;
+
+    const int s = spacing();
+    const QRect r = uniformRowRect(index.row()).adjusted(0, -s, 0, s);
+    if (r.isNull()) return;
+
+    auto* vsb = verticalScrollBar();
+    const int vh = viewport()->height();
+    const int current = vsb->value();
+    int value = current;
+    switch (hint) {
+    case EnsureVisible:
+        if (r.top() < current || r.height() > vh)
+            value = r.top();
+        else if (r.bottom() >= current + vh)
+            value = r.bottom() - vh + 1;
+        break;
+    case PositionAtTop:
+        value = r.top();
+        break;
+    case PositionAtBottom:
+        value = r.bottom() - vh + 1;
+        break;
+    case PositionAtCenter:
+        value = r.center().y() - vh / 2;
+        break;
+    }
+    vsb->setValue(value);
+}
+
+QModelIndex ListView::moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers) {
+    if (!usesUniformRows())
+        return QListView::moveCursor(cursorAction, modifiers);
+
+    ensureRowLayout();
+    const int count = m_layoutRowCount;
+    if (count == 0) return {};
+
+    const QModelIndex current = currentIndex();
+    const int row = current.isValid() ? current.row() : -1;
+    const int vh = viewport()->height();
+    int target = row;
+    switch (cursorAction) {
+    case MoveUp:
+    case MovePrevious:
+        target = row < 0 ? 0 : row - 1;
+        break;
+    case MoveDown:
+    case MoveNext:
+        target = row + 1;
+        break;
+    case MoveHome:
+        target = 0;
+        break;
+    case MoveEnd:
+        target = count - 1;
+        break;
+    case MovePageUp:
+        target = row < 0 ? 0 : uniformRowAt(uniformRowRect(row).top() - vh, false);
+        break;
+    case MovePageDown:
+        target = row < 0 ? 0 : uniformRowAt(uniformRowRect(row).top() + vh, false);
+        break;
+    case MoveLeft:
+    case MoveRight:
+        target = row < 0 ? 0 : row;
+        break;
+    }
+    return model()->index(qBound(0, target, count - 1), 0, rootIndex());
+}
+
+void ListView::setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) {
+    if (!usesUniformRows()) {
+        QListView::setSelection(rect, command);
+        return;
+    }
+    if (!selectionModel()) return;
+
+    const QRect r = rect.normalized();
+    const int offset = verticalOffset();
+    const int contentTop = r.top() + offset;
+    const int contentBottom = r.bottom() + offset;
+    QItemSelection selection;
+    if (contentBottom >= 0 && contentTop < uniformContentHeight()) {
+        const int top = uniformRowAt(contentTop, false);
+        const int bottom = uniformRowAt(contentBottom, false);
+        selection.select(model()->index(top, 0, rootIndex()),
+                         model()->index(bottom, 0, rootIndex()));
+    }
+    selectionModel()->select(selection, command);
+}
+
+QRegion ListView::visualRegionForSelection(const QItemSelection& selection) const {
+    if (!usesUniformRows())
+        return QListView::visualRegionForSelection(selection);
+
+    // One rect per selected range, clipped to the viewport (no per-row iteration)
+    const QRect viewportRect = viewport()->rect();
+    QRegion region;
+    for (const QItemSelectionRange& range : selection) {
+        if (!range.isValid() || range.parent() != rootIndex() || range.left() > 0) continue;
+        const QRect top = itemRect(model()->index(range.top(), 0, rootIndex()));
+        const QRect bottom = itemRect(model()->index(range.bottom(), 0, rootIndex()));
+        region += QRect(top.topLeft(), bottom.bottomRight()) & viewportRect;
+    }
+    return region;
+}
+
+void ListView::dataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                           const QVector<int>& roles) {
+    // Section keys are derived from row data: re-evaluate the changed rows and the row after
+    if (!m_sectionIndexDirty && sectionIndexActive() && topLeft.parent() == rootIndex()) {
+        if (rescanSections(topLeft.row(), bottomRight.row() + 1))
+            onSectionsChanged();
+    }
+    QListView::dataChanged(topLeft, bottomRight, roles);
+}
+
+void ListView::paintUniformRows(QPaintEvent* event) {
+    ensureRowLayout();
+    QAbstractItemDelegate* del = itemDelegate();
+    if (m_layoutRowCount == 0 || !del) return;
+
+    const QRect area = event->rect();
+    const int offset = verticalOffset();
+    int first = uniformRowAt(area.top() + offset, false);
+    int last = uniformRowAt(area.bottom() + offset, false);
+    if (m_paintingWithOffsets) {
+        // Drag displacement shifts rows by at most one row height
+        first = qMax(0, first - 1);
+        last = qMin(m_layoutRowCount - 1, last + 1);
+    }
+
+    QStyleOptionViewItem opt;
+    FLUENT_INIT_VIEW_ITEM_OPTION(&opt);
+    const QStyle::State baseState = opt.state;
+
+    const QModelIndex current = currentIndex();
+    const bool showFocus = hasFocus() && current.isValid();
+    const QModelIndex hover = viewport()->underMouse()
+        ? indexAt(viewport()->mapFromGlobal(QCursor::pos())) : QModelIndex();
+    const QItemSelectionModel* sel = selectionModel();
+
+    QPainter painter(viewport());
+    for (int row = first; row <= last; ++row) {
+        const QModelIndex idx = model()->index(row, 0, rootIndex());
+        opt.rect = visualRect(idx);
+        if (!opt.rect.intersects(area)) continue;
+        opt.state = baseState;
+        if (sel && sel->isSelected(idx)) opt.state |= QStyle::State_Selected;
+        if (idx == hover) opt.state |= QStyle::State_MouseOver;
+        if (showFocus && idx == current) opt.state |= QStyle::State_HasFocus;
+        del->paint(&painter, opt, idx);
+    }
+}
+
 // ── Selection API ─────────────────────────────────────────────────────────────
 
 int ListView::selectedIndex() const {
@@ -495,7 +1071,7 @@ QPixmap ListView::renderItemPixmap(int row) const {
         return {};
 
     QModelIndex idx = model()->index(row, 0);
-    QRect rect = QListView::visualRect(idx);
+    QRect rect = itemRect(idx);
     if (rect.isEmpty()) return {};
 
     // Use full viewport width for the snapshot so it looks like the real row.
@@ -536,15 +1112,18 @@ int ListView::dropIndicatorRow(const QPoint& pos) const {
 
     // During drag, use displaced visual positions for hit testing
     // so the indicator follows the actual visual layout.
+    // Only rows in the displacement window can be under the cursor.
     if (m_isDragging) {
-        for (int i = 0; i < count; ++i) {
+        int first = 0, last = count - 1;
+        dragRowWindow(&first, &last);
+        for (int i = first; i <= last; ++i) {
             if (i == m_dragSourceRow) continue;
-            QRect rect = QListView::visualRect(model()->index(i, 0));
-            rect.translate(0, qRound(m_dragOffsets.value(i, 0.0)));
+            QRect rect = itemRect(model()->index(i, 0));
+            rect.translate(0, qRound(m_displacement->offset(i).y()));
             if (pos.y() < rect.center().y())
                 return i;
         }
-        return count;
+        return last + 1;
     }
 
     // Non-drag: standard hit test
@@ -575,22 +1154,39 @@ void ListView::paintEvent(QPaintEvent* event) {
         QPainter ph(viewport());
         ph.setRenderHint(QPainter::Antialiasing);
         ph.setPen(c.textTertiary);
-        ph.setFont(themeFont(m_fontRole).toQFont());
+        ph.setFont(themeQFont(m_fontRole));
         ph.drawText(viewport()->rect(), Qt::AlignCenter, m_placeholderText);
         ph.end();
     }
 
     // --- 3. 绘制列表项（QListView 默认绘制） ---
     // 拖拽时应用位移偏移：通过 visualRect override 临时返回偏移后的矩形
-    m_paintingWithOffsets = !m_dragOffsets.isEmpty();
-    QListView::paintEvent(event);
+    m_paintingWithOffsets = !m_displacement->isEmpty();
+    if (usesUniformRows())
+        paintUniformRows(event);
+    else
+        QListView::paintEvent(event);
     m_paintingWithOffsets = false;
 
-    // --- 3.5 Section headers are now handled by SectionProxyDelegate ---
+    // --- 3.1 加载中行的骨架占位（增量加载） ---
+    if (m_loading->isEnabled()) {
+        QPainter lp(viewport());
+        m_loading->paintPlaceholders(&lp, c);
+        lp.end();
+    }
+
+    // --- 3.5 Section headers are handled by SectionProxyDelegate; only the sticky one is drawn here ---
+    int stickySection = -1;
+    const QRect stickyRect = stickyHeaderRect(&stickySection);
+    if (!stickyRect.isEmpty()) {
+        QPainter sp(viewport());
+        paintSectionHeader(&sp, stickyRect, sectionKey(stickySection));
+        sp.end();
+    }
 
     // --- 3.6 绘制拖拽指示线 ---
     if (m_isDragging && m_dropTargetRow >= 0 && model()) {
-        m_paintingWithOffsets = !m_dragOffsets.isEmpty();
+        m_paintingWithOffsets = !m_displacement->isEmpty();
         QPainter dp(viewport());
         dp.setRenderHint(QPainter::Antialiasing);
 
@@ -670,6 +1266,7 @@ void ListView::resizeEvent(QResizeEvent* event) {
     syncFluentHScrollBar();
     layoutHeader();
     layoutFooter();
+    m_loading->refresh();
 }
 
 void ListView::showEvent(QShowEvent* event) {
@@ -691,6 +1288,7 @@ void ListView::showEvent(QShowEvent* event) {
 
 bool ListView::isPointInSectionHeader(const QPoint& viewportPos) const {
     if (!m_sectionEnabled || !m_sectionProxy) return false;
+    if (stickyHeaderRect().contains(viewportPos)) return true;
 
     auto* proxy = static_cast<SectionProxyDelegate*>(m_sectionProxy);
     if (!proxy) return false;
@@ -859,8 +1457,7 @@ void ListView::wheelEvent(QWheelEvent* event) {
         if (boundaryDir == 0)
             return;
         if (m_noPhaseBoundaryDir == boundaryDir &&
-            (m_noPhaseBounceArmed ||
-             (m_bounceAnim && m_bounceAnim->state() == QAbstractAnimation::Running))) {
+            (m_noPhaseBounceArmed || isBouncing())) {
             return;
         }
 
@@ -910,8 +1507,7 @@ void ListView::wheelEvent(QWheelEvent* event) {
                 return;
             }
 
-            if (m_bounceAnim && m_bounceAnim->state() == QAbstractAnimation::Running)
-                m_bounceAnim->stop();
+            stopBounce();
             if (m_bounceTimer)
                 m_bounceTimer->stop();
             overscroll = 0.0;
@@ -947,7 +1543,7 @@ void ListView::wheelEvent(QWheelEvent* event) {
 
     // ── 1. Already overscrolled ──────────────────────────────────────────
     if (!qFuzzyIsNull(overscroll)) {
-        if (m_bounceAnim && m_bounceAnim->state() == QAbstractAnimation::Running) {
+        if (isBouncing()) {
             // Bounce in progress: NoPhasePixel events are stale residuals — consume them so
             // the bounce animation completes smoothly. NoPhaseDiscrete reverse recovery is
             // handled by the normal-scroll-first path above. Only PhaseBased (native macOS
@@ -956,7 +1552,7 @@ void ListView::wheelEvent(QWheelEvent* event) {
                 event->accept();
                 return;
             }
-            m_bounceAnim->stop();
+            stopBounce();
         }
         if (m_bounceTimer) m_bounceTimer->stop();
 
@@ -1023,6 +1619,18 @@ void ListView::wheelEvent(QWheelEvent* event) {
     syncFluentScrollBars();
 }
 
+void ListView::scrollContentsBy(int dx, int dy) {
+    QListView::scrollContentsBy(dx, dy);
+    // Rows scrolled into view during a drag need their displacement too
+    if (m_isDragging && dy != 0)
+        updateDragDisplacement();
+    // The sticky header is pinned to the viewport: a scrolled blit would drag it along
+    if (m_stickySectionHeader && m_sectionProxy && dy != 0)
+        viewport()->update();
+    // Rows scrolled into view may need fetching; far-away requests get cancelled by the model
+    m_loading->refresh();
+}
+
 int ListView::verticalOffset() const {
     return QListView::verticalOffset() - qRound(m_overscrollY);
 }
@@ -1032,14 +1640,14 @@ int ListView::horizontalOffset() const {
 }
 
 QRect ListView::visualRect(const QModelIndex& index) const {
-    QRect r = QListView::visualRect(index);
+    QRect r = itemRect(index);
     if (m_paintingWithOffsets && index.isValid()) {
         if (m_isDragging && index.row() == m_dragSourceRow) {
             // Hide source row: move off-screen so QListView won't paint it
             r.moveTop(-r.height() * 2);
             return r;
         }
-        r.translate(0, qRound(m_dragOffsets.value(index.row(), 0.0)));
+        r.translate(0, qRound(m_displacement->offset(index.row()).y()));
     }
     return r;
 }
@@ -1055,18 +1663,35 @@ void ListView::resetNoPhaseBoundaryBounce() {
     m_noPhaseBounceArmed = false;
 }
 
+// The bounce-back tween is keyed per view on the shared scheduler
+namespace {
+enum : quintptr { BounceTween };
+}
+
 void ListView::startBounceBack() {
-    if (!m_bounceAnim) return;
     const qreal val = (flow() == LeftToRight) ? m_overscrollX : m_overscrollY;
     if (qFuzzyIsNull(val)) {
         resetNoPhaseBoundaryBounce();
         return;
     }
     resetNoPhaseCluster();
-    m_bounceAnim->stop();
-    m_bounceAnim->setStartValue(val);
-    m_bounceAnim->setEndValue(0.0);
-    m_bounceAnim->start();
+    // The shared scheduler writes the overscroll each frame and batches the viewport repaint
+    qreal* overscroll = (flow() == LeftToRight) ? &m_overscrollX : &m_overscrollY;
+    ::Animation::Scheduler::instance().animate(
+        this, BounceTween, val, 0.0, ::Animation::Duration::Normal, ::Animation::EasingType::Decelerate,
+        [overscroll](qreal v) { *overscroll = v; }, viewport(),
+        [this]() {
+            resetNoPhaseCluster();
+            resetNoPhaseBoundaryBounce();
+        });
+}
+
+bool ListView::isBouncing() const {
+    return ::Animation::Scheduler::instance().isRunning(this, BounceTween);
+}
+
+void ListView::stopBounce() {
+    ::Animation::Scheduler::instance().cancel(this, BounceTween);
 }
 
 // paintSectionHeaders() removed — section headers are now painted by SectionProxyDelegate
@@ -1086,6 +1711,7 @@ void ListView::onThemeUpdated() {
 
 void ListView::applyThemeStyle() {
     const auto& c = themeColors();
+    ItemPaintCache::invalidateStyle(m_paintCache);
 
     QPalette pal = palette();
     pal.setColor(QPalette::Base, Qt::transparent);
@@ -1095,7 +1721,8 @@ void ListView::applyThemeStyle() {
     pal.setColor(QPalette::HighlightedText, c.textPrimary);
     setPalette(pal);
 
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
+    invalidateRowLayout();   // 行高 / section header 高度随字体变化
 
     if (viewport()) {
         viewport()->setAutoFillBackground(false);
@@ -1108,7 +1735,7 @@ void ListView::applyThemeStyle() {
     // Header label theme (only for internally-created labels)
     if (m_ownsHeader) {
         if (auto* lbl = qobject_cast<QLabel*>(m_header)) {
-            lbl->setFont(themeFont(Typography::FontRole::Subtitle).toQFont());
+            lbl->setFont(themeQFont(Typography::FontRole::Subtitle));
             QPalette hpal = lbl->palette();
             hpal.setColor(QPalette::WindowText, c.textPrimary);
             lbl->setPalette(hpal);
@@ -1118,7 +1745,7 @@ void ListView::applyThemeStyle() {
     // Footer label theme (only for internally-created labels)
     if (m_ownsFooter) {
         if (auto* lbl = qobject_cast<QLabel*>(m_footer)) {
-            lbl->setFont(themeFont(Typography::FontRole::Caption).toQFont());
+            lbl->setFont(themeQFont(Typography::FontRole::Caption));
             QPalette fpal = lbl->palette();
             fpal.setColor(QPalette::WindowText, c.textSecondary);
             lbl->setPalette(fpal);
@@ -1229,21 +1856,50 @@ void ListView::refreshFluentScrollChrome() {
 
 // ── Drag displacement animation ───────────────────────────────────────────────
 
+void ListView::dragRowWindow(int* first, int* last) const {
+    const int count = model() ? model()->rowCount(rootIndex()) : 0;
+    *first = 0;
+    *last = count - 1;
+    if (count == 0) return;
+
+    int top = -1, bottom = -1;
+    const int vh = viewport()->height();
+    if (usesUniformRows()) {
+        top = uniformRowAt(verticalOffset(), false);
+        bottom = uniformRowAt(verticalOffset() + vh - 1, false);
+    } else {
+        // A probe may land in the spacing gap between rows; a second probe one gap away cannot
+        const int x = viewport()->width() / 2;
+        const int s = spacing();
+        QModelIndex idx = indexAt(QPoint(x, 0));
+        if (!idx.isValid()) idx = indexAt(QPoint(x, s));
+        top = idx.row();
+        idx = indexAt(QPoint(x, vh - 1));
+        if (!idx.isValid()) idx = indexAt(QPoint(x, vh - 1 - s));
+        bottom = idx.row();
+    }
+    if (top >= 0) *first = qMax(0, top - kDragDisplacementMarginRows);
+    if (bottom >= 0) *last = qMin(count - 1, bottom + kDragDisplacementMarginRows);
+}
+
 void ListView::updateDragDisplacement() {
     if (m_dragSourceRow < 0 || m_dropTargetRow < 0 || !model()) {
         clearDragAnimations();
         return;
     }
 
-    const int itemCount = model()->rowCount();
     const int src = m_dragSourceRow;
     const int dst = m_dropTargetRow;
 
     // Use the actual source row height for displacement amount
-    const int srcH = QListView::visualRect(model()->index(src, 0)).height();
+    const int srcH = itemRect(model()->index(src, 0)).height();
     if (srcH <= 0) return;
 
-    for (int i = 0; i < itemCount; ++i) {
+    int first = 0, last = -1;
+    dragRowWindow(&first, &last);
+    m_displacement->setRange(first, last);
+
+    for (int i = first; i <= last; ++i) {
         qreal target = 0.0;
         if (i == src) {
             // Source item: no displacement (follows cursor via drag pixmap)
@@ -1255,52 +1911,13 @@ void ListView::updateDragDisplacement() {
             // Source moves up: items between [dst, src) shift down
             target = srcH;
         }
-
-        const qreal current = m_dragOffsets.value(i, 0.0);
-        if (qFuzzyCompare(current, target) && !m_dragAnims.contains(i)) {
-            continue;
-        }
-
-        if (auto* oldAnim = m_dragAnims.value(i)) {
-            oldAnim->stop();
-            oldAnim->deleteLater();
-            m_dragAnims.remove(i);
-        }
-
-        if (qFuzzyCompare(current, target)) {
-            continue;
-        }
-
-        auto* anim = new QVariantAnimation(this);
-        anim->setStartValue(current);
-        anim->setEndValue(target);
-        anim->setDuration(::Animation::Duration::Fast);
-        anim->setEasingCurve(::Animation::getEasing(::Animation::EasingType::Decelerate));
-        connect(anim, &QVariantAnimation::valueChanged, this, [this, i](const QVariant& v) {
-            m_dragOffsets[i] = v.toReal();
-            viewport()->update();
-        });
-        connect(anim, &QVariantAnimation::finished, this, [this, i, target]() {
-            m_dragOffsets[i] = target;
-            if (auto* a = m_dragAnims.value(i)) {
-                a->deleteLater();
-                m_dragAnims.remove(i);
-            }
-        });
-        m_dragAnims[i] = anim;
-        anim->start(QAbstractAnimation::DeleteWhenStopped);
+        m_displacement->setTarget(i, QPointF(0.0, target));
     }
+    viewport()->update();
 }
 
 void ListView::clearDragAnimations() {
-    for (auto it = m_dragAnims.begin(); it != m_dragAnims.end(); ++it) {
-        if (it.value()) {
-            it.value()->stop();
-            it.value()->deleteLater();
-        }
-    }
-    m_dragAnims.clear();
-    m_dragOffsets.clear();
+    m_displacement->clear();
     viewport()->update();
 }
 
@@ -3,6 +3,7 @@
 
 #include <QListView>
 #include <QHash>
+#include <QVector>
 #include <functional>
 
 #include "view/FluentElement.h"
@@ -13,7 +14,6 @@ class QPaintEvent;
 class QResizeEvent;
 class QShowEvent;
 class QTimer;
-class QVariantAnimation;
 class QWheelEvent;
 class QPropertyAnimation;
 
@@ -21,6 +21,10 @@ namespace view::scrolling { class ScrollBar; }
 
 namespace view::collections {
 
+class DragDisplacement;
+class IncrementalLoading;
+class ItemPaintCache;
+
 /**
  * Fluent 列表视图（仅视图层）。
  *
@@ -70,6 +74,30 @@ public:
     Q_PROPERTY(bool canReorderItems READ canReorderItems WRITE setCanReorderItems NOTIFY canReorderItemsChanged)
     /** Section 分组回调：给定行号返回分组标题；标题相同的连续行归入同一 section */
     Q_PROPERTY(bool sectionEnabled READ sectionEnabled WRITE setSectionEnabled NOTIFY sectionEnabledChanged)
+    /** 滚动时将当前 section 的标题吸附在视口顶部，下一 section 到达时被顶出 */
+    Q_PROPERTY(bool stickySectionHeader READ stickySectionHeader WRITE setStickySectionHeader NOTIFY stickySectionHeaderChanged)
+    /**
+     * 虚拟化均匀行模式（类似 uniformItemSizes）：所有行同高，section 首行额外叠加 header 高度。
+     * 不再逐行询问 delegate sizeHint；布局、滚动、visualRect / indexAt 均为 O(log n)。
+     * 仅对 TopToBottom 且不换行的列表生效；该模式下忽略 setRowHidden。
+     */
+    Q_PROPERTY(bool virtualized READ isVirtualized WRITE setVirtualized NOTIFY virtualizedChanged)
+    /** 虚拟化模式下的统一行高（px）；0 表示取首行 delegate 的 sizeHint 高度 */
+    Q_PROPERTY(int uniformRowHeight READ uniformRowHeight WRITE setUniformRowHeight NOTIFY uniformRowHeightChanged)
+    /**
+     * 增量加载：按视口向 model 请求数据（见 IncrementalLoading / PagedListModel），
+     * ItemLoadingRole 为 true 的行绘制骨架占位；总数未知的 model 提前 fetchMore。
+     */
+    Q_PROPERTY(bool incrementalLoading READ incrementalLoading WRITE setIncrementalLoading NOTIFY incrementalLoadingChanged)
+    /** 增量加载时视口上下额外请求的行数 */
+    Q_PROPERTY(int prefetchDistance READ prefetchDistance WRITE setPrefetchDistance NOTIFY prefetchDistanceChanged)
+    /**
+     * item 绘制缓存：在当前 delegate 外包一层 ItemPaintCache，滚动时直接贴缓存位图。
+     * 启用后再 setItemDelegate 会替换掉缓存层，需重新开启。
+     */
+    Q_PROPERTY(bool paintCacheEnabled READ paintCacheEnabled WRITE setPaintCacheEnabled NOTIFY paintCacheEnabledChanged)
+    /** 绘制缓存上限（KB） */
+    Q_PROPERTY(int paintCacheBudget READ paintCacheBudget WRITE setPaintCacheBudget NOTIFY paintCacheBudgetChanged)
 
     explicit ListView(QWidget* parent = nullptr);
     ~ListView() override;
@@ -120,8 +148,48 @@ public:
     using SectionKeyFunc = std::function<QString(int row)>;
     bool sectionEnabled() const { return m_sectionEnabled; }
     void setSectionEnabled(bool enabled);
-    /** 设置分组 key 回调。相邻行返回相同 key 的归为一组，key 作为 section header 绘制。 */
+    /**
+     * 设置分组 key 回调。相邻行返回相同 key 的归为一组，key 作为 section header 绘制。
+     * 回调只在建立 / 增量更新 section 索引时调用（model 的行插入、删除、dataChanged），
+     * 绘制与布局不再调用；key 依赖的外部状态变化时需重新 setSectionKeyFunction。
+     */
     void setSectionKeyFunction(SectionKeyFunc func);
+    bool stickySectionHeader() const { return m_stickySectionHeader; }
+    void setStickySectionHeader(bool enabled);
+
+    // 以下 section 查询均为 O(log n)；未启用 section 时 sectionCount() 为 0
+    int sectionCount() const;
+    /** row 所属 section 序号；无 section 时返回 -1 */
+    int sectionForRow(int row) const;
+    int sectionStartRow(int section) const;
+    QString sectionKey(int section) const;
+    /** 跳转到指定 section：其首行（含 header）滚动到视口顶部 */
+    void scrollToSection(int section);
+
+    // --- Virtualization ---
+    bool isVirtualized() const { return m_virtualized; }
+    void setVirtualized(bool enabled);
+    int uniformRowHeight() const { return m_uniformRowHeight; }
+    void setUniformRowHeight(int height);
+
+    // --- Incremental loading ---
+    bool incrementalLoading() const;
+    void setIncrementalLoading(bool enabled);
+    int prefetchDistance() const;
+    void setPrefetchDistance(int rows);
+
+    // --- Paint cache ---
+    bool paintCacheEnabled() const { return m_paintCache != nullptr; }
+    void setPaintCacheEnabled(bool enabled);
+    int paintCacheBudget() const { return m_paintCacheBudget; }
+    void setPaintCacheBudget(int kilobytes);
+    /** 未启用时为 nullptr */
+    ItemPaintCache* paintCache() const { return m_paintCache; }
+
+    void setModel(QAbstractItemModel* model) override;
+    QModelIndex indexAt(const QPoint& point) const override;
+    void scrollTo(const QModelIndex& index, ScrollHint hint = EnsureVisible) override;
+    void doItemsLayout() override;
 
     // --- Selection API ---
     int selectedIndex() const;
@@ -151,6 +219,15 @@ signals:
     void placeholderTextChanged();
     void canReorderItemsChanged();
     void sectionEnabledChanged();
+    void stickySectionHeaderChanged();
+    void virtualizedChanged();
+    void uniformRowHeightChanged();
+    void incrementalLoadingChanged();
+    void prefetchDistanceChanged();
+    void paintCacheEnabledChanged();
+    void paintCacheBudgetChanged();
+    /** 增量加载请求的行范围（可见行 ± prefetchDistance）；无可见行时为 (-1, -1) */
+    void visibleRangeChanged(int first, int last);
     void itemClicked(int index);
     void itemReordered(int fromRow, int toRow);
 
@@ -165,9 +242,16 @@ protected:
     void enterEvent(FluentEnterEvent* event) override;
     void leaveEvent(QEvent* event) override;
     void wheelEvent(QWheelEvent* event) override;
+    void scrollContentsBy(int dx, int dy) override;
     int verticalOffset() const override;
     int horizontalOffset() const override;
     QRect visualRect(const QModelIndex& index) const override;
+    void updateGeometries() override;
+    QModelIndex moveCursor(CursorAction cursorAction, Qt::KeyboardModifiers modifiers) override;
+    void setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) override;
+    QRegion visualRegionForSelection(const QItemSelection& selection) const override;
+    void dataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                     const QVector<int>& roles = QVector<int>()) override;
 
     void onThemeUpdated() override;
 
@@ -183,15 +267,46 @@ private:
     void setViewportHovered(bool hovered);
     void updateViewportMargins();
     void startBounceBack();
+    bool isBouncing() const;
+    void stopBounce();
     void installSectionProxy();
+    /** 替换用户 delegate：section 代理存在时替换其内层，否则直接 setItemDelegate */
+    void replaceUserDelegate(QAbstractItemDelegate* delegate);
+    // --- Section index ---
+    bool sectionIndexActive() const;
+    void invalidateSectionIndex();
+    void ensureSectionIndex() const;
+    /** 重新计算 [from, to] 内的 section 起点并拼接回索引；返回索引是否变化 */
+    bool rescanSections(int from, int to) const;
+    void onSectionRowsInserted(const QModelIndex& parent, int first, int last);
+    void onSectionRowsRemoved(const QModelIndex& parent, int first, int last);
+    void onSectionsChanged();
+    bool isSectionStartRow(int row) const;
+    void paintSectionHeader(QPainter* painter, const QRect& rect, const QString& key) const;
+    /** 吸顶 header 的矩形（viewport 坐标）；无需吸顶时返回空矩形 */
+    QRect stickyHeaderRect(int* section = nullptr) const;
     bool isPointInSectionHeader(const QPoint& viewportPos) const;
     int dropIndicatorRow(const QPoint& pos) const;
     void updateDragDisplacement();
     void clearDragAnimations();
+    /** 拖拽位移参与的行区间：视口可见行 ± 边距 */
+    void dragRowWindow(int* first, int* last) const;
     QPixmap renderItemPixmap(int row) const;
     void resetNoPhaseCluster();
     void resetNoPhaseBoundaryBounce();
 
+    // --- Uniform row layout (virtualized mode) ---
+    bool usesUniformRows() const;
+    void invalidateRowLayout();
+    void ensureRowLayout() const;
+    int sectionsBefore(int row) const;
+    QRect uniformRowRect(int row) const;      // 内容坐标（未扣除滚动偏移）
+    int uniformRowAt(int contentY, bool exact) const;
+    int uniformContentHeight() const;
+    /** 不含拖拽位移的基础 item 矩形（viewport 坐标） */
+    QRect itemRect(const QModelIndex& index) const;
+    void paintUniformRows(QPaintEvent* event);
+
     ListSelectionMode m_selectionMode = ListSelectionMode::Single;
     QString m_fontRole;
 
@@ -218,8 +333,7 @@ private:
     QPoint m_dragStartPos;
     QPoint m_dragCurrentPos;
     QPixmap m_dragPixmap;
-    QHash<int, qreal>              m_dragOffsets;  // row → 当前 Y 位移 px
-    QHash<int, QVariantAnimation*> m_dragAnims;    // row → 位移动画
+    DragDisplacement* m_displacement = nullptr;    // 可见区间内各行的 Y 位移
     mutable bool m_paintingWithOffsets = false;
 
     // --- Section ---
@@ -227,11 +341,33 @@ private:
     SectionKeyFunc m_sectionKeyFunc;
     QAbstractItemDelegate* m_sectionProxy = nullptr;
     QAbstractItemDelegate* m_userDelegate = nullptr;
+    bool m_stickySectionHeader = false;
+    // Section 索引：升序的 section 首行 + 每个 section 的 key（每组只存一份）
+    mutable bool m_sectionIndexDirty = true;
+    mutable QVector<int> m_sectionStarts;
+    mutable QVector<QString> m_sectionKeys;
+    QVector<QMetaObject::Connection> m_modelConnections;
+
+    // --- Virtualization ---
+    // 行 r 的顶边 = spacing + r * (rowHeight + spacing) + sectionsBefore(r) * headerHeight，
+    // 即 section 索引（有序首行）+ 统一 header 高度构成隐式前缀和，查找均为二分。
+    bool m_virtualized = false;
+    int  m_uniformRowHeight = 0;
+    mutable bool m_rowLayoutDirty = true;
+    mutable int  m_layoutRowCount = 0;
+    mutable int  m_layoutRowHeight = 0;
+    mutable int  m_layoutHeaderHeight = 0;
+
+    // --- Incremental loading ---
+    IncrementalLoading* m_loading = nullptr;
+
+    // --- Paint cache ---
+    ItemPaintCache* m_paintCache = nullptr;
+    int m_paintCacheBudget = 32 * 1024;
 
     // --- Overscroll bounce ---
     qreal m_overscrollY = 0.0;
     qreal m_overscrollX = 0.0;
-    QVariantAnimation* m_bounceAnim = nullptr;
     QTimer* m_bounceTimer = nullptr;
 
     // --- Cross-platform wheel input (see openspec listview-cross-platform-input) ---
@@ -0,0 +1,143 @@
+#include "TreeRowIndex.h"
+
+#include <QAbstractItemModel>
+#include <QVector>
+#include <climits>
+
+namespace view::collections {
+
+void TreeRowIndex::invalidate() {
+    m_valid = false;
+    m_rows.clear();
+}
+
+void TreeRowIndex::rebuild(const QAbstractItemModel* model, const QModelIndex& root) {
+    invalidate();
+    m_model = model;
+    m_root = root;
+    if (model) collectSubtree(root, -1, 0, 0, m_rows);
+    // 同 QTreeView::uniformRowHeights：只测量首行
+    m_rowHeight = !m_rows.empty() && m_source.rowHeight ? qMax(0, m_source.rowHeight(m_rows.front().index)) : 0;
+    m_valid = true;
+}
+
+QModelIndex TreeRowIndex::parentIndex(int i) const {
+    const int parent = m_rows[i].parent;
+    return parent >= 0 ? m_rows[parent].index : m_root;
+}
+
+void TreeRowIndex::collectSubtree(const QModelIndex& parent, int parentRow, int depth, int base,
+                                  std::vector<Row>& rows) {
+    // 显式栈代替递归：很深的树也不会耗尽调用栈
+    struct Frame {
+        QModelIndex parent;
+        int parentRow;
+        int depth;
+        int next;
+        int count;
+    };
+    QVector<Frame> stack;
+    stack.append({ parent, parentRow, depth, 0, m_model->rowCount(parent) });
+    while (!stack.isEmpty()) {
+        Frame& top = stack.last();
+        if (top.next >= top.count) {
+            stack.removeLast();
+            continue;
+        }
+        const int r = top.next++;
+        if (m_source.isRowHidden && m_source.isRowHidden(r, top.parent)) continue;
+
+        Row row;
+        row.index = m_model->index(r, 0, top.parent);
+        row.parent = top.parentRow;
+        row.depth = top.depth;
+        row.expanded = m_source.isExpanded && m_source.isExpanded(row.index);
+        rows.push_back(row);
+        // 入栈会使 top 失效，放在最后
+        if (row.expanded)
+            stack.append({ row.index, base + int(rows.size()) - 1, row.depth + 1, 0, m_model->rowCount(row.index) });
+    }
+}
+
+int TreeRowIndex::ancestorAtDepth(int i, int depth) const {
+    while (i >= 0 && m_rows[i].depth > depth) i = m_rows[i].parent;
+    return i >= 0 && m_rows[i].depth == depth ? i : -1;
+}
+
+int TreeRowIndex::rowOf(const QModelIndex& index) const {
+    if (!index.isValid() || index.model() != m_model || m_rows.empty()) return -1;
+
+    // 从 root 到 index 的祖先链（第 0 列）
+    QVector<int> path;
+    QModelIndex node = index.sibling(index.row(), 0);
+    for (; node.isValid() && node != m_root; node = node.parent()) path.append(node.row());
+    if (node != m_root) return -1;
+
+    // 父节点的可见后代紧跟其后，其中同层行按模型行号递增；子树之后的行视为“更大”。
+    // 因此每层都能在 [父行 + 1, count) 上二分
+    int parent = -1;
+    for (int depth = 0; depth < path.size(); ++depth) {
+        const int target = path.at(path.size() - 1 - depth);
+        auto keyAt = [&](int i) {
+            const int sibling = ancestorAtDepth(i, depth);
+            if (sibling < 0 || m_rows[sibling].parent != parent) return INT_MAX;
+            return m_rows[sibling].index.row();
+        };
+        int lo = parent + 1;
+        int hi = count();
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (keyAt(mid) < target) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo >= count() || keyAt(lo) != target) return -1;
+        parent = ancestorAtDepth(lo, depth);   // 即 lo 本身：兄弟行排在其后代之前
+    }
+    return parent;
+}
+
+int TreeRowIndex::rowAt(int y) const {
+    if (y < 0 || y >= totalHeight()) return -1;
+    return y / m_rowHeight;
+}
+
+int TreeRowIndex::rowStartingAtOrAfter(int y) const {
+    if (y <= 0) return 0;
+    if (m_rowHeight <= 0) return count();
+    return qMin(count(), (y + m_rowHeight - 1) / m_rowHeight);
+}
+
+void TreeRowIndex::expand(int i) {
+    if (i < 0 || i >= count() || m_rows[i].expanded) return;
+    m_rows[i].expanded = true;
+
+    std::vector<Row> rows;
+    collectSubtree(m_rows[i].index, i, m_rows[i].depth + 1, i + 1, rows);
+    if (rows.empty()) return;
+
+    const int k = int(rows.size());
+    shiftParents(i + 1, i, k);
+    m_rows.insert(m_rows.begin() + i + 1, rows.begin(), rows.end());
+}
+
+void TreeRowIndex::collapse(int i) {
+    if (i < 0 || i >= count() || !m_rows[i].expanded) return;
+    m_rows[i].expanded = false;
+
+    int end = i + 1;
+    while (end < count() && m_rows[end].depth > m_rows[i].depth) ++end;
+    const int k = end - (i + 1);
+    if (k == 0) return;
+
+    m_rows.erase(m_rows.begin() + i + 1, m_rows.begin() + end);
+    shiftParents(i + 1, i, -k);
+}
+
+void TreeRowIndex::shiftParents(int from, int after, int delta) {
+    // 只有父行位于拼接点之后的行需要平移；拼接点及之前的父行号不变
+    for (int j = from; j < count(); ++j) {
+        if (m_rows[j].parent > after) m_rows[j].parent += delta;
+    }
+}
+
+} // namespace view::collections
@@ -0,0 +1,86 @@
+#ifndef TREEROWINDEX_H
+#define TREEROWINDEX_H
+
+#include <QModelIndex>
+#include <functional>
+#include <vector>
+
+class QAbstractItemModel;
+
+namespace view::collections {
+
+/**
+ * @brief TreeRowIndex - TreeView 可见行的扁平索引（深度优先顺序，统一行高）
+ *
+ * 与 QTreeView（uniformRowHeights）内部布局的可见行一一对应，但查询不再逐行遍历：
+ *   - rowOf(index)：沿祖先链逐层在兄弟区间内二分，O(depth · log n)
+ *   - rowTop(i) / rowAt(y) / rowStartingAtOrAfter(y)：按统一行高直接计算，O(1)
+ *
+ * 所有行取首行高度（同 QTreeView::uniformRowHeights），不逐行测量；行高不统一的视图不使用本索引。
+ * 展开 / 折叠通过 expand() / collapse() 拼接子树增量更新；模型结构变化、隐藏行等
+ * 其余情况由视图调用 invalidate()，下一次查询前整体 rebuild()。
+ * 保存的 QModelIndex 在模型结构变化后失效，因此视图须在结构信号中及时 invalidate()。
+ */
+class TreeRowIndex {
+public:
+    struct Row {
+        QModelIndex index;      ///< 第 0 列
+        int parent = -1;        ///< 父节点所在行；顶层为 -1
+        int depth = 0;          ///< 顶层为 0
+        bool expanded = false;
+    };
+
+    /** 视图状态回调（展开、隐藏行、行高均以视图为准；行高只询问首行） */
+    struct Source {
+        std::function<bool(const QModelIndex& index)> isExpanded;
+        std::function<bool(int row, const QModelIndex& parent)> isRowHidden;
+        std::function<int(const QModelIndex& index)> rowHeight;
+    };
+
+    void setSource(Source source) { m_source = std::move(source); }
+
+    bool isValid() const { return m_valid; }
+    void invalidate();
+    /** 按当前展开状态重建；行高取首个可见行的高度 */
+    void rebuild(const QAbstractItemModel* model, const QModelIndex& root);
+
+    int count() const { return int(m_rows.size()); }
+    const Row& row(int i) const { return m_rows[i]; }
+    /** 第 i 行顶边的内容坐标；i == count() 时为内容总高度 */
+    int rowTop(int i) const { return i * m_rowHeight; }
+    int rowHeight(int /*i*/) const { return m_rowHeight; }
+    int totalHeight() const { return count() * m_rowHeight; }
+    /** 第 i 行的父节点（顶层行为 root） */
+    QModelIndex parentIndex(int i) const;
+
+    /** index（任意列）所在行；祖先折叠、被隐藏或不在 root 之下时返回 -1 */
+    int rowOf(const QModelIndex& index) const;
+    /** 内容坐标 y 所在行；越界返回 -1 */
+    int rowAt(int y) const;
+    /** 顶边不小于 y 的第一行（可能为 count()） */
+    int rowStartingAtOrAfter(int y) const;
+
+    /** 第 i 行被展开：在其后插入可见后代 */
+    void expand(int i);
+    /** 第 i 行被折叠：移除其可见后代 */
+    void collapse(int i);
+
+private:
+    /** 按深度优先顺序收集 parent 的可见后代；首个收集到的行位于 base */
+    void collectSubtree(const QModelIndex& parent, int parentRow, int depth, int base,
+                        std::vector<Row>& rows);
+    /** row i 在 depth 层的祖先（含自身）；i 比 depth 更浅时返回 -1 */
+    int ancestorAtDepth(int i, int depth) const;
+    void shiftParents(int from, int after, int delta);
+
+    Source m_source;
+    const QAbstractItemModel* m_model = nullptr;
+    QModelIndex m_root;
+    bool m_valid = false;
+    int m_rowHeight = 0;
+    std::vector<Row> m_rows;
+};
+
+} // namespace view::collections
+
+#endif // TREEROWINDEX_H
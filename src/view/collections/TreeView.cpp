@@ -2,7 +2,10 @@
 
 #include <QAbstractItemModel>
 #include <QApplication>
+#include <QElapsedTimer>
+#include <QHeaderView>
 #include <QLabel>
+#include <QMimeData>
 #include <QMouseEvent>
 #include <QPainter>
 #include <QPainterPath>
@@ -13,15 +16,27 @@
 #include <QTimer>
 #include <QVariantAnimation>
 #include <QWheelEvent>
+#include <algorithm>
+#include <memory>
 
 #include "design/Animation.h"
 #include "design/CornerRadius.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
+#include "view/collections/IncrementalLoading.h"
+#include "view/collections/ItemPaintCache.h"
 #include "view/scrolling/ScrollBar.h"
+#include "view/status_info/ProgressRing.h"
 
 namespace view::collections {
 
+namespace {
+// Time slice per event-loop tick for the incremental expandAll(depthLimit)
+constexpr int kExpandAllBudgetMs = 8;
+// Scheduler key of the single tween that drives every chevron in m_chevronTweens
+constexpr quintptr kChevronClockKey = 1;
+} // namespace
+
 TreeView::TreeView(QWidget* parent)
     : QTreeView(parent) {
 
@@ -97,70 +112,41 @@ TreeView::TreeView(QWidget* parent)
         m_animParent = QPersistentModelIndex();
         viewport()->update();
     });
+    // Flattened row index mirrors the view's own expand / hidden / row-height state
+    m_rowIndex.setSource({
+        [this](const QModelIndex& index) { return isExpanded(index); },
+        [this](int row, const QModelIndex& parent) { return isRowHidden(row, parent); },
+        [this](const QModelIndex& index) { return indexRowSizeHint(index); },
+    });
+
     connect(this, &QTreeView::expanded, this, [this](const QModelIndex& idx) {
+        spliceRowIndex(idx, true);
+        scheduleLoadingUpdate();
+        // Batch expansion (expandAll(depthLimit)) skips per-node animation
+        if (!m_animEnabled) return;
         // Chevron rotation: 0 → 1
-        {
-            QPersistentModelIndex pi(idx);
-            if (m_chevronAnims.contains(pi)) {
-                m_chevronAnims[pi]->stop();
-                m_chevronAnims[pi]->deleteLater();
-                m_chevronAnims.remove(pi);
-            }
-            auto* ca = new QVariantAnimation(this);
-            ca->setDuration(::Animation::Duration::Normal);
-            ca->setEasingCurve(::Animation::getEasing(::Animation::EasingType::Decelerate));
-            ca->setStartValue(0.0);
-            ca->setEndValue(1.0);
-            m_chevronAnims.insert(pi, ca);
-            connect(ca, &QVariantAnimation::valueChanged, this, [this](const QVariant&) {
-                viewport()->update();
-            });
-            connect(ca, &QVariantAnimation::finished, this, [this, pi, ca]() {
-                m_chevronAnims.remove(pi);
-                ca->deleteLater();
-            });
-            ca->start(QAbstractAnimation::DeleteWhenStopped);
-        }
+        animateChevron(idx, 1.0);
         // Child reveal animation
-        if (!m_animEnabled) return;
-        m_animParent = QPersistentModelIndex(idx);
-        m_animExpanding = true;
-        m_expandRevealAnim->stop();
-        m_expandRevealAnim->setStartValue(0.0);
-        m_expandRevealAnim->setEndValue(1.0);
-        m_expandRevealAnim->start();
+        startRevealAnimation(idx);
     });
     connect(this, &QTreeView::collapsed, this, [this](const QModelIndex& idx) {
+        spliceRowIndex(idx, false);
         // Chevron rotation: 1 → 0
-        {
-            QPersistentModelIndex pi(idx);
-            if (m_chevronAnims.contains(pi)) {
-                m_chevronAnims[pi]->stop();
-                m_chevronAnims[pi]->deleteLater();
-                m_chevronAnims.remove(pi);
-            }
-            auto* ca = new QVariantAnimation(this);
-            ca->setDuration(::Animation::Duration::Normal);
-            ca->setEasingCurve(::Animation::getEasing(::Animation::EasingType::Decelerate));
-            ca->setStartValue(1.0);
-            ca->setEndValue(0.0);
-            m_chevronAnims.insert(pi, ca);
-            connect(ca, &QVariantAnimation::valueChanged, this, [this](const QVariant&) {
-                viewport()->update();
-            });
-            connect(ca, &QVariantAnimation::finished, this, [this, pi, ca]() {
-                m_chevronAnims.remove(pi);
-                ca->deleteLater();
-            });
-            ca->start(QAbstractAnimation::DeleteWhenStopped);
-        }
-        // Stop expand animation if active
-        if (m_animParent.isValid() && m_animParent == idx) {
+        animateChevron(idx, 0.0);
+        cancelChildLoading(idx);
+        scheduleLoadingUpdate();
+        // The recorded subtree range no longer matches the layout once anything collapses
+        if (m_animParent.isValid()) {
             m_expandRevealAnim->stop();
             m_animParent = QPersistentModelIndex();
         }
     });
 
+    m_expandAllTimer = new QTimer(this);
+    m_expandAllTimer->setSingleShot(true);
+    m_expandAllTimer->setInterval(0);
+    connect(m_expandAllTimer, &QTimer::timeout, this, &TreeView::processExpandAllQueue);
+
     syncFluentScrollBar();
     syncFluentHScrollBar();
     onThemeUpdated();
@@ -240,24 +226,123 @@ void TreeView::setPlaceholderText(const QString& text) {
 // ── Tree API ──────────────────────────────────────────────────────────────────
 
 void TreeView::expandAll() {
+    cancelExpandAll();
     m_animEnabled = false;
     // Stop all chevron animations and clear
-    for (auto* a : m_chevronAnims)
-        a->stop();
-    qDeleteAll(m_chevronAnims);
-    m_chevronAnims.clear();
+    clearChevronAnimations();
     QTreeView::expandAll();
     m_animEnabled = true;
+    m_rowIndex.invalidate();
+}
+
+void TreeView::expandAll(int depthLimit) {
+    cancelExpandAll();
+    if (!model() || depthLimit == 0) {
+        emit expandAllFinished();
+        return;
+    }
+    clearChevronAnimations();
+    m_expandDepthLimit = depthLimit;
+    m_expandingAll = true;
+    m_expandQueue.append({ QPersistentModelIndex(rootIndex()), 0, 0, model()->rowCount(rootIndex()) });
+    if (childrenPending(rootIndex())) {
+        m_expandWaiting.insert(QPersistentModelIndex(rootIndex()), 0);
+        if (model()->canFetchMore(rootIndex())) model()->fetchMore(rootIndex());
+    }
+    m_expandAllTimer->start();
+}
+
+void TreeView::cancelExpandAll() {
+    m_expandAllTimer->stop();
+    m_expandQueue.clear();
+    m_expandWaiting.clear();
+    m_expandingAll = false;
+}
+
+bool TreeView::isExpandingAll() const {
+    return m_expandingAll;
+}
+
+void TreeView::processExpandAllQueue() {
+    QAbstractItemModel* m = model();
+    if (!m) {
+        cancelExpandAll();
+        return;
+    }
+
+    // Breadth-first over a queue of parents; each tick expands as many children as fit the
+    // time slice, so a huge tree never blocks the event loop for longer than one slice.
+    // A pending delayed layout turns each expand into a set insertion; QTreeView then lays
+    // out (and fetches lazy children) once for the whole batch.
+    scheduleDelayedItemsLayout();
+    QElapsedTimer timer;
+    timer.start();
+    m_animEnabled = false;
+    while (!m_expandQueue.isEmpty() && timer.elapsed() < kExpandAllBudgetMs) {
+        ExpandTask& task = m_expandQueue.first();
+        if (task.depth > 0 && !task.parent.isValid()) {
+            m_expandQueue.removeFirst();   // node removed meanwhile
+            continue;
+        }
+        const QModelIndex parent(task.parent);
+        if (task.nextRow >= qMin(task.endRow, m->rowCount(parent))) {
+            // Later pages are normally requested when their placeholder scrolls into view;
+            // expandAll has to load the whole subtree, so ask for them right away
+            if (m_expandWaiting.contains(task.parent) && m->canFetchMore(parent)) m->fetchMore(parent);
+            m_expandQueue.removeFirst();
+            continue;
+        }
+        const QModelIndex child = m->index(task.nextRow++, 0, parent);
+        if (!m->hasChildren(child)) continue;
+
+        const int depth = task.depth + 1;   // copy before setExpanded: it may append to the queue
+        setExpanded(child, true);
+        if (m_expandDepthLimit > 0 && depth >= m_expandDepthLimit) continue;
+        // Rows present now are queued here; rows that arrive later are queued by onRowsInserted
+        const int known = m->rowCount(child);
+        if (known > 0)
+            m_expandQueue.append({ QPersistentModelIndex(child), depth, 0, known });
+        if (childrenPending(child)) {
+            m_expandWaiting.insert(QPersistentModelIndex(child), depth);
+            if (m->canFetchMore(child)) m->fetchMore(child);
+        }
+    }
+    m_animEnabled = true;
+
+    if (!m_expandQueue.isEmpty())
+        m_expandAllTimer->start();
+    else
+        finishExpandAllIfIdle();
+}
+
+bool TreeView::childrenPending(const QModelIndex& parent) const {
+    const QAbstractItemModel* m = model();
+    const int rows = m->rowCount(parent);
+    if (rows == 0) return m->canFetchMore(parent);
+    return m->index(rows - 1, 0, parent).data(ItemLoadingRole).toBool();
+}
+
+void TreeView::finishExpandAllIfIdle() {
+    if (!m_expandingAll || !m_expandQueue.isEmpty() || !m_expandWaiting.isEmpty()) return;
+    m_expandingAll = false;
+    emit expandAllFinished();
 }
 
 void TreeView::collapseAll() {
+    cancelExpandAll();
     m_animEnabled = false;
-    for (auto* a : m_chevronAnims)
-        a->stop();
-    qDeleteAll(m_chevronAnims);
-    m_chevronAnims.clear();
+    clearChevronAnimations();
     QTreeView::collapseAll();
     m_animEnabled = true;
+    m_rowIndex.invalidate();
+}
+
+void TreeView::expandToDepth(int depth) {
+    cancelExpandAll();
+    clearChevronAnimations();
+    // QTreeView relayouts in place without expanded() signals
+    QTreeView::expandToDepth(depth);
+    m_rowIndex.invalidate();
 }
 
 void TreeView::toggleExpanded(const QModelIndex& index) {
@@ -297,6 +382,351 @@ void TreeView::setSelectedItem(const QModelIndex& index) {
     return m_hScrollBar;
 }
 
+// ── On-demand children ────────────────────────────────────────────────────────
+
+void TreeView::setModel(QAbstractItemModel* newModel) {
+    cancelExpandAll();
+    for (const auto& c : std::as_const(m_modelConnections)) disconnect(c);
+    m_modelConnections.clear();
+    m_rowIndex.invalidate();
+    if (newModel) {
+        // The row index stores plain QModelIndex: drop it before QTreeView's own handlers
+        // (connected in QTreeView::setModel, hence after these) can query geometry mid-change
+        auto invalidate = [this]() { m_rowIndex.invalidate(); };
+        m_modelConnections
+            << connect(newModel, &QAbstractItemModel::rowsAboutToBeInserted, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::rowsInserted, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::rowsRemoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::rowsAboutToBeMoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::rowsMoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::columnsInserted, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::columnsRemoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::columnsMoved, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::layoutAboutToBeChanged, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::layoutChanged, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::modelAboutToBeReset, this, invalidate)
+            << connect(newModel, &QAbstractItemModel::modelReset, this, invalidate);
+    }
+    QTreeView::setModel(newModel);
+    if (newModel) {
+        m_modelConnections
+            << connect(newModel, &QAbstractItemModel::rowsInserted, this, &TreeView::onRowsInserted)
+            << connect(newModel, &QAbstractItemModel::rowsRemoved, this, &TreeView::onRowsRemoved)
+            << connect(newModel, &QAbstractItemModel::modelReset, this, &TreeView::scheduleLoadingUpdate)
+            << connect(newModel, &QAbstractItemModel::layoutChanged, this, &TreeView::scheduleLoadingUpdate);
+    }
+    scheduleLoadingUpdate();
+}
+
+void TreeView::onRowsInserted(const QModelIndex& parent, int first, int last) {
+    scheduleLoadingUpdate();
+    // A lazily loaded node that expandAll(depthLimit) is waiting on: keep descending
+    const auto it = m_expandWaiting.constFind(QPersistentModelIndex(parent));
+    if (it == m_expandWaiting.constEnd()) return;
+    m_expandQueue.append({ QPersistentModelIndex(parent), it.value(), first, last + 1 });
+    m_expandAllTimer->start();
+}
+
+void TreeView::onRowsRemoved(const QModelIndex& parent) {
+    scheduleLoadingUpdate();
+    // Last page arrived (placeholder removed) or the load failed
+    const QPersistentModelIndex key(parent);
+    if (m_expandWaiting.contains(key) && !childrenPending(parent)) {
+        m_expandWaiting.remove(key);
+        finishExpandAllIfIdle();
+    }
+}
+
+void TreeView::cancelChildLoading(const QModelIndex& index) {
+    if (m_expandWaiting.remove(QPersistentModelIndex(index)) > 0) finishExpandAllIfIdle();
+
+    // Duck-typed: models with a cancelFetch(QModelIndex) slot (e.g. LazyTreeModel) drop the
+    // in-flight requests of the collapsed subtree
+    QAbstractItemModel* m = model();
+    if (!m || m->metaObject()->indexOfMethod("cancelFetch(QModelIndex)") < 0) return;
+    QMetaObject::invokeMethod(m, "cancelFetch", Q_ARG(QModelIndex, index));
+}
+
+void TreeView::scheduleLoadingUpdate() {
+    if (m_loadingUpdateQueued) return;
+    m_loadingUpdateQueued = true;
+    QMetaObject::invokeMethod(this, [this]() { updateLoadingIndicators(); }, Qt::QueuedConnection);
+}
+
+void TreeView::updateLoadingIndicators() {
+    m_loadingUpdateQueued = false;
+    int used = 0;
+    QAbstractItemModel* m = model();
+    if (m && isVisible()) {
+        const QRect area = viewport()->rect();
+        for (QModelIndex idx = indexAt(area.topLeft() + QPoint(1, 1)); idx.isValid(); idx = indexBelow(idx)) {
+            const QRect r = visualRect(idx);
+            if (r.top() > area.bottom()) break;
+            if (!idx.data(ItemLoadingRole).toBool()) continue;
+
+            // Trailing placeholder scrolled into view: request the next page
+            const QModelIndex parent = idx.parent();
+            if (m->canFetchMore(parent)) m->fetchMore(parent);
+
+            if (used == m_loadingRings.size()) {
+                auto* ring = new ::view::status_info::ProgressRing(viewport());
+                ring->setRingSize(::view::status_info::ProgressRing::ProgressRingSize::Small);
+                ring->setAttribute(Qt::WA_TransparentForMouseEvents);
+                m_loadingRings.append(ring);
+            }
+            auto* ring = m_loadingRings.at(used++);
+            const QSize size = ring->sizeHint();
+            ring->setGeometry(QRect(QPoint(r.left() + ::Spacing::Padding::ListItemHorizontal,
+                                           r.center().y() - size.height() / 2 + 1), size));
+            ring->setIsActive(true);
+            ring->show();
+        }
+    }
+    for (int i = used; i < m_loadingRings.size(); ++i) {
+        m_loadingRings.at(i)->setIsActive(false);
+        m_loadingRings.at(i)->hide();
+    }
+}
+
+// ── Flattened row index ───────────────────────────────────────────────────────
+
+void TreeView::setRootIndex(const QModelIndex& index) {
+    m_rowIndex.invalidate();
+    QTreeView::setRootIndex(index);
+}
+
+void TreeView::doItemsLayout() {
+    // Every full relayout (hidden rows, delayed layouts, root changes) rebuilds the index lazily
+    m_rowIndex.invalidate();
+    QTreeView::doItemsLayout();
+}
+
+const TreeRowIndex* TreeView::rowIndex() const {
+    QAbstractItemModel* m = model();
+    // Per-row heights would have to be re-measured on every rebuild (dataChanged, inserts,
+    // relayouts); QTreeView caches them per item, so non-uniform trees keep its walk
+    if (!m || !uniformRowHeights()) {
+        m_rowIndex.invalidate();
+        return nullptr;
+    }
+    // Same as QTreeView's geometry queries: settle a pending delayed layout first
+    const_cast<TreeView*>(this)->executeDelayedItemsLayout();
+    if (!m_rowIndex.isValid()) m_rowIndex.rebuild(m, rootIndex());
+    return &m_rowIndex;
+}
+
+int TreeView::contentScrollTop(const TreeRowIndex& rows) const {
+    const int value = verticalScrollBar()->value();
+    if (verticalScrollMode() == QAbstractItemView::ScrollPerPixel) return value;
+    return rows.rowTop(qBound(0, value, rows.count()));
+}
+
+void TreeView::spliceRowIndex(const QModelIndex& index, bool expanded) {
+    if (!m_rowIndex.isValid()) return;
+    // Batch expansion would splice thousands of times; one rebuild on the next query is cheaper
+    if (!m_animEnabled) {
+        m_rowIndex.invalidate();
+        return;
+    }
+    const int row = m_rowIndex.rowOf(index);
+    if (row < 0) return;   // inside a collapsed subtree: nothing visible changes
+    if (expanded) m_rowIndex.expand(row);
+    else m_rowIndex.collapse(row);
+}
+
+QRect TreeView::visualRect(const QModelIndex& index) const {
+    const TreeRowIndex* rows = rowIndex();
+    if (!rows) return QTreeView::visualRect(index);
+    if (!index.isValid() || index.model() != model() || isIndexHidden(index)) return QRect();
+    const int row = rows->rowOf(index);
+    if (row < 0) return QRect();
+
+    // Mirrors QTreeView::visualRect
+    const bool spanning = isFirstColumnSpanned(index.row(), index.parent());
+    int x = spanning ? 0 : columnViewportPosition(index.column());
+    int w = spanning ? header()->length() : columnWidth(index.column());
+    const int treeColumn = treePosition() < 0 ? header()->logicalIndex(0) : treePosition();
+    if (index.column() == treeColumn) {
+        const int indent = (rows->row(row).depth + (rootIsDecorated() ? 1 : 0)) * indentation();
+        w -= indent;
+        if (!isRightToLeft()) x += indent;
+    }
+    return QRect(x, rows->rowTop(row) - contentScrollTop(*rows), w, rows->rowHeight(row));
+}
+
+QModelIndex TreeView::indexAt(const QPoint& point) const {
+    const TreeRowIndex* rows = rowIndex();
+    if (!rows) return QTreeView::indexAt(point);
+    const int row = rows->rowAt(point.y() + contentScrollTop(*rows));
+    if (row < 0) return QModelIndex();
+
+    const QModelIndex idx = rows->row(row).index;
+    if (isFirstColumnSpanned(idx.row(), rows->parentIndex(row))) return idx;
+    const int column = header()->logicalIndexAt(point.x());
+    if (column == idx.column()) return idx;
+    if (column < 0) return QModelIndex();
+    return idx.sibling(idx.row(), column);
+}
+
+void TreeView::scrollTo(const QModelIndex& index, ScrollHint hint) {
+    if (!uniformRowHeights()) {
+        QTreeView::scrollTo(index, hint);
+        return;
+    }
+    if (!index.isValid() || index.model() != model()) return;
+
+    // Same as QTreeView: reveal the item by expanding its collapsed ancestors
+    for (QModelIndex p = index.parent(); p.isValid() && p != rootIndex(); p = p.parent()) {
+        if (state() != NoState || !itemsExpandable()) break;
+        if (!isExpanded(p)) expand(p);
+    }
+    const TreeRowIndex* rows = rowIndex();
+    const int row = rows ? rows->rowOf(index) : -1;
+    if (row < 0) return;
+
+    QScrollBar* vbar = verticalScrollBar();
+    const int viewportHeight = viewport()->height();
+    const int top = rows->rowTop(row);
+    const int bottom = top + rows->rowHeight(row);
+    if (verticalScrollMode() == QAbstractItemView::ScrollPerPixel) {
+        const int current = vbar->value();
+        int value = current;
+        switch (hint) {
+        case EnsureVisible:
+            if (top < current) value = top;
+            else if (bottom > current + viewportHeight) value = bottom - viewportHeight;
+            break;
+        case PositionAtTop:    value = top; break;
+        case PositionAtBottom: value = bottom - viewportHeight; break;
+        case PositionAtCenter: value = top - (viewportHeight - (bottom - top)) / 2; break;
+        }
+        vbar->setValue(value);
+    } else {
+        // ScrollPerItem: the scroll value is the first visible row
+        const int current = vbar->value();
+        const int fitBottom = qMin(row, rows->rowStartingAtOrAfter(bottom - viewportHeight));
+        int value = current;
+        switch (hint) {
+        case EnsureVisible:
+            if (row < current) value = row;
+            else if (bottom > contentScrollTop(*rows) + viewportHeight) value = fitBottom;
+            break;
+        case PositionAtTop:    value = row; break;
+        case PositionAtBottom: value = fitBottom; break;
+        case PositionAtCenter:
+            value = qMin(row, rows->rowStartingAtOrAfter(top - (viewportHeight - (bottom - top)) / 2));
+            break;
+        }
+        vbar->setValue(value);
+    }
+
+    // Horizontal: only columns partly outside the viewport need QTreeView's handling; by now
+    // the row is on screen, so its lookup stays within the visible rows
+    const int x = columnViewportPosition(index.column());
+    if (x < 0 || x + columnWidth(index.column()) > viewport()->width())
+        QTreeView::scrollTo(index, hint);
+}
+
+void TreeView::setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) {
+    const TreeRowIndex* rows = rowIndex();
+    if (!rows) {
+        QTreeView::setSelection(rect, command);
+        return;
+    }
+    if (!selectionModel() || rect.isNull()) return;
+
+    // Corner resolution mirrors QTreeView::setSelection
+    const bool reverse = isRightToLeft();
+    const QPoint tl(reverse ? qMax(rect.left(), rect.right()) : qMin(rect.left(), rect.right()),
+                    qMin(rect.top(), rect.bottom()));
+    const QPoint br(reverse ? qMin(rect.left(), rect.right()) : qMax(rect.left(), rect.right()),
+                    qMax(rect.top(), rect.bottom()));
+    QModelIndex topLeft = indexAt(tl);
+    QModelIndex bottomRight = indexAt(br);
+    if (!topLeft.isValid() && !bottomRight.isValid()) {
+        if (command & QItemSelectionModel::Clear) selectionModel()->clear();
+        return;
+    }
+    if (rows->count() == 0) return;
+    if (!topLeft.isValid()) topLeft = rows->row(0).index;
+    if (!bottomRight.isValid()) {
+        const QModelIndex last = rows->row(rows->count() - 1).index;
+        bottomRight = last.sibling(last.row(), header()->logicalIndex(header()->count() - 1));
+    }
+    if (!(model()->flags(topLeft) & Qt::ItemIsEnabled) || !(model()->flags(bottomRight) & Qt::ItemIsEnabled))
+        return;
+    const int first = rows->rowOf(topLeft);
+    const int last = rows->rowOf(bottomRight);
+    if (first < 0 || last < first) return;
+
+    // Visible, non-hidden logical columns between the two corners, merged into runs
+    const int leftVisual = header()->visualIndex(topLeft.column());
+    const int rightVisual = header()->visualIndex(bottomRight.column());
+    QVector<int> columns;
+    for (int v = qMin(leftVisual, rightVisual); v <= qMax(leftVisual, rightVisual); ++v) {
+        const int logical = header()->logicalIndex(v);
+        if (!header()->isSectionHidden(logical)) columns.append(logical);
+    }
+    std::sort(columns.begin(), columns.end());
+
+    QItemSelection selection;
+    for (int c = 0; c < columns.size();) {
+        int right = c;
+        while (right + 1 < columns.size() && columns.at(right + 1) == columns.at(right) + 1) ++right;
+        const int leftColumn = columns.at(c);
+        const int rightColumn = columns.at(right);
+        c = right + 1;
+
+        // One open run of siblings per depth: siblings separated by an expanded subtree
+        // still merge into a single range, as in QTreeView
+        struct Run { int parentRow; QModelIndex parent; int first; int last; };
+        QVector<Run> open;
+        auto flush = [&](const Run& run) {
+            if (run.first < 0) return;
+            selection.append(QItemSelectionRange(model()->index(run.first, leftColumn, run.parent),
+                                                 model()->index(run.last, rightColumn, run.parent)));
+        };
+        for (int i = first; i <= last; ++i) {
+            const TreeRowIndex::Row& r = rows->row(i);
+            while (open.size() > r.depth + 1) {
+                flush(open.last());
+                open.removeLast();
+            }
+            if (open.size() == r.depth + 1) {
+                Run& run = open.last();
+                if (run.first >= 0 && run.parentRow == r.parent && run.last + 1 == r.index.row()) {
+                    run.last = r.index.row();
+                    continue;
+                }
+                flush(run);
+                open.removeLast();
+            }
+            while (open.size() < r.depth) open.append({ -2, QModelIndex(), -1, -1 });   // ancestors outside the range
+            open.append({ r.parent, rows->parentIndex(i), r.index.row(), r.index.row() });
+        }
+        for (const Run& run : std::as_const(open)) flush(run);
+    }
+    selectionModel()->select(selection, command);
+}
+
+// ── Paint cache ───────────────────────────────────────────────────────────────
+
+void TreeView::setPaintCacheEnabled(bool enabled) {
+    if (!ItemPaintCache::install(m_paintCache, enabled, m_paintCacheBudget, this)) return;
+    // Chevron tweens are driven by the view, not the model: paint those rows live
+    if (m_paintCache) {
+        m_paintCache->setVolatileFunction([this](const QModelIndex& index) {
+            return !m_chevronTweens.isEmpty() && findChevronTween(index) != nullptr;
+        });
+    }
+    emit paintCacheEnabledChanged();
+}
+
+void TreeView::setPaintCacheBudget(int kilobytes) {
+    if (ItemPaintCache::applyBudget(m_paintCache, m_paintCacheBudget, kilobytes)) emit paintCacheBudgetChanged();
+}
+
 // ── Paint ─────────────────────────────────────────────────────────────────────
 
 void TreeView::paintEvent(QPaintEvent* event) {
@@ -317,7 +747,7 @@ void TreeView::paintEvent(QPaintEvent* event) {
         QPainter ph(viewport());
         ph.setRenderHint(QPainter::Antialiasing);
         ph.setPen(c.textTertiary);
-        ph.setFont(themeFont(m_fontRole).toQFont());
+        ph.setFont(themeQFont(m_fontRole));
         ph.drawText(viewport()->rect(), Qt::AlignCenter, m_placeholderText);
         ph.end();
     }
@@ -428,6 +858,12 @@ void TreeView::resizeEvent(QResizeEvent* event) {
     syncFluentScrollBar();
     syncFluentHScrollBar();
     layoutHeader();
+    scheduleLoadingUpdate();
+}
+
+void TreeView::scrollContentsBy(int dx, int dy) {
+    QTreeView::scrollContentsBy(dx, dy);
+    scheduleLoadingUpdate();
 }
 
 void TreeView::showEvent(QShowEvent* event) {
@@ -553,39 +989,66 @@ void TreeView::drawBranches(QPainter* /*painter*/, const QRect& /*rect*/,
     // 不绘制原生 branch 指示器 — delegate 自行绘制 Fluent 风格 chevron
 }
 
+void TreeView::startRevealAnimation(const QModelIndex& parent) {
+    m_expandRevealAnim->stop();
+    m_animParent = QPersistentModelIndex();
+
+    // Record the subtree's painted extent once, in content coordinates (stable while scrolling):
+    // from the first child down to the last visible descendant. drawRow then only range-checks.
+    const int offset = QTreeView::verticalOffset();
+    const QRect parentRect = visualRect(parent);
+    if (!parentRect.isValid() || !model() || model()->rowCount(parent) == 0) return;
+    QModelIndex last = parent;
+    while (isExpanded(last) && model()->rowCount(last) > 0)
+        last = model()->index(model()->rowCount(last) - 1, 0, last);
+    const QRect firstRect = visualRect(model()->index(0, 0, parent));
+    const QRect lastRect = visualRect(last);
+    if (!firstRect.isValid() || !lastRect.isValid()) return;
+
+    m_animParent = QPersistentModelIndex(parent);
+    m_animExpanding = true;
+    m_animRangeTop = firstRect.top() + offset;
+    m_animRangeBottom = lastRect.bottom() + offset;
+    m_animRowHeight = qMax(1, firstRect.height());
+    m_expandRevealAnim->setStartValue(0.0);
+    m_expandRevealAnim->setEndValue(1.0);
+    m_expandRevealAnim->start();
+}
+
+qreal TreeView::revealProgressAt(int contentY) const {
+    if (m_expandRevealAnim->state() != QAbstractAnimation::Running
+        || !m_animParent.isValid() || !m_animExpanding)
+        return -1.0;
+    if (contentY < m_animRangeTop || contentY > m_animRangeBottom) return -1.0;
+
+    const qreal rawProgress = m_expandRevealAnim->currentValue().toReal();
+    // Stagger by visual order inside the subtree; the spread is capped so a huge
+    // expansion settles within the same duration as a small one
+    constexpr qreal kStaggerDelay = 0.08;
+    constexpr qreal kMaxStaggerDelay = 0.4;
+    const int ordinal = (contentY - m_animRangeTop) / m_animRowHeight;
+    const qreal rowDelay = qMin(ordinal * kStaggerDelay, kMaxStaggerDelay);
+    return qBound(0.0, (rawProgress - rowDelay) / (1.0 - rowDelay), 1.0);
+}
+
+qreal TreeView::revealProgress(const QModelIndex& index) const {
+    const QRect rect = visualRect(index);
+    if (!rect.isValid()) return 1.0;
+    const qreal progress = revealProgressAt(rect.top() + QTreeView::verticalOffset());
+    return progress >= 0.0 ? progress : 1.0;
+}
+
 void TreeView::drawRow(QPainter* painter, const QStyleOptionViewItem& options,
                        const QModelIndex& index) const {
-    if (m_expandRevealAnim->state() == QAbstractAnimation::Running
-        && m_animParent.isValid() && m_animExpanding) {
-        // Check if this row is a descendant of the animating parent
-        bool isDescendant = false;
-        int childRow = -1;
-        QModelIndex p = index.parent();
-        if (p.isValid() && p == m_animParent) {
-            isDescendant = true;
-            childRow = index.row();
-        } else {
-            // deeper descendants
-            QModelIndex walk = p;
-            while (walk.isValid()) {
-                if (walk == m_animParent) { isDescendant = true; break; }
-                walk = walk.parent();
-            }
-        }
-        if (isDescendant) {
-            const qreal rawProgress = m_expandRevealAnim->currentValue().toReal();
-            // Stagger: each direct child row starts slightly later
-            constexpr qreal kStaggerDelay = 0.08;
-            const qreal rowDelay = (childRow >= 0) ? childRow * kStaggerDelay : 0.0;
-            const qreal progress = qBound(0.0, (rawProgress - rowDelay) / qMax(1.0 - rowDelay, 0.01), 1.0);
-
-            painter->save();
-            painter->setOpacity(progress);
-            painter->translate(0, -(1.0 - progress) * 8.0);
-            QTreeView::drawRow(painter, options, index);
-            painter->restore();
-            return;
-        }
+    // --- Expand reveal: rows of the animated subtree fade and slide in ---
+    const qreal progress = revealProgressAt(options.rect.top() + QTreeView::verticalOffset());
+    if (progress >= 0.0) {
+        painter->save();
+        painter->setOpacity(progress);
+        painter->translate(0, -(1.0 - progress) * 8.0);
+        QTreeView::drawRow(painter, options, index);
+        painter->restore();
+        return;
     }
     // --- Drag: dim source row ---
     if (m_isDragging && index == m_dragSourceIndex) {
@@ -599,14 +1062,68 @@ void TreeView::drawRow(QPainter* painter, const QStyleOptionViewItem& options,
 }
 
 qreal TreeView::chevronRotation(const QModelIndex& index) const {
-    QPersistentModelIndex pi(index);
-    auto it = m_chevronAnims.find(pi);
-    if (it != m_chevronAnims.end())
-        return it.value()->currentValue().toReal();
+    if (const ChevronTween* c = findChevronTween(index))
+        return c->value;
     // No animation running — return steady state
     return isExpanded(index) ? 1.0 : 0.0;
 }
 
+const TreeView::ChevronTween* TreeView::findChevronTween(const QModelIndex& index) const {
+    // Only rows inside the viewport animate, so the table stays a handful of entries long
+    for (const ChevronTween& c : m_chevronTweens) {
+        if (c.index == index) return &c;
+    }
+    return nullptr;
+}
+
+void TreeView::animateChevron(const QModelIndex& index, qreal to) {
+    auto it = std::find_if(m_chevronTweens.begin(), m_chevronTweens.end(),
+                           [&index](const ChevronTween& c) { return c.index == index; });
+    // Rows outside the viewport snap to their end state: nobody would see the turn
+    if (!visualRect(index).intersects(viewport()->rect())) {
+        if (it != m_chevronTweens.end()) m_chevronTweens.erase(it);
+        return;
+    }
+
+    if (!m_chevronClock.isValid()) m_chevronClock.start();
+    const qint64 now = m_chevronClock.elapsed();
+    if (it == m_chevronTweens.end())
+        m_chevronTweens.append({ QPersistentModelIndex(index), 1.0 - to, to, 1.0 - to, now });
+    else
+        *it = { it->index, it->value, to, it->value, now };   // reversed mid-turn: continue from the current angle
+
+    // One scheduler tween ticks the whole table; it restarts on every new chevron so it
+    // always outlives the most recent one
+    ::Animation::Scheduler::instance().animate(
+        this, kChevronClockKey, 0.0, 1.0, ::Animation::Duration::Normal,
+        ::Animation::EasingType::Decelerate,
+        [this](qreal) { stepChevronAnimations(false); },
+        nullptr,
+        [this]() { stepChevronAnimations(true); });
+}
+
+void TreeView::stepChevronAnimations(bool finish) {
+    static const QEasingCurve easing = ::Animation::getEasing(::Animation::EasingType::Decelerate);
+    const qint64 now = m_chevronClock.elapsed();
+    const QRect area = viewport()->rect();
+    for (int i = m_chevronTweens.size() - 1; i >= 0; --i) {
+        ChevronTween& c = m_chevronTweens[i];
+        // The clock tween ends on its own timebase: settle whatever is left on the last frame
+        const qreal t = finish ? 1.0 : qBound(0.0, qreal(now - c.start) / ::Animation::Duration::Normal, 1.0);
+        c.value = c.from + (c.to - c.from) * easing.valueForProgress(t);
+
+        // Repaint just this row's band instead of the whole viewport
+        const QRect row = c.index.isValid() ? visualRect(c.index) : QRect();
+        if (row.intersects(area)) viewport()->update(QRect(area.left(), row.top(), area.width(), row.height()));
+        if (t >= 1.0 || !c.index.isValid()) m_chevronTweens.remove(i);
+    }
+}
+
+void TreeView::clearChevronAnimations() {
+    ::Animation::Scheduler::instance().cancel(this, kChevronClockKey);
+    m_chevronTweens.clear();
+}
+
 // ── Drag reorder: mouse events ───────────────────────────────────────────────
 
 void TreeView::mousePressEvent(QMouseEvent* event) {
@@ -645,44 +1162,30 @@ void TreeView::mouseMoveEvent(QMouseEvent* event) {
 
 void TreeView::mouseReleaseEvent(QMouseEvent* event) {
     if (m_isDragging && event->button() == Qt::LeftButton) {
-        if (m_dropMode != DropMode::None && model()) {
-            auto* sim = qobject_cast<QStandardItemModel*>(model());
-            if (sim && m_dragSourceIndex.isValid()) {
-                QModelIndex srcParentIdx = m_dragSourceIndex.parent();
-                int srcRow = m_dragSourceIndex.row();
-
-                QStandardItem* srcParentItem = srcParentIdx.isValid()
-                    ? sim->itemFromIndex(srcParentIdx) : sim->invisibleRootItem();
-
-                if (m_dropMode == DropMode::OnItem && m_dropOnIndex.isValid()) {
-                    QStandardItem* targetItem = sim->itemFromIndex(QModelIndex(m_dropOnIndex));
-                    if (srcParentItem && targetItem) {
-                        auto row = srcParentItem->takeRow(srcRow);
-                        targetItem->appendRow(row);
-                        QModelIndex dropParent(m_dropOnIndex);
-                        expand(dropParent);
-                        QModelIndex newIdx = sim->indexFromItem(row.first());
-                        setCurrentIndex(newIdx);
-                        emit itemReordered(srcParentIdx, srcRow,
-                                           dropParent, targetItem->rowCount() - 1);
-                    }
-                } else if (m_dropMode == DropMode::Between) {
-                    QStandardItem* dstParentItem = m_dropTargetParent.isValid()
-                        ? sim->itemFromIndex(QModelIndex(m_dropTargetParent))
-                        : sim->invisibleRootItem();
-                    if (srcParentItem && dstParentItem) {
-                        bool sameParent = (srcParentItem == dstParentItem);
-                        int dstRow = m_dropTargetRow;
-
-                        auto row = srcParentItem->takeRow(srcRow);
-                        if (sameParent && srcRow < dstRow)
-                            dstRow--;
-                        dstParentItem->insertRow(dstRow, row);
-                        QModelIndex newIdx = sim->indexFromItem(row.first());
-                        setCurrentIndex(newIdx);
-                        emit itemReordered(srcParentIdx, srcRow,
-                                           QModelIndex(m_dropTargetParent), dstRow);
-                    }
+        if (m_dropMode != DropMode::None && model() && m_dragSourceIndex.isValid()) {
+            const QPersistentModelIndex srcParentIdx(m_dragSourceIndex.parent());
+            const int srcRow = m_dragSourceIndex.row();
+
+            if (m_dropMode == DropMode::OnItem && m_dropOnIndex.isValid()) {
+                // Append after the last loaded child (before a trailing loading placeholder)
+                const QModelIndex dropParent(m_dropOnIndex);
+                int dstRow = model()->rowCount(dropParent);
+                if (dstRow > 0 && model()->index(dstRow - 1, 0, dropParent).data(ItemLoadingRole).toBool())
+                    --dstRow;
+                const QModelIndex newIdx = moveItem(m_dragSourceIndex, dropParent, dstRow);
+                if (newIdx.isValid()) {
+                    expand(QModelIndex(m_dropOnIndex));
+                    setCurrentIndex(newIdx);
+                    emit itemReordered(QModelIndex(srcParentIdx), srcRow,
+                                       QModelIndex(m_dropOnIndex), newIdx.row());
+                }
+            } else if (m_dropMode == DropMode::Between) {
+                const QModelIndex newIdx = moveItem(m_dragSourceIndex,
+                                                    QModelIndex(m_dropTargetParent), m_dropTargetRow);
+                if (newIdx.isValid()) {
+                    setCurrentIndex(newIdx);
+                    emit itemReordered(QModelIndex(srcParentIdx), srcRow,
+                                       QModelIndex(m_dropTargetParent), newIdx.row());
                 }
             }
         }
@@ -707,6 +1210,49 @@ void TreeView::mouseReleaseEvent(QMouseEvent* event) {
 
 // ── Drag reorder: helpers ────────────────────────────────────────────────────
 
+QModelIndex TreeView::moveItem(const QModelIndex& source, const QModelIndex& destinationParent,
+                               int destinationRow) {
+    QAbstractItemModel* m = model();
+    if (!m || !source.isValid()) return {};
+
+    const QModelIndex srcParent = source.parent();
+    const int srcRow = source.row();
+    // destinationRow counts rows before the source is taken out (moveRows convention)
+    const bool sameParent = (srcParent == destinationParent);
+    const int finalRow = (sameParent && srcRow < destinationRow) ? destinationRow - 1 : destinationRow;
+    if (sameParent && finalRow == srcRow) return source;
+
+    // 1. Models that implement moveRows (LazyTreeModel, custom tree models)
+    if (m->moveRow(srcParent, srcRow, destinationParent, destinationRow))
+        return m->index(finalRow, 0, destinationParent);
+
+    // 2. QStandardItemModel has no moveRows: move the items themselves so that
+    //    item subclasses and data survive untouched
+    if (auto* sim = qobject_cast<QStandardItemModel*>(m)) {
+        QStandardItem* srcParentItem = srcParent.isValid()
+            ? sim->itemFromIndex(srcParent) : sim->invisibleRootItem();
+        QStandardItem* dstParentItem = destinationParent.isValid()
+            ? sim->itemFromIndex(destinationParent) : sim->invisibleRootItem();
+        if (!srcParentItem || !dstParentItem) return {};
+        auto row = srcParentItem->takeRow(srcRow);
+        dstParentItem->insertRow(finalRow, row);
+        return sim->indexFromItem(row.first());
+    }
+
+    // 3. Anything else: copy the row through the model's mime format, then remove the original
+    QModelIndexList rowIndexes;
+    for (int c = 0; c < m->columnCount(srcParent); ++c)
+        rowIndexes << m->index(srcRow, c, srcParent);
+    const QPersistentModelIndex src(source);
+    const QPersistentModelIndex dstParent(destinationParent);
+    std::unique_ptr<QMimeData> data(m->mimeData(rowIndexes));
+    if (!data || !m->canDropMimeData(data.get(), Qt::MoveAction, destinationRow, 0, destinationParent)
+        || !m->dropMimeData(data.get(), Qt::MoveAction, destinationRow, 0, destinationParent))
+        return {};
+    if (src.isValid()) m->removeRow(src.row(), src.parent());
+    return m->index(finalRow, 0, QModelIndex(dstParent));
+}
+
 QPixmap TreeView::renderRowPixmap(const QModelIndex& index) const {
     if (!index.isValid() || !model()) return {};
 
@@ -770,7 +1316,8 @@ void TreeView::computeDropTarget(const QPoint& pos) {
     if (rowH <= 0) return;
     int relY = pos.y() - rect.top();
 
-    bool hasChildren = model()->rowCount(idx) > 0;
+    // hasChildren rather than rowCount: lazily loaded folders are drop targets before their first fetch
+    bool hasChildren = model()->hasChildren(idx);
 
     if (hasChildren) {
         // Three zones: top 25% / middle 50% / bottom 25%
@@ -837,6 +1384,7 @@ void TreeView::onThemeUpdated() {
 
 void TreeView::applyThemeStyle() {
     const auto& c = themeColors();
+    ItemPaintCache::invalidateStyle(m_paintCache);
 
     QPalette pal = palette();
     pal.setColor(QPalette::Base, Qt::transparent);
@@ -846,7 +1394,7 @@ void TreeView::applyThemeStyle() {
     pal.setColor(QPalette::HighlightedText, c.textPrimary);
     setPalette(pal);
 
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
 
     if (viewport()) {
         viewport()->setAutoFillBackground(false);
@@ -858,7 +1406,7 @@ void TreeView::applyThemeStyle() {
 
     // Header label theme
     if (m_headerLabel) {
-        m_headerLabel->setFont(themeFont(Typography::FontRole::Subtitle).toQFont());
+        m_headerLabel->setFont(themeQFont(Typography::FontRole::Subtitle));
         QPalette hpal = m_headerLabel->palette();
         hpal.setColor(QPalette::WindowText, c.textPrimary);
         m_headerLabel->setPalette(hpal);
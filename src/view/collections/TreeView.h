@@ -2,11 +2,14 @@
 #define TREEVIEW_H
 
 #include <QTreeView>
+#include <QElapsedTimer>
 #include <QPersistentModelIndex>
 #include <QHash>
+#include <QVector>
 #include <QStandardItemModel>
 
 #include "view/FluentElement.h"
+#include "view/collections/TreeRowIndex.h"
 #include "view/QMLPlus.h"
 
 class QLabel;
@@ -18,9 +21,12 @@ class QWheelEvent;
 class QTimer;
 
 namespace view::scrolling { class ScrollBar; }
+namespace view::status_info { class ProgressRing; }
 
 namespace view::collections {
 
+class ItemPaintCache;
+
 /**
  * Fluent TreeView（仅视图层）。
  *
@@ -34,6 +40,10 @@ namespace view::collections {
  *   - 每级缩进 16px
  *   - 展开/折叠使用 Segoe Fluent Icons 中号 Chevron
  *   - 选中项左侧 3px accent 指示条
+ *
+ * 按需加载：model 通过 canFetchMore / fetchMore 提供子项（见 LazyTreeModel）时，
+ * ItemLoadingRole 为 true 的占位行上显示 ProgressRing，占位行滚入视口即请求下一页；
+ * 节点折叠时调用 model 的 cancelFetch(QModelIndex) 槽（如有）取消在途请求。
  */
 class TreeView : public QTreeView, public FluentElement, public view::QMLPlus {
     Q_OBJECT
@@ -63,6 +73,14 @@ public:
     /** 是否允许拖拽换位（文件管理器风格：同/跨父节点移动 & 拖放至文件夹） */
     Q_PROPERTY(bool canReorderItems READ canReorderItems WRITE setCanReorderItems NOTIFY canReorderItemsChanged)
 
+    /**
+     * item 绘制缓存（同 ListView）：chevron 旋转中的行不走缓存。
+     * 启用后再 setItemDelegate 会替换掉缓存层，需重新开启。
+     */
+    Q_PROPERTY(bool paintCacheEnabled READ paintCacheEnabled WRITE setPaintCacheEnabled NOTIFY paintCacheEnabledChanged)
+    /** 绘制缓存上限（KB） */
+    Q_PROPERTY(int paintCacheBudget READ paintCacheBudget WRITE setPaintCacheBudget NOTIFY paintCacheBudgetChanged)
+
     explicit TreeView(QWidget* parent = nullptr);
     ~TreeView() override = default;
 
@@ -92,9 +110,25 @@ public:
     bool canReorderItems() const { return m_canReorderItems; }
     void setCanReorderItems(bool enabled);
 
+    // --- Paint cache ---
+    bool paintCacheEnabled() const { return m_paintCache != nullptr; }
+    void setPaintCacheEnabled(bool enabled);
+    int paintCacheBudget() const { return m_paintCacheBudget; }
+    void setPaintCacheBudget(int kilobytes);
+    /** 未启用时为 nullptr */
+    ItemPaintCache* paintCache() const { return m_paintCache; }
+
     // --- Tree API ---
     void expandAll();
+    /**
+     * 分批展开到 depthLimit 层（1 = 只展开顶层节点；< 0 不限），每个事件循环 tick 只处理
+     * 有限时间片；按需加载的节点等子项到达后继续向下展开。完成时发出 expandAllFinished()。
+     */
+    void expandAll(int depthLimit);
+    void cancelExpandAll();
+    bool isExpandingAll() const;
     void collapseAll();
+    void expandToDepth(int depth);
     void toggleExpanded(const QModelIndex& index);
 
     // --- Selection API ---
@@ -107,6 +141,16 @@ public:
 
     void refreshFluentScrollChrome();
 
+    void setModel(QAbstractItemModel* model) override;
+    void setRootIndex(const QModelIndex& index) override;
+
+    // uniformRowHeights 时几何查询走扁平行索引（TreeRowIndex），结果与 QTreeView 一致，
+    // 但不再逐行查找；行高不统一时沿用 QTreeView 的实现（其逐项缓存行高）
+    QRect visualRect(const QModelIndex& index) const override;
+    QModelIndex indexAt(const QPoint& point) const override;
+    void scrollTo(const QModelIndex& index, ScrollHint hint = EnsureVisible) override;
+    void doItemsLayout() override;
+
 signals:
     void selectionModeChanged();
     void fontRoleChanged();
@@ -117,8 +161,11 @@ signals:
     void placeholderTextChanged();
     void itemClicked(const QModelIndex& index);
     void canReorderItemsChanged();
+    void paintCacheEnabledChanged();
+    void paintCacheBudgetChanged();
     void itemReordered(const QModelIndex& srcParent, int srcRow,
                        const QModelIndex& dstParent, int dstRow);
+    void expandAllFinished();
 
 protected:
     void paintEvent(QPaintEvent* event) override;
@@ -132,6 +179,8 @@ protected:
     void mouseReleaseEvent(QMouseEvent* event) override;
     void wheelEvent(QWheelEvent* event) override;
     int verticalOffset() const override;
+    void scrollContentsBy(int dx, int dy) override;
+    void setSelection(const QRect& rect, QItemSelectionModel::SelectionFlags command) override;
     void drawRow(QPainter* painter, const QStyleOptionViewItem& options, const QModelIndex& index) const override;
     void drawBranches(QPainter* painter, const QRect& rect, const QModelIndex& index) const override;
 
@@ -149,7 +198,35 @@ private:
     // Drag helpers — file-manager style
     void computeDropTarget(const QPoint& pos);
     bool isDescendantOf(const QModelIndex& candidate, const QModelIndex& ancestor) const;
+    /** 通过通用模型接口移动一行（moveRow，不支持时退回 mimeData / dropMimeData + removeRow） */
+    QModelIndex moveItem(const QModelIndex& source, const QModelIndex& destinationParent, int destinationRow);
     QPixmap renderRowPixmap(const QModelIndex& index) const;
+    /** 记录 parent 子树的可见范围并启动展开渐显 */
+    void startRevealAnimation(const QModelIndex& parent);
+    /** 内容坐标 contentY 处的行在展开渐显中的进度；不在动画子树内时返回 -1 */
+    qreal revealProgressAt(int contentY) const;
+
+    // On-demand children
+    void scheduleLoadingUpdate();
+    /** 在视口内的占位行上摆放 ProgressRing，并为可见的末尾占位行请求下一页 */
+    void updateLoadingIndicators();
+    void cancelChildLoading(const QModelIndex& index);
+    void onRowsInserted(const QModelIndex& parent, int first, int last);
+    void onRowsRemoved(const QModelIndex& parent);
+    /** parent 的子项是否仍在加载（尚未请求或末尾为占位行） */
+    bool childrenPending(const QModelIndex& parent) const;
+
+    // Flattened row index
+    /** 按需重建后的行索引；没有 model 或未开启 uniformRowHeights 时为 nullptr */
+    const TreeRowIndex* rowIndex() const;
+    /** 首个可见行顶边的内容坐标（ScrollPerItem 时滚动条值为行号） */
+    int contentScrollTop(const TreeRowIndex& rows) const;
+    /** 展开 / 折叠后就地拼接行索引（批量展开时整体失效） */
+    void spliceRowIndex(const QModelIndex& index, bool expanded);
+
+    // Incremental expandAll
+    void processExpandAllQueue();
+    void finishExpandAllIfIdle();
 
     TreeSelectionMode m_selectionMode = TreeSelectionMode::Single;
     QString m_fontRole;
@@ -165,6 +242,31 @@ private:
     ::view::scrolling::ScrollBar* m_hScrollBar = nullptr;
     bool m_viewportHovered = false;
 
+    // --- On-demand children ---
+    QVector<QMetaObject::Connection> m_modelConnections;
+    QVector<::view::status_info::ProgressRing*> m_loadingRings;   // 复用池，按可见占位行数增长
+    bool m_loadingUpdateQueued = false;
+
+    // --- Incremental expandAll ---
+    struct ExpandTask {
+        QPersistentModelIndex parent;
+        int depth;       // parent 所在层（0 = 根，顶层节点为 1）
+        int nextRow;     // 下一个待处理的子行
+        int endRow;      // 处理到此行之前；之后到达的行由新任务处理
+    };
+    QList<ExpandTask> m_expandQueue;
+    QHash<QPersistentModelIndex, int> m_expandWaiting;   // 子项加载中的节点 → 该节点所在层
+    int m_expandDepthLimit = -1;
+    bool m_expandingAll = false;
+    QTimer* m_expandAllTimer = nullptr;
+
+    // --- Flattened row index ---
+    mutable TreeRowIndex m_rowIndex;
+
+    // --- Paint cache ---
+    ItemPaintCache* m_paintCache = nullptr;
+    int m_paintCacheBudget = 32 * 1024;
+
     // --- Overscroll bounce ---
     qreal m_overscrollY = 0.0;
     QVariantAnimation* m_bounceAnim = nullptr;
@@ -188,13 +290,33 @@ private:
     QPersistentModelIndex m_animParent;
     bool m_animEnabled = true;
     bool m_animExpanding = true;   // true=expand, false=collapse
-
-    // Chevron rotation progress per-index: 0.0=collapsed(right), 1.0=expanded(down)
-    QHash<QPersistentModelIndex, QVariantAnimation*> m_chevronAnims;
+    // 动画子树在内容坐标中的纵向范围（首个子行顶边 ~ 最后一个可见后代底边），展开时记录一次
+    int m_animRangeTop = 0;
+    int m_animRangeBottom = -1;
+    int m_animRowHeight = 1;
+
+    // Chevron rotation progress per-index: 0.0=collapsed(right), 1.0=expanded(down).
+    // Flat table of the chevrons currently turning; only rows inside the viewport get an entry.
+    // A single scheduler tween ticks the whole table and repaints just those rows.
+    struct ChevronTween {
+        QPersistentModelIndex index;
+        qreal from;
+        qreal to;
+        qreal value;
+        qint64 start;   // m_chevronClock time (ms)
+    };
+    QVector<ChevronTween> m_chevronTweens;
+    QElapsedTimer m_chevronClock;
+    const ChevronTween* findChevronTween(const QModelIndex& index) const;
+    void animateChevron(const QModelIndex& index, qreal to);
+    void stepChevronAnimations(bool finish);
+    void clearChevronAnimations();
 
 public:
     /** Query chevron rotation progress for delegate painting. 0=right, 1=down. */
     qreal chevronRotation(const QModelIndex& index) const;
+    /** Query expand reveal progress of a row. 0=hidden, 1=settled (also when not animating). */
+    qreal revealProgress(const QModelIndex& index) const;
 };
 
 using TreeSelectionMode = TreeView::TreeSelectionMode;
@@ -4,6 +4,7 @@
 #include <QLayout>
 #include <QPointer>
 #include "design/Material.h"
+#include "utils/ShadowRenderer.h"
 
 namespace view::dialogs_flyouts {
 
@@ -294,25 +295,9 @@ void Dialog::paintEvent(QPaintEvent*) {
 }
 
 void Dialog::drawShadow(QPainter& painter, const QRect& contentRect) {
-    const auto& s = themeShadow(Elevation::High);
-    const int layers     = 10;
-    const int spreadStep = 1;
-    const int r          = themeRadius().overlay;
-
-    for (int i = 0; i < layers; ++i) {
-        const double ratio = 1.0 - static_cast<double>(i) / layers;
-        QColor sc = s.color;
-        sc.setAlphaF(s.opacity * ratio * 0.35);
-
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(sc);
-
-        const int spread  = i * spreadStep;
-        const int offsetY = 2;
-        painter.drawRoundedRect(
-            contentRect.adjusted(-spread, -spread, spread, spread).translated(0, offsetY),
-            r + spread, r + spread);
-    }
+    // 九宫格缓存贴图，开关动画期间每帧只做 drawPixmap
+    ShadowRenderer::drawRoundedRectShadow(painter, contentRect, themeRadius().overlay,
+                                          themeShadow(Elevation::High));
 }
 
 } // namespace view::dialogs_flyouts
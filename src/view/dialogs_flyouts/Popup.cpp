@@ -6,8 +6,10 @@
 #include <QMouseEvent>
 #include <QGraphicsOpacityEffect>
 #include <QApplication>
+#include "design/Animation.h"
 #include "design/Spacing.h"
 #include "compatibility/QtCompat.h"
+#include "utils/ShadowRenderer.h"
 
 namespace view::dialogs_flyouts {
 
@@ -49,12 +51,6 @@ Popup::Popup(QWidget* parent) : QWidget(parent) {
     setContentsMargins(kShadowMargin, kShadowMargin, kShadowMargin, kShadowMargin);
     resize(320 + kShadowMargin * 2, 160 + kShadowMargin * 2);
 
-    m_anim = new QPropertyAnimation(this, "popupProgress", this);
-    connect(m_anim, &QPropertyAnimation::finished, this, [this]() {
-        if (m_isClosing) finalizeClosed();
-        else             finalizeOpened();
-    });
-
     m_opacityEffect = new QGraphicsOpacityEffect(this);
     m_opacityEffect->setOpacity(0.0);
     setGraphicsEffect(m_opacityEffect);
@@ -123,9 +119,14 @@ QPoint Popup::computePosition() const {
 
 // ── open / close ─────────────────────────────────────────────────────────────
 
+// 进入与退出共用一条进度补间：反向打开/关闭时直接接续当前进度
+namespace {
+enum : quintptr { ProgressTween };
+}
+
 void Popup::open() {
     if (m_isOpen && !m_isClosing) return;
-    m_anim->stop();
+    ::Animation::Scheduler::instance().cancel(this, ProgressTween);
     m_isClosing = false;
 
     QWidget* top = originalParentTopLevel();
@@ -174,12 +175,12 @@ void Popup::open() {
 }
 
 void Popup::close() {
-    if (!m_isOpen && !m_anim->state()) {
+    if (!m_isOpen && !::Animation::Scheduler::instance().isRunning(this, ProgressTween)) {
         if (!isVisible()) return;
     }
     if (m_isClosing) return;
 
-    m_anim->stop();
+    ::Animation::Scheduler::instance().cancel(this, ProgressTween);
     m_isClosing = true;
     emit aboutToHide();
 
@@ -201,22 +202,21 @@ void Popup::setIsOpen(bool open) {
 
 // ── 动画 ─────────────────────────────────────────────────────────────────────
 
+// 进度经 setPopupProgress 写入：透明度效果自行刷新，popupProgressChanged 照常发出
 void Popup::startEnterAnimation() {
-    const auto& a = themeAnimation();
-    m_anim->setDuration(a.normal);       // 与 Dialog 一致：250ms
-    m_anim->setStartValue(m_popupProgress);
-    m_anim->setEndValue(1.0);
-    m_anim->setEasingCurve(a.entrance); // 与 Dialog 一致
-    m_anim->start();
+    ::Animation::Scheduler::instance().animate(
+        this, ProgressTween, m_popupProgress, 1.0, themeAnimation().normal,   // 与 Dialog 一致：250ms
+        ::Animation::EasingType::Entrance,                         // 与 Dialog 一致
+        [this](qreal v) { setPopupProgress(v); }, nullptr,
+        [this]() { finalizeOpened(); });
 }
 
 void Popup::startExitAnimation() {
-    const auto& a = themeAnimation();
-    m_anim->setDuration(a.normal);       // 与 Dialog 一致：250ms
-    m_anim->setStartValue(m_popupProgress);
-    m_anim->setEndValue(0.0);
-    m_anim->setEasingCurve(a.exit);     // 与 Dialog 一致
-    m_anim->start();
+    ::Animation::Scheduler::instance().animate(
+        this, ProgressTween, m_popupProgress, 0.0, themeAnimation().normal,   // 与 Dialog 一致：250ms
+        ::Animation::EasingType::Exit,                             // 与 Dialog 一致
+        [this](qreal v) { setPopupProgress(v); }, nullptr,
+        [this]() { finalizeClosed(); });
 }
 
 void Popup::finalizeOpened() {
@@ -295,22 +295,9 @@ void Popup::paintEvent(QPaintEvent*) {
     const QRect contentRect = rect().adjusted(kShadowMargin, kShadowMargin,
                                               -kShadowMargin, -kShadowMargin);
 
-    // 阴影
-    const auto& s = themeShadow(Elevation::High);
+    // 阴影（共享九宫格缓存）
     const int r = themeRadius().overlay;
-    {
-        const int layers = 10;
-        for (int i = 0; i < layers; ++i) {
-            const double ratio = 1.0 - static_cast<double>(i) / layers;
-            QColor sc = s.color;
-            sc.setAlphaF(s.opacity * ratio * 0.35);
-            painter.setPen(Qt::NoPen);
-            painter.setBrush(sc);
-            painter.drawRoundedRect(
-                contentRect.adjusted(-i, -i, i, i).translated(0, 2),
-                r + i, r + i);
-        }
-    }
+    ShadowRenderer::drawRoundedRectShadow(painter, contentRect, r, themeShadow(Elevation::High));
 
     // 背景 + 边框
     const auto& colors = themeColors();
@@ -2,7 +2,6 @@
 #define POPUP_H
 
 #include <QWidget>
-#include <QPropertyAnimation>
 #include <QPointer>
 #include <QFlags>
 #include "view/FluentElement.h"
@@ -118,7 +117,6 @@ private:
     QPoint m_targetPos;
 
     double m_popupProgress = 0.0;
-    QPropertyAnimation* m_anim = nullptr;
     QGraphicsOpacityEffect* m_opacityEffect = nullptr;
 
     QPointer<QWidget> m_scrim;
@@ -10,6 +10,7 @@
 
 #include "compatibility/QtCompat.h"
 #include "design/Spacing.h"
+#include "utils/ShadowRenderer.h"
 
 namespace view::dialogs_flyouts {
 
@@ -192,75 +193,89 @@ void TeachingTip::keyPressEvent(QKeyEvent* event) {
     Popup::keyPressEvent(event);
 }
 
+QPolygon TeachingTip::tailPolygon(const QRect& visualCardRect, int radius,
+                                  PreferredPlacement placement) const {
+    QPolygon tail;
+    if (!m_tailVisible || targetRectInTopLevel().isEmpty()) return tail;
+
+    const QPoint targetTopLeft = m_target->mapTo(m_target->window(), QPoint(0, 0));
+    const QRect localTargetRect = QRect(mapFrom(m_target->window(), targetTopLeft), m_target->size());
+
+    if (isBottomPlacement(placement)) {
+        int centerX = localTargetRect.center().x();
+        if (placement == BottomLeft)  centerX = localTargetRect.left()  + qMin(24, localTargetRect.width() / 2);
+        if (placement == BottomRight) centerX = localTargetRect.right() - qMin(24, localTargetRect.width() / 2);
+        centerX = qBound(visualCardRect.left() + radius + kTailHalfWidth,
+                         centerX, visualCardRect.right() - radius - kTailHalfWidth);
+        // 底边两点向 card 内 +2px，确保 united() 有面积重叠，消除接缝线
+        tail << QPoint(centerX - kTailHalfWidth, visualCardRect.top() + 2)
+             << QPoint(centerX + kTailHalfWidth, visualCardRect.top() + 2)
+             << QPoint(centerX, visualCardRect.top() - kTailSize);
+    } else if (isTopPlacement(placement)) {
+        int centerX = localTargetRect.center().x();
+        if (placement == TopLeft)  centerX = localTargetRect.left()  + qMin(24, localTargetRect.width() / 2);
+        if (placement == TopRight) centerX = localTargetRect.right() - qMin(24, localTargetRect.width() / 2);
+        centerX = qBound(visualCardRect.left() + radius + kTailHalfWidth,
+                         centerX, visualCardRect.right() - radius - kTailHalfWidth);
+        tail << QPoint(centerX - kTailHalfWidth, visualCardRect.bottom() - 2)
+             << QPoint(centerX + kTailHalfWidth, visualCardRect.bottom() - 2)
+             << QPoint(centerX, visualCardRect.bottom() + kTailSize);
+    } else if (isRightPlacement(placement)) {
+        int centerY = localTargetRect.center().y();
+        if (placement == RightTop)    centerY = localTargetRect.top()    + qMin(24, localTargetRect.height() / 2);
+        if (placement == RightBottom) centerY = localTargetRect.bottom() - qMin(24, localTargetRect.height() / 2);
+        centerY = qBound(visualCardRect.top() + radius + kTailHalfWidth,
+                         centerY, visualCardRect.bottom() - radius - kTailHalfWidth);
+        tail << QPoint(visualCardRect.left() + 2, centerY - kTailHalfWidth)
+             << QPoint(visualCardRect.left() + 2, centerY + kTailHalfWidth)
+             << QPoint(visualCardRect.left() - kTailSize, centerY);
+    } else if (isLeftPlacement(placement)) {
+        int centerY = localTargetRect.center().y();
+        if (placement == LeftTop)    centerY = localTargetRect.top()    + qMin(24, localTargetRect.height() / 2);
+        if (placement == LeftBottom) centerY = localTargetRect.bottom() - qMin(24, localTargetRect.height() / 2);
+        centerY = qBound(visualCardRect.top() + radius + kTailHalfWidth,
+                         centerY, visualCardRect.bottom() - radius - kTailHalfWidth);
+        tail << QPoint(visualCardRect.right() - 2, centerY - kTailHalfWidth)
+             << QPoint(visualCardRect.right() - 2, centerY + kTailHalfWidth)
+             << QPoint(visualCardRect.right() + kTailSize, centerY);
+    }
+    return tail;
+}
+
 void TeachingTip::paintEvent(QPaintEvent*) {
     QPainter painter(this);
     painter.setRenderHint(QPainter::Antialiasing);
 
     const QRect visualCardRect = cardRect();
-    const PreferredPlacement placement = resolvedPlacement();
-    QPainterPath bubblePath;
     const int radius = themeRadius().overlay;
-    bubblePath.addRoundedRect(visualCardRect, radius, radius);
-
-    if (m_tailVisible && !targetRectInTopLevel().isEmpty()) {
-        QPolygon tail;
-        const QPoint targetTopLeft = m_target->mapTo(m_target->window(), QPoint(0, 0));
-        const QRect localTargetRect = QRect(mapFrom(m_target->window(), targetTopLeft), m_target->size());
-
-        if (isBottomPlacement(placement)) {
-            int centerX = localTargetRect.center().x();
-            if (placement == BottomLeft)  centerX = localTargetRect.left()  + qMin(24, localTargetRect.width() / 2);
-            if (placement == BottomRight) centerX = localTargetRect.right() - qMin(24, localTargetRect.width() / 2);
-            centerX = qBound(visualCardRect.left() + radius + kTailHalfWidth,
-                             centerX, visualCardRect.right() - radius - kTailHalfWidth);
-            // 底边两点向 card 内 +2px，确保 united() 有面积重叠，消除接缝线
-            tail << QPoint(centerX - kTailHalfWidth, visualCardRect.top() + 2)
-                 << QPoint(centerX + kTailHalfWidth, visualCardRect.top() + 2)
-                 << QPoint(centerX, visualCardRect.top() - kTailSize);
-        } else if (isTopPlacement(placement)) {
-            int centerX = localTargetRect.center().x();
-            if (placement == TopLeft)  centerX = localTargetRect.left()  + qMin(24, localTargetRect.width() / 2);
-            if (placement == TopRight) centerX = localTargetRect.right() - qMin(24, localTargetRect.width() / 2);
-            centerX = qBound(visualCardRect.left() + radius + kTailHalfWidth,
-                             centerX, visualCardRect.right() - radius - kTailHalfWidth);
-            tail << QPoint(centerX - kTailHalfWidth, visualCardRect.bottom() - 2)
-                 << QPoint(centerX + kTailHalfWidth, visualCardRect.bottom() - 2)
-                 << QPoint(centerX, visualCardRect.bottom() + kTailSize);
-        } else if (isRightPlacement(placement)) {
-            int centerY = localTargetRect.center().y();
-            if (placement == RightTop)    centerY = localTargetRect.top()    + qMin(24, localTargetRect.height() / 2);
-            if (placement == RightBottom) centerY = localTargetRect.bottom() - qMin(24, localTargetRect.height() / 2);
-            centerY = qBound(visualCardRect.top() + radius + kTailHalfWidth,
-                             centerY, visualCardRect.bottom() - radius - kTailHalfWidth);
-            tail << QPoint(visualCardRect.left() + 2, centerY - kTailHalfWidth)
-                 << QPoint(visualCardRect.left() + 2, centerY + kTailHalfWidth)
-                 << QPoint(visualCardRect.left() - kTailSize, centerY);
-        } else if (isLeftPlacement(placement)) {
-            int centerY = localTargetRect.center().y();
-            if (placement == LeftTop)    centerY = localTargetRect.top()    + qMin(24, localTargetRect.height() / 2);
-            if (placement == LeftBottom) centerY = localTargetRect.bottom() - qMin(24, localTargetRect.height() / 2);
-            centerY = qBound(visualCardRect.top() + radius + kTailHalfWidth,
-                             centerY, visualCardRect.bottom() - radius - kTailHalfWidth);
-            tail << QPoint(visualCardRect.right() - 2, centerY - kTailHalfWidth)
-                 << QPoint(visualCardRect.right() - 2, centerY + kTailHalfWidth)
-                 << QPoint(visualCardRect.right() + kTailSize, centerY);
-        }
+    const QPolygon tail = tailPolygon(visualCardRect, radius, resolvedPlacement());
+
+    // 形状键只含尺寸、圆角与尾巴相对 card 的几何，与绘制位置无关
+    QString shapeKey = QStringLiteral("teachingtip_%1x%2_r%3")
+                           .arg(visualCardRect.width()).arg(visualCardRect.height()).arg(radius);
+    for (const QPoint& pt : tail) {
+        const QPoint rel = pt - visualCardRect.topLeft();
+        shapeKey += QStringLiteral("_%1,%2").arg(rel.x()).arg(rel.y());
+    }
 
+    if (shapeKey != m_bubbleKey || visualCardRect.topLeft() != m_bubbleOrigin) {
+        QPainterPath bubblePath;
+        bubblePath.addRoundedRect(visualCardRect, radius, radius);
         if (!tail.isEmpty()) {
             QPainterPath tailPath;
             tailPath.addPolygon(tail);
             bubblePath = bubblePath.united(tailPath);
         }
+        m_bubblePath = bubblePath;
+        m_bubbleKey = shapeKey;
+        m_bubbleOrigin = visualCardRect.topLeft();
     }
+    const QPainterPath& bubblePath = m_bubblePath;
 
-    const auto& shadow = themeShadow(Elevation::High);
-    for (int layer = 0; layer < 8; ++layer) {
-        QColor shadowColor = shadow.color;
-        shadowColor.setAlphaF(shadow.opacity * (1.0 - (static_cast<double>(layer) / 8.0)) * 0.25);
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(shadowColor);
-        painter.drawPath(bubblePath.translated(0, 2 + layer / 2));
-    }
+    // 阴影贴图按形状键缓存，命中时不再遍历路径
+    ShadowRenderer::drawPathShadow(painter, shapeKey,
+                                   visualCardRect.adjusted(-kTailSize, -kTailSize, kTailSize, kTailSize),
+                                   [&bubblePath] { return bubblePath; }, themeShadow(Elevation::High));
 
     const auto& colors = themeColors();
     // 先填充整个 bubble（card + tail），无描边
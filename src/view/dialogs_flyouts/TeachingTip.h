@@ -2,7 +2,9 @@
 #define TEACHINGTIP_H
 
 #include <QMargins>
+#include <QPainterPath>
 #include <QPointer>
+#include <QPolygon>
 #include <QSize>
 
 #include "view/dialogs_flyouts/Popup.h"
@@ -120,6 +122,7 @@ private:
     QPoint widgetTopLeftForCardTopLeft(const QPoint& cardTopLeft,
                                        PreferredPlacement placement) const;
     QMargins tailInsets(PreferredPlacement placement) const;
+    QPolygon tailPolygon(const QRect& visualCardRect, int radius, PreferredPlacement placement) const;
 
     void markPendingCloseReason(CloseReason reason);
     void emitClosingReason();
@@ -133,6 +136,11 @@ private:
     bool m_tailVisible = true;
     QSize m_cardSizeHint = QSize(360, 200);
 
+    // 气泡路径缓存：形状键（尺寸/圆角/尾巴几何）或位置变化时才重建
+    QPainterPath m_bubblePath;
+    QString m_bubbleKey;
+    QPoint m_bubbleOrigin;
+
     CloseReason m_pendingCloseReason = Programmatic;
     bool m_closeReasonExplicit = false;
 };
@@ -5,6 +5,7 @@
 #include <QShowEvent>
 #include <QPropertyAnimation>
 #include <QEasingCurve>
+#include "utils/ShadowRenderer.h"
 
 namespace view::menus_toolbars {
 
@@ -13,7 +14,7 @@ namespace view::menus_toolbars {
 FluentMenuItem::FluentMenuItem(const QString& text, QObject* parent)
     : QWidgetAction(parent) {
     setText(text);
-    setFont(themeFont(m_fontStyle).toQFont());
+    setFont(themeQFont(m_fontStyle));
 }
 
 void FluentMenuItem::setFontStyle(const QString& style) {
@@ -24,7 +25,7 @@ void FluentMenuItem::setFontStyle(const QString& style) {
 }
 
 void FluentMenuItem::onThemeUpdated() {
-    setFont(themeFont(m_fontStyle).toQFont());
+    setFont(themeQFont(m_fontStyle));
 }
 
 // ================================ FluentMenu =================================
@@ -38,7 +39,7 @@ FluentMenu::FluentMenu(const QString& title, QWidget* parent)
     setAutoFillBackground(false);
     setContentsMargins(m_shadowSize, m_shadowSize, m_shadowSize, m_shadowSize);
 
-    setFont(themeFont(m_fontStyle).toQFont());
+    setFont(themeQFont(m_fontStyle));
     onThemeUpdated();
 }
 
@@ -54,7 +55,7 @@ void FluentMenu::onThemeUpdated() {
     int vPadding = s.gap.tight; // 4px
 
     // 同步菜单字体（影响 QMenu 内部的 actionGeometry 高度计算）
-    setFont(themeFont(m_fontStyle).toQFont());
+    setFont(themeQFont(m_fontStyle));
 
     // 使用 margins 为阴影和内部 padding 预留空间
     // 这样 QMenu 的 sizeHint 会自动包含这些边距，确保窗口足够大
@@ -211,25 +212,8 @@ void FluentMenu::showEvent(QShowEvent* event) {
 }
 
 void FluentMenu::drawShadow(QPainter& painter, const QRect& contentRect) {
-    const auto& s = themeShadow(Elevation::High);
-    const int layers = 10;
-    const int spreadStep = 1;
-    int r = themeRadius().overlay;
-
-    for (int i = 0; i < layers; ++i) {
-        double ratio = 1.0 - static_cast<double>(i) / layers;
-        QColor sc = s.color;
-        sc.setAlphaF(s.opacity * ratio * 0.35);
-
-        painter.setPen(Qt::NoPen);
-        painter.setBrush(sc);
-
-        int spread = i * spreadStep;
-        int offsetY = 2;
-        painter.drawRoundedRect(
-            contentRect.adjusted(-spread, -spread, spread, spread).translated(0, offsetY),
-            r + spread, r + spread);
-    }
+    ShadowRenderer::drawRoundedRectShadow(painter, contentRect, themeRadius().overlay,
+                                          themeShadow(Elevation::High));
 }
 
 } // namespace view::menus_toolbars
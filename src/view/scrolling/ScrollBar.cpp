@@ -6,6 +6,8 @@
 #include <QStyle>
 #include <QMouseEvent>
 
+#include "design/Animation.h"
+
 namespace view::scrolling {
 
 ScrollBar::ScrollBar(Qt::Orientation orientation, QWidget *parent)
@@ -51,15 +53,18 @@ void ScrollBar::setOpacity(qreal value) {
     update();
 }
 
+void ScrollBar::fadeTo(qreal target) {
+    auto& scheduler = ::Animation::Scheduler::instance();
+    // 滚动时每次 valueChanged 都会请求淡入：已在目标值上则不必重启补间
+    if (qFuzzyCompare(m_opacity, target) && !scheduler.isRunning(this, 0))
+        return;
+    // 使用 Fluent 快速反馈时长；进入/退出都用减速曲线，贴近 WinUI
+    scheduler.animate(this, 0, m_opacity, target, themeAnimation().fast,
+                      ::Animation::EasingType::Decelerate,
+                      [this](qreal v) { m_opacity = v; }, this);
+}
+
 void ScrollBar::ensureAnimation() {
-    if (!m_opacityAnim) {
-        m_opacityAnim = new QPropertyAnimation(this, "opacity", this);
-        const auto anim = themeAnimation();
-        m_opacityAnim->setDuration(anim.fast);              // 使用 Fluent 快速反馈时长
-        m_opacityAnim->setEasingCurve(anim.decelerate);     // 进入/退出都用减速曲线，贴近 WinUI
-        m_opacityAnim->setStartValue(0.0);
-        m_opacityAnim->setEndValue(1.0);
-    }
     if (!m_autoHideTimer) {
         m_autoHideTimer = new QTimer(this);
         m_autoHideTimer->setSingleShot(true);
@@ -69,12 +74,7 @@ void ScrollBar::ensureAnimation() {
         connect(m_autoHideTimer, &QTimer::timeout, this, [this]() {
             if (m_isHovered || m_isPressed)
                 return;
-            if (!m_opacityAnim)
-                return;
-            m_opacityAnim->stop();
-            m_opacityAnim->setStartValue(m_opacity);
-            m_opacityAnim->setEndValue(0.0);
-            m_opacityAnim->start();
+            fadeTo(0.0);
         });
     }
 }
@@ -82,10 +82,7 @@ void ScrollBar::ensureAnimation() {
 void ScrollBar::showWithAutoHide() {
     ensureAnimation();
     m_autoHideTimer->stop();
-    m_opacityAnim->stop();
-    m_opacityAnim->setStartValue(m_opacity);
-    m_opacityAnim->setEndValue(1.0);
-    m_opacityAnim->start();
+    fadeTo(1.0);
     m_autoHideTimer->start();
 }
 
@@ -114,7 +111,7 @@ void ScrollBar::paintEvent(QPaintEvent *event) {
     p.setRenderHint(QPainter::Antialiasing);
     p.setOpacity(m_opacity);
 
-    const auto colors = themeColors();
+    const auto& colors = themeColors();
     const bool isDark = (currentTheme() == FluentElement::Dark);
 
     // 轨道：使用轻量的 Subtle 填充，圆角为厚度的一半。
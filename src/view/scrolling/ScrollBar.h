@@ -7,7 +7,6 @@
 #include <QPaintEvent>
 #include <QShowEvent>
 #include <QTimer>
-#include <QPropertyAnimation>
 #include <QMargins>
 
 #include "view/FluentElement.h"
@@ -70,11 +69,11 @@ private:
     bool m_isPressed = false;
 
     // Overlay 淡入/淡出
-    qreal               m_opacity       = 0.0;
-    QPropertyAnimation* m_opacityAnim   = nullptr;
-    QTimer*             m_autoHideTimer = nullptr;
+    qreal   m_opacity       = 0.0;
+    QTimer* m_autoHideTimer = nullptr;
 
     void ensureAnimation();
+    void fadeTo(qreal target);
     void showWithAutoHide();
 };
 
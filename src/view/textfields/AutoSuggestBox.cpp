@@ -68,7 +68,7 @@ public:
         painter->save();
         painter->setRenderHint(QPainter::Antialiasing);
 
-        const auto colors = m_themeHost->themeColors();
+        const auto& colors = m_themeHost->themeColors();
         const bool selected = option.state & QStyle::State_Selected;
         const bool hovered = option.state & QStyle::State_MouseOver;
         const bool enabled = option.state & QStyle::State_Enabled;
@@ -85,7 +85,7 @@ public:
             painter->drawRoundedRect(bgRect, 4, 4);
         }
 
-        painter->setFont(m_themeHost->themeFont(m_fontRole).toQFont());
+        painter->setFont(m_themeHost->themeQFont(m_fontRole));
         painter->setPen(textColor);
 
         const QRectF textRect = QRectF(option.rect).adjusted(12, 0, -8, 0);
@@ -511,7 +511,7 @@ int AutoSuggestBox::totalPreferredHeight() const {
 }
 
 int AutoSuggestBox::inputTextVerticalPadding() const {
-    const QFont inputFont = themeFont(fontRole()).toQFont();
+    const QFont inputFont = themeQFont(fontRole());
     const int textHeight = QFontMetrics(inputFont).height();
     const int centeredPadding = qMax(0, (m_inputHeight - textHeight) / 2);
     return qMin(::Spacing::Padding::TextFieldVertical, centeredPadding);
@@ -684,7 +684,7 @@ void AutoSuggestBox::setTextWithReason(const QString& value, TextChangeReason re
 }
 
 void AutoSuggestBox::paintInputFrame(QPainter& painter) {
-    const auto colors = themeColors();
+    const auto& colors = themeColors();
     const QRectF frameRect = QRectF(inputRect()).adjusted(0.5, 0.5, -0.5, -0.5);
 
     QColor bgColor;
@@ -738,9 +738,9 @@ void AutoSuggestBox::paintInputFrame(QPainter& painter) {
 }
 
 void AutoSuggestBox::paintHeader(QPainter& painter) {
-    const auto colors = themeColors();
+    const auto& colors = themeColors();
     painter.setPen(colors.textPrimary);
-    painter.setFont(themeFont(Typography::FontRole::Body).toQFont());
+    painter.setFont(themeQFont(Typography::FontRole::Body));
     const QRect headerRect(0, 0, width(), kHeaderHeight);
     painter.drawText(headerRect, Qt::AlignLeft | Qt::AlignVCenter, m_header);
 }
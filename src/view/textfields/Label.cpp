@@ -15,13 +15,13 @@ Label::Label(QWidget* parent)
 void Label::setFluentTypography(const QString& styleName) {
     if (m_styleName == styleName) return;
     m_styleName = styleName;
-    setFont(themeFont(m_styleName).toQFont());
+    setFont(themeQFont(m_styleName));
     emit typographyChanged();
 }
 
 void Label::onThemeUpdated() {
     // 1. 使用保存的样式名更新字体 (解决切换主题后字体统一的问题)
-    setFont(themeFont(m_styleName).toQFont());
+    setFont(themeQFont(m_styleName));
 
     // 2. 更新颜色
     const auto& c = themeColors();
@@ -226,7 +226,7 @@ void LineEdit::applyThemeStyle() {
     pal.setColor(QPalette::Disabled, QPalette::Text, c.textDisabled);
     pal.setColor(QPalette::Disabled, QPalette::PlaceholderText, c.textDisabled);
     setPalette(pal);
-    setFont(themeFont(m_fontRole).toQFont());
+    setFont(themeQFont(m_fontRole));
 
     int rightPadding = m_contentMargins.right();
     if (m_clearButtonEnabled) {
@@ -691,7 +691,7 @@ bool NumberBox::setValueInternal(double value, bool updateText, bool keepUserTex
 }
 
 void NumberBox::paintInputFrame(QPainter& painter) {
-    const auto colors = themeColors();
+    const auto& colors = themeColors();
     const QRectF frameRect = QRectF(inputRect()).adjusted(0.5, 0.5, -0.5, -0.5);
 
     QColor bgColor;
@@ -750,7 +750,7 @@ void NumberBox::paintInputFrame(QPainter& painter) {
 
 void NumberBox::paintHeader(QPainter& painter) {
     if (m_header.isEmpty()) return;
-    painter.setFont(themeFont(Typography::FontRole::Body).toQFont());
+    painter.setFont(themeQFont(Typography::FontRole::Body));
     painter.setPen(isEnabled() ? themeColors().textPrimary : themeColors().textDisabled);
     const QRect headerRect(0, 0, width(), kHeaderHeight);
     painter.drawText(headerRect, Qt::AlignLeft | Qt::AlignVCenter,
@@ -278,7 +278,7 @@ bool PasswordBox::canPeekReveal() const {
 }
 
 void PasswordBox::paintInputFrame(QPainter& painter) {
-    const auto colors = themeColors();
+    const auto& colors = themeColors();
     const QRectF frameRect = QRectF(inputRect()).adjusted(0.5, 0.5, -0.5, -0.5);
 
     QColor bgColor;
@@ -337,7 +337,7 @@ void PasswordBox::paintInputFrame(QPainter& painter) {
 
 void PasswordBox::paintHeader(QPainter& painter) {
     if (m_header.isEmpty()) return;
-    painter.setFont(themeFont(Typography::FontRole::Body).toQFont());
+    painter.setFont(themeQFont(Typography::FontRole::Body));
     painter.setPen(isEnabled() ? themeColors().textPrimary : themeColors().textDisabled);
     const QRect headerRect(0, 0, width(), kHeaderHeight);
     painter.drawText(headerRect, Qt::AlignLeft | Qt::AlignVCenter,
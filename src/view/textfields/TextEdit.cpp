@@ -366,7 +366,7 @@ void TextEdit::applyThemeStyle() {
     pal.setColor(QPalette::Disabled, QPalette::Text,             c.textDisabled);
     pal.setColor(QPalette::Disabled, QPalette::PlaceholderText,  c.textDisabled);
     m_editor->setPalette(pal);
-    m_editor->setFont(themeFont(m_fontRole).toQFont());
+    m_editor->setFont(themeQFont(m_fontRole));
 
     QString qss = QString(
                     "QTextEdit { "
@@ -0,0 +1,200 @@
+#include "CollectionViewModel.h"
+#include <QDebug>
+#include <algorithm>
+#include <utility>
+
+CollectionViewModel::CollectionViewModel(QObject *parent)
+    : CollectionViewModel({ Qt::DisplayRole }, parent) {
+}
+
+CollectionViewModel::CollectionViewModel(const QVector<int> &roles, QObject *parent)
+    : QAbstractListModel(parent), m_roles(roles) {
+}
+
+void CollectionViewModel::setRoleNames(const QHash<int, QByteArray> &names) {
+    m_roleNames = names;
+}
+
+int CollectionViewModel::indexOf(const QString &key) const {
+    for (int i = 0; i < m_records.size(); ++i) {
+        if (m_records.at(i).key == key) return i;
+    }
+    return -1;
+}
+
+int CollectionViewModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : m_records.size();
+}
+
+QVariant CollectionViewModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() >= m_records.size()) return QVariant();
+    const int column = columnOf(role);
+    const QVector<QVariant> &values = m_records.at(index.row()).values;
+    return column >= 0 && column < values.size() ? values.at(column) : QVariant();
+}
+
+QHash<int, QByteArray> CollectionViewModel::roleNames() const {
+    return m_roleNames.isEmpty() ? QAbstractListModel::roleNames() : m_roleNames;
+}
+
+int CollectionViewModel::columnOf(int role) const {
+    // 角色数通常只有个位数，线性查找比哈希更快
+    for (int i = 0; i < m_roles.size(); ++i) {
+        if (m_roles.at(i) == role) return i;
+    }
+    return -1;
+}
+
+void CollectionViewModel::setRecords(QVector<Record> records) {
+    m_lastDiff = DiffStats();
+    const int before = m_records.size();
+
+    QHash<QString, int> currentRows;
+    currentRows.reserve(m_records.size());
+    for (int i = 0; i < m_records.size(); ++i) currentRows.insert(m_records.at(i).key, i);
+    QHash<QString, int> nextRows;
+    nextRows.reserve(records.size());
+    for (int i = 0; i < records.size(); ++i) nextRows.insert(records.at(i).key, i);
+
+    if (currentRows.size() != m_records.size() || nextRows.size() != records.size()) {
+        qWarning() << "CollectionViewModel::setRecords: duplicate keys, falling back to a model reset";
+        resetTo(std::move(records));
+    } else {
+        applyRemovals(nextRows);
+        applyMoves(records, currentRows, nextRows);
+        applyInsertions(records, currentRows);
+        applyUpdates(records);
+    }
+
+    if (m_records.size() != before) emit countChanged(m_records.size());
+}
+
+void CollectionViewModel::appendRecords(const QVector<Record> &records) {
+    if (records.isEmpty()) return;
+    const int first = m_records.size();
+    beginInsertRows(QModelIndex(), first, first + records.size() - 1);
+    m_records.append(records);
+    endInsertRows();
+    emit countChanged(m_records.size());
+}
+
+void CollectionViewModel::applyRemovals(const QHash<QString, int> &nextRows) {
+    // 自尾向前合并连续的待删除行，删除不影响前面行的下标
+    int row = m_records.size() - 1;
+    while (row >= 0) {
+        if (nextRows.contains(m_records.at(row).key)) { --row; continue; }
+        const int last = row;
+        while (row > 0 && !nextRows.contains(m_records.at(row - 1).key)) --row;
+        beginRemoveRows(QModelIndex(), row, last);
+        m_records.erase(m_records.begin() + row, m_records.begin() + last + 1);
+        endRemoveRows();
+        ++m_lastDiff.removed;
+        --row;
+    }
+}
+
+void CollectionViewModel::applyMoves(const QVector<Record> &next, const QHash<QString, int> &currentRows,
+                                     const QHash<QString, int> &nextRows) {
+    // 此时 m_records 只剩保留行。按它们在新快照中的位置求最长递增子序列，
+    // 子序列中的行相对顺序已正确，保持不动。
+    const int n = m_records.size();
+    QVector<int> rank(n);
+    for (int i = 0; i < n; ++i) rank[i] = nextRows.value(m_records.at(i).key);
+
+    QVector<int> tails;
+    QVector<int> prev(n, -1);
+    for (int i = 0; i < n; ++i) {
+        auto it = std::lower_bound(tails.begin(), tails.end(), rank.at(i),
+                                   [&rank](int idx, int value) { return rank.at(idx) < value; });
+        if (it != tails.begin()) prev[i] = *(it - 1);
+        if (it == tails.end()) tails.append(i);
+        else *it = i;
+    }
+    if (tails.size() == n) return;
+
+    QVector<bool> stable(next.size(), false);
+    for (int i = tails.isEmpty() ? -1 : tails.last(); i >= 0; i = prev.at(i)) stable[rank.at(i)] = true;
+
+    // 新快照下标 → 当前行号；rank 与 m_records 同步旋转，每次移动后只刷新旋转区间
+    QVector<int> rowOfRank(next.size(), -1);
+    for (int i = 0; i < n; ++i) rowOfRank[rank.at(i)] = i;
+
+    // 其余行按新快照顺序逐个放到其前驱（新快照中前一个保留行）之后；
+    // 前驱要么不动，要么已放好，因此最终顺序与新快照一致。
+    int predecessor = -1;   // 新快照中的下标
+    for (int t = 0; t < next.size(); ++t) {
+        if (!currentRows.contains(next.at(t).key)) continue;   // 新行在插入阶段处理
+        if (stable.at(t)) { predecessor = t; continue; }
+
+        // 新快照中相邻、当前也相邻的待移动行合并为一次移动
+        const int from = rowOfRank.at(t);
+        int count = 1;
+        while (t + count < next.size() && !stable.at(t + count)
+               && from + count < n && rank.at(from + count) == t + count) {
+            ++count;
+        }
+        const int to = predecessor < 0 ? 0 : rowOfRank.at(predecessor) + 1;
+        if (to < from || to > from + count) {
+            const int lo = qMin(to, from);
+            const int hi = qMax(to, from + count);
+            beginMoveRows(QModelIndex(), from, from + count - 1, QModelIndex(), to);
+            if (to < from) {
+                std::rotate(m_records.begin() + to, m_records.begin() + from, m_records.begin() + from + count);
+                std::rotate(rank.begin() + to, rank.begin() + from, rank.begin() + from + count);
+            } else {
+                std::rotate(m_records.begin() + from, m_records.begin() + from + count, m_records.begin() + to);
+                std::rotate(rank.begin() + from, rank.begin() + from + count, rank.begin() + to);
+            }
+            endMoveRows();
+            for (int r = lo; r < hi; ++r) rowOfRank[rank.at(r)] = r;
+            ++m_lastDiff.moved;
+        }
+        predecessor = t + count - 1;
+        t += count - 1;
+    }
+}
+
+void CollectionViewModel::applyInsertions(const QVector<Record> &next, const QHash<QString, int> &currentRows) {
+    // 保留行已按新顺序排列；顺序扫描时前面的行都已就位，新行的下标即最终下标
+    int row = 0;
+    while (row < next.size()) {
+        if (currentRows.contains(next.at(row).key)) { ++row; continue; }
+        const int first = row;
+        while (row + 1 < next.size() && !currentRows.contains(next.at(row + 1).key)) ++row;
+        beginInsertRows(QModelIndex(), first, row);
+        m_records.insert(first, row - first + 1, Record());
+        for (int i = first; i <= row; ++i) m_records[i] = next.at(i);
+        endInsertRows();
+        ++m_lastDiff.inserted;
+        ++row;
+    }
+}
+
+void CollectionViewModel::applyUpdates(const QVector<Record> &next) {
+    int row = 0;
+    while (row < next.size()) {
+        if (m_records.at(row).values == next.at(row).values) { ++row; continue; }
+        // 连续的变化行合并为一次 dataChanged，roles 取区间内变化角色的并集
+        const int first = row;
+        QVector<int> changedRoles;
+        for (; row < next.size() && m_records.at(row).values != next.at(row).values; ++row) {
+            const QVector<QVariant> &oldValues = m_records.at(row).values;
+            const QVector<QVariant> &newValues = next.at(row).values;
+            for (int c = 0; c < m_roles.size(); ++c) {
+                const QVariant oldValue = c < oldValues.size() ? oldValues.at(c) : QVariant();
+                const QVariant newValue = c < newValues.size() ? newValues.at(c) : QVariant();
+                if (oldValue != newValue && !changedRoles.contains(m_roles.at(c))) changedRoles.append(m_roles.at(c));
+            }
+            m_records[row].values = newValues;
+        }
+        emit dataChanged(index(first), index(row - 1), changedRoles);
+        ++m_lastDiff.updated;
+    }
+}
+
+void CollectionViewModel::resetTo(QVector<Record> &&records) {
+    beginResetModel();
+    m_records = std::move(records);
+    endResetModel();
+    m_lastDiff.reset = true;
+}
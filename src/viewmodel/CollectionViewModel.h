@@ -0,0 +1,89 @@
+#ifndef COLLECTIONVIEWMODEL_H
+#define COLLECTIONVIEWMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+
+/**
+ * @brief CollectionViewModel - 集合视图模型（ListView / GridView 的数据源）
+ *
+ * 以连续数组保存记录，每条记录由唯一 key 标识，values 按 roles() 顺序存放各角色的值。
+ * setRecords() 接收一份完整快照，与当前数据比较后只发出最小的行级变化：
+ *   删除 → 移动 → 插入 → 更新，连续行合并为一个区间信号。
+ * 视图的选中项、滚动位置与拖拽位移动画因此不会像 beginResetModel() 那样被重置，
+ * 适合 10 Hz 级别的实时数据刷新。
+ *
+ * 使用示例：
+ *   auto* vm = new CollectionViewModel({ Qt::DisplayRole, Qt::ToolTipRole }, parent);
+ *   listView->setModel(vm);
+ *   vm->setRecords({ { "a", { "Alpha", "first" } }, { "b", { "Beta", "second" } } });
+ *
+ * 移动按最长递增子序列计算：相对顺序不变的行保持不动，只移动其余行。
+ * 快照中出现重复 key 时无法确定行身份，退化为整体重置并给出警告。
+ */
+class CollectionViewModel : public QAbstractListModel {
+    Q_OBJECT
+    Q_PROPERTY(int count READ count NOTIFY countChanged)
+
+public:
+    struct Record {
+        QString key;
+        QVector<QVariant> values;   ///< 与 roles() 一一对应
+
+        bool operator==(const Record& other) const { return key == other.key && values == other.values; }
+        bool operator!=(const Record& other) const { return !(*this == other); }
+    };
+
+    /// 最近一次 setRecords() 发出的区间信号数量（每个 begin/end 对或 dataChanged 计一次）
+    struct DiffStats {
+        int removed = 0;
+        int moved = 0;
+        int inserted = 0;
+        int updated = 0;
+        bool reset = false;
+    };
+
+    explicit CollectionViewModel(QObject* parent = nullptr);
+    explicit CollectionViewModel(const QVector<int>& roles, QObject* parent = nullptr);
+
+    QVector<int> roles() const { return m_roles; }
+    void setRoleNames(const QHash<int, QByteArray>& names);
+
+    int count() const { return m_records.size(); }
+    const QVector<Record>& records() const { return m_records; }
+    const Record& record(int row) const { return m_records.at(row); }
+    int indexOf(const QString& key) const;
+
+    /** 替换为新快照，只发出差异对应的行信号 */
+    void setRecords(QVector<Record> records);
+    void clear() { setRecords({}); }
+    /** 在末尾追加一批新记录（一次 rowsInserted）；调用方保证 key 不与现有记录重复 */
+    void appendRecords(const QVector<Record>& records);
+    DiffStats lastDiff() const { return m_lastDiff; }
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+signals:
+    void countChanged(int count);
+
+private:
+    int columnOf(int role) const;
+    void applyRemovals(const QHash<QString, int>& nextRows);
+    void applyMoves(const QVector<Record>& next, const QHash<QString, int>& currentRows,
+                    const QHash<QString, int>& nextRows);
+    void applyInsertions(const QVector<Record>& next, const QHash<QString, int>& currentRows);
+    void applyUpdates(const QVector<Record>& next);
+    void resetTo(QVector<Record>&& records);
+
+    QVector<int> m_roles;
+    QHash<int, QByteArray> m_roleNames;
+    QVector<Record> m_records;
+    DiffStats m_lastDiff;
+};
+
+#endif // COLLECTIONVIEWMODEL_H
@@ -0,0 +1,196 @@
+#include "LazyTreeModel.h"
+#include "view/collections/IncrementalLoading.h"
+#include <QList>
+#include <algorithm>
+#include <iterator>
+
+using view::collections::ItemLoadingRole;
+
+LazyTreeModel::LazyTreeModel(int pageSize, QObject *parent)
+    : LazyTreeModel(pageSize, { Qt::DisplayRole }, parent) {
+}
+
+LazyTreeModel::LazyTreeModel(int pageSize, const QVector<int> &roles, QObject *parent)
+    : QAbstractItemModel(parent)
+    , m_pageSize(qMax(1, pageSize))
+    , m_roles(roles)
+    , m_root(new Node) {
+    m_root->hasChildren = true;
+}
+
+LazyTreeModel::~LazyTreeModel() = default;
+
+LazyTreeModel::Node *LazyTreeModel::nodeFor(const QModelIndex &index) const {
+    return index.isValid() ? static_cast<Node *>(index.internalPointer()) : m_root.get();
+}
+
+QModelIndex LazyTreeModel::indexFor(Node *node) const {
+    return node == m_root.get() ? QModelIndex() : createIndex(node->row, 0, node);
+}
+
+QModelIndex LazyTreeModel::index(int row, int column, const QModelIndex &parent) const {
+    const Node *node = nodeFor(parent);
+    if (column != 0 || row < 0 || row >= int(node->children.size())) return QModelIndex();
+    return createIndex(row, 0, node->children[row].get());
+}
+
+QModelIndex LazyTreeModel::parent(const QModelIndex &child) const {
+    if (!child.isValid()) return QModelIndex();
+    return indexFor(nodeFor(child)->parent);
+}
+
+int LazyTreeModel::rowCount(const QModelIndex &parent) const {
+    return parent.column() > 0 ? 0 : int(nodeFor(parent)->children.size());
+}
+
+int LazyTreeModel::columnCount(const QModelIndex &) const {
+    return 1;
+}
+
+QVariant LazyTreeModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid()) return QVariant();
+    const Node *node = nodeFor(index);
+    if (role == ItemLoadingRole) return node->placeholder;
+    if (node->placeholder) return QVariant();
+    const int column = m_roles.indexOf(role);
+    return column >= 0 && column < node->values.size() ? node->values.at(column) : QVariant();
+}
+
+Qt::ItemFlags LazyTreeModel::flags(const QModelIndex &index) const {
+    if (!index.isValid()) return Qt::ItemIsDropEnabled;
+    if (nodeFor(index)->placeholder) return Qt::ItemIsEnabled;
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsDragEnabled | Qt::ItemIsDropEnabled;
+}
+
+bool LazyTreeModel::hasChildren(const QModelIndex &parent) const {
+    const Node *node = nodeFor(parent);
+    if (node->placeholder || !node->hasChildren) return false;
+    // 未加载时按数据源的 hasChildren 显示 chevron；加载完发现为空后不再可展开
+    return !node->children.empty() || node->hasMore;
+}
+
+bool LazyTreeModel::canFetchMore(const QModelIndex &parent) const {
+    Node *node = nodeFor(parent);
+    return !node->placeholder && node->hasChildren && node->hasMore && !m_inFlight.contains(node);
+}
+
+void LazyTreeModel::fetchMore(const QModelIndex &parent) {
+    if (!canFetchMore(parent)) return;
+    Node *node = nodeFor(parent);
+    if (!node->hasPlaceholder()) insertPlaceholder(node);
+    m_inFlight.insert(node);
+    emit childrenRequested(parent, node->fetched, m_pageSize);
+}
+
+bool LazyTreeModel::isLoading(const QModelIndex &parent) const {
+    return m_inFlight.contains(nodeFor(parent));
+}
+
+void LazyTreeModel::setChildren(const QModelIndex &parent, int offset, const QVector<Child> &children, bool hasMore) {
+    Node *node = nodeFor(parent);
+    if (!m_inFlight.contains(node) || offset != node->fetched) return;
+    m_inFlight.remove(node);
+
+    if (!children.isEmpty()) {
+        const int first = node->loaded;
+        beginInsertRows(parent, first, first + children.size() - 1);
+        std::vector<std::unique_ptr<Node>> created;
+        created.reserve(children.size());
+        for (const Child &child : children) {
+            std::unique_ptr<Node> n(new Node);
+            n->parent = node;
+            n->values = child.values;
+            n->hasChildren = child.hasChildren;
+            created.push_back(std::move(n));
+        }
+        node->children.insert(node->children.begin() + first,
+                              std::make_move_iterator(created.begin()), std::make_move_iterator(created.end()));
+        renumber(node, first);
+        node->loaded += children.size();
+        node->fetched += children.size();
+        endInsertRows();
+    }
+
+    node->hasMore = hasMore;
+    if (!hasMore) {
+        removePlaceholder(node);
+        // 空目录：chevron 随 hasChildren() 变为不可展开
+        if (node->loaded == 0 && parent.isValid()) emit dataChanged(parent, parent);
+    }
+}
+
+void LazyTreeModel::setFetchFailed(const QModelIndex &parent) {
+    Node *node = nodeFor(parent);
+    if (!m_inFlight.remove(node)) return;
+    removePlaceholder(node);
+}
+
+void LazyTreeModel::cancelFetch(const QModelIndex &parent) {
+    Node *node = nodeFor(parent);
+    const QList<Node *> pending = m_inFlight.values();
+    for (Node *n : pending) {
+        if (n != node && !isAncestor(node, n)) continue;
+        m_inFlight.remove(n);
+        // 占位行保留：再次展开或占位行可见时重新请求同一页
+        emit childrenCancelled(indexFor(n));
+    }
+}
+
+bool LazyTreeModel::moveRows(const QModelIndex &sourceParent, int sourceRow, int count,
+                             const QModelIndex &destinationParent, int destinationChild) {
+    Node *src = nodeFor(sourceParent);
+    Node *dst = nodeFor(destinationParent);
+    if (count <= 0 || sourceRow < 0 || sourceRow + count > src->loaded) return false;
+    if (destinationChild < 0 || destinationChild > dst->loaded || dst->placeholder) return false;
+    for (int i = sourceRow; i < sourceRow + count; ++i) {
+        if (src->children[i].get() == dst || isAncestor(src->children[i].get(), dst)) return false;
+    }
+    if (!beginMoveRows(sourceParent, sourceRow, sourceRow + count - 1, destinationParent, destinationChild))
+        return false;
+
+    std::vector<std::unique_ptr<Node>> moving(std::make_move_iterator(src->children.begin() + sourceRow),
+                                              std::make_move_iterator(src->children.begin() + sourceRow + count));
+    src->children.erase(src->children.begin() + sourceRow, src->children.begin() + sourceRow + count);
+    src->loaded -= count;
+    if (src == dst && destinationChild > sourceRow) destinationChild -= count;
+    for (auto &n : moving) n->parent = dst;
+    dst->children.insert(dst->children.begin() + destinationChild,
+                         std::make_move_iterator(moving.begin()), std::make_move_iterator(moving.end()));
+    dst->loaded += count;
+    dst->hasChildren = true;
+    renumber(src, qMin(sourceRow, int(src->children.size())));
+    renumber(dst, destinationChild);
+    endMoveRows();
+    return true;
+}
+
+void LazyTreeModel::insertPlaceholder(Node *node) {
+    const int row = int(node->children.size());
+    beginInsertRows(indexFor(node), row, row);
+    std::unique_ptr<Node> n(new Node);
+    n->parent = node;
+    n->row = row;
+    n->placeholder = true;
+    n->hasMore = false;
+    node->children.push_back(std::move(n));
+    endInsertRows();
+}
+
+void LazyTreeModel::removePlaceholder(Node *node) {
+    if (!node->hasPlaceholder()) return;
+    const int row = int(node->children.size()) - 1;
+    beginRemoveRows(indexFor(node), row, row);
+    node->children.pop_back();
+    endRemoveRows();
+}
+
+void LazyTreeModel::renumber(Node *node, int from) {
+    for (int i = qMax(0, from); i < int(node->children.size()); ++i) node->children[i]->row = i;
+}
+
+bool LazyTreeModel::isAncestor(const Node *ancestor, const Node *node) {
+    for (const Node *p = node ? node->parent : nullptr; p; p = p->parent) {
+        if (p == ancestor) return true;
+    }
+    return false;
+}
@@ -0,0 +1,106 @@
+#ifndef LAZYTREEMODEL_H
+#define LAZYTREEMODEL_H
+
+#include <QAbstractItemModel>
+#include <QSet>
+#include <QVariant>
+#include <QVector>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief LazyTreeModel - 按需分页加载子节点的树模型（文件系统 / 服务端目录等超大树）
+ *
+ * 节点的子项在首次展开时才请求，之后按 pageSize 分页追加。
+ * 请求在途或还有后续页时，子项末尾保留一个占位行（data(ItemLoadingRole) 为 true），
+ * TreeView 在占位行上显示 ProgressRing，占位行滚入视口时继续请求下一页。
+ *
+ * 请求流程（全部在 GUI 线程）：
+ *   展开 / 占位行可见 → fetchMore(parent) → childrenRequested(parent, offset, count)
+ *   → 数据源异步取数后调用 setChildren(parent, offset, children, hasMore) 回填；
+ *   节点折叠时 TreeView 调用 cancelFetch(parent)，该子树的在途请求全部取消并发出
+ *   childrenCancelled(parent)，之后到达的回填被忽略；再次展开时重新请求。
+ *
+ * 使用示例：
+ *   auto* model = new LazyTreeModel(200, parent);
+ *   connect(model, &LazyTreeModel::childrenRequested, fs, &FsWorker::list);
+ *   connect(model, &LazyTreeModel::childrenCancelled, fs, &FsWorker::abort);
+ *   connect(fs, &FsWorker::listed, model, &LazyTreeModel::setChildren);
+ *   treeView->setModel(model);
+ *
+ * 拖放移动通过 moveRows() 完成（同一模型内任意父节点之间），不需要具体的模型类型。
+ */
+class LazyTreeModel : public QAbstractItemModel {
+    Q_OBJECT
+
+public:
+    struct Child {
+        QVector<QVariant> values;   ///< 与 roles() 一一对应
+        bool hasChildren = false;   ///< 为 true 时可展开，子项按需请求
+    };
+
+    explicit LazyTreeModel(int pageSize = 200, QObject* parent = nullptr);
+    LazyTreeModel(int pageSize, const QVector<int>& roles, QObject* parent = nullptr);
+    ~LazyTreeModel() override;
+
+    int pageSize() const { return m_pageSize; }
+    QVector<int> roles() const { return m_roles; }
+
+    /** 回填 parent 从 offset 开始的一页子项；offset 与当前进度不符（过期 / 已取消）时忽略 */
+    void setChildren(const QModelIndex& parent, int offset, const QVector<Child>& children, bool hasMore);
+    /** 请求失败：移除占位行，节点回到可再次 fetchMore 的状态 */
+    void setFetchFailed(const QModelIndex& parent);
+
+    bool isLoading(const QModelIndex& parent) const;
+    /** 当前在途请求数（用于测试 / 调试） */
+    int pendingRequests() const { return m_inFlight.size(); }
+
+    QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const override;
+    QModelIndex parent(const QModelIndex& child) const override;
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    Qt::ItemFlags flags(const QModelIndex& index) const override;
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+    bool moveRows(const QModelIndex& sourceParent, int sourceRow, int count,
+                  const QModelIndex& destinationParent, int destinationChild) override;
+
+public slots:
+    /** 取消 parent 及其已加载后代的在途请求（TreeView 折叠节点时自动调用） */
+    void cancelFetch(const QModelIndex& parent);
+
+signals:
+    void childrenRequested(const QModelIndex& parent, int offset, int count);
+    void childrenCancelled(const QModelIndex& parent);
+
+private:
+    struct Node {
+        Node* parent = nullptr;
+        int row = 0;
+        QVector<QVariant> values;
+        bool hasChildren = false;
+        bool placeholder = false;
+        bool hasMore = true;        // 还有未请求的子项页
+        int loaded = 0;             // 真实子项数（占位行之前，含拖入的节点）
+        int fetched = 0;            // 已从数据源取到的子项数，即下一页的 offset
+        std::vector<std::unique_ptr<Node>> children;
+
+        bool hasPlaceholder() const { return !children.empty() && children.back()->placeholder; }
+    };
+
+    Node* nodeFor(const QModelIndex& index) const;
+    QModelIndex indexFor(Node* node) const;
+    void insertPlaceholder(Node* node);
+    void removePlaceholder(Node* node);
+    static void renumber(Node* node, int from);
+    static bool isAncestor(const Node* ancestor, const Node* node);
+
+    int m_pageSize;
+    QVector<int> m_roles;
+    std::unique_ptr<Node> m_root;
+    QSet<Node*> m_inFlight;
+};
+
+#endif // LAZYTREEMODEL_H
@@ -0,0 +1,167 @@
+#include "PagedListModel.h"
+#include "view/collections/IncrementalLoading.h"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <utility>
+
+using view::collections::ItemLoadingRole;
+
+PagedListModel::PagedListModel(int pageSize, QObject *parent)
+    : PagedListModel(pageSize, { Qt::DisplayRole }, parent) {
+}
+
+PagedListModel::PagedListModel(int pageSize, const QVector<int> &roles, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_pageSize(qMax(1, pageSize))
+    , m_roles(roles)
+    , m_cancelDistance(4 * m_pageSize) {
+}
+
+void PagedListModel::setTotalCount(int count) {
+    count = qMax(-1, count);
+    if (m_totalCount == count) return;
+
+    beginResetModel();
+    for (int page : std::as_const(m_inFlight)) emit pageCancelled(page);
+    m_inFlight.clear();
+    m_pages.clear();
+    m_totalCount = count;
+    m_rowCount = qMax(0, count);
+    m_endReached = false;
+    m_tailPage = -1;
+    m_rangeFirst = m_rangeLast = -1;
+    endResetModel();
+    emit totalCountChanged(count);
+}
+
+void PagedListModel::setCancelDistance(int rows) {
+    m_cancelDistance = qMax(0, rows);
+    cancelFarRequests();
+}
+
+void PagedListModel::setMaxCachedPages(int pages) {
+    m_maxCachedPages = qMax(1, pages);
+    evictFarPages();
+}
+
+int PagedListModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : m_rowCount;
+}
+
+QVariant PagedListModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() >= m_rowCount) return QVariant();
+    const auto it = m_pages.constFind(index.row() / m_pageSize);
+    if (role == ItemLoadingRole) return it == m_pages.cend();
+    if (it == m_pages.cend()) return QVariant();
+
+    const int offset = index.row() % m_pageSize;
+    if (offset >= it->size()) return QVariant();
+    const int column = m_roles.indexOf(role);
+    const Row &row = it->at(offset);
+    return column >= 0 && column < row.size() ? row.at(column) : QVariant();
+}
+
+bool PagedListModel::canFetchMore(const QModelIndex &parent) const {
+    // 同一时刻只追加一页：在途期间返回 false，避免视图连续 fetchMore
+    return !parent.isValid() && m_totalCount < 0 && !m_endReached && m_tailPage < 0;
+}
+
+void PagedListModel::fetchMore(const QModelIndex &parent) {
+    if (!canFetchMore(parent)) return;
+    const int page = m_rowCount / m_pageSize;
+    beginInsertRows(QModelIndex(), m_rowCount, m_rowCount + m_pageSize - 1);
+    m_rowCount += m_pageSize;
+    endInsertRows();
+    m_tailPage = page;
+    requestPage(page);
+}
+
+void PagedListModel::setVisibleRange(int first, int last) {
+    // 视图暂时没有可见行（隐藏、尺寸为 0）时保持现有请求
+    if (first < 0 || last < first || m_rowCount == 0) return;
+    m_rangeFirst = first;
+    m_rangeLast = last;
+    last = qMin(last, m_rowCount - 1);
+    for (int page = first / m_pageSize; page <= last / m_pageSize; ++page) {
+        if (!m_pages.contains(page) && !m_inFlight.contains(page)) requestPage(page);
+    }
+    cancelFarRequests();
+    evictFarPages();
+}
+
+void PagedListModel::setPageRows(int page, const QVector<Row> &rows) {
+    if (!m_inFlight.remove(page)) return;
+
+    const int first = page * m_pageSize;
+    if (page == m_tailPage) {
+        m_tailPage = -1;
+        if (rows.size() < m_pageSize) {
+            // 不足一页：到达末尾，去掉多余的占位行
+            m_endReached = true;
+            const int extra = m_pageSize - rows.size();
+            beginRemoveRows(QModelIndex(), m_rowCount - extra, m_rowCount - 1);
+            m_rowCount -= extra;
+            endRemoveRows();
+        }
+    }
+
+    const int count = qMin(rows.size(), m_rowCount - first);
+    m_pages.insert(page, count < rows.size() ? rows.mid(0, count) : rows);
+    // 整页都从占位变为已加载（含不足一页时的空行），统一刷新
+    const int last = qMin(first + m_pageSize, m_rowCount) - 1;
+    if (last >= first) emit dataChanged(index(first), index(last));
+    evictFarPages();
+}
+
+void PagedListModel::setPageFailed(int page) {
+    if (!m_inFlight.remove(page) || page != m_tailPage) return;
+    // 追加失败：撤回占位行，之后可再次 fetchMore
+    m_tailPage = -1;
+    beginRemoveRows(QModelIndex(), page * m_pageSize, m_rowCount - 1);
+    m_rowCount = page * m_pageSize;
+    endRemoveRows();
+}
+
+void PagedListModel::requestPage(int page) {
+    m_inFlight.insert(page);
+    const int first = page * m_pageSize;
+    emit pageRequested(page, first, qMin(m_pageSize, m_rowCount - first));
+}
+
+int PagedListModel::distanceToRange(int page) const {
+    if (m_rangeFirst < 0 || m_rangeLast < m_rangeFirst) return INT_MAX;
+    const int first = page * m_pageSize;
+    const int last = first + m_pageSize - 1;
+    if (last < m_rangeFirst) return m_rangeFirst - last;
+    if (first > m_rangeLast) return first - m_rangeLast;
+    return 0;
+}
+
+void PagedListModel::cancelFarRequests() {
+    const QList<int> pages = m_inFlight.values();
+    for (int page : pages) {
+        if (page == m_tailPage) continue;   // 末页决定追加能否继续，不取消
+        if (distanceToRange(page) <= m_cancelDistance) continue;
+        m_inFlight.remove(page);
+        emit pageCancelled(page);
+    }
+}
+
+void PagedListModel::evictFarPages() {
+    if (m_pages.size() <= m_maxCachedPages) return;
+
+    QVector<QPair<int, int>> byDistance;   // (距离, 页)
+    byDistance.reserve(m_pages.size());
+    for (auto it = m_pages.cbegin(); it != m_pages.cend(); ++it)
+        byDistance.append({ distanceToRange(it.key()), it.key() });
+    std::sort(byDistance.begin(), byDistance.end(), std::greater<QPair<int, int>>());
+
+    for (const auto &entry : std::as_const(byDistance)) {
+        if (m_pages.size() <= m_maxCachedPages || entry.first == 0) break;
+        m_pages.remove(entry.second);
+        const int first = entry.second * m_pageSize;
+        const int last = qMin(first + m_pageSize, m_rowCount) - 1;
+        if (last >= first) emit dataChanged(index(first), index(last));
+    }
+}
@@ -0,0 +1,101 @@
+#ifndef PAGEDLISTMODEL_H
+#define PAGEDLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QSet>
+#include <QVariant>
+#include <QVector>
+
+/**
+ * @brief PagedListModel - 按页异步加载的稀疏列表模型（服务端结果集 / 本地桩）
+ *
+ * 行数据按 pageSize 分页缓存；尚未到达的行 data(ItemLoadingRole) 为 true，
+ * ListView / GridView 开启 incrementalLoading 后在这些行上绘制骨架占位。
+ *
+ * 请求流程（全部在 GUI 线程）：
+ *   视图滚动 → setVisibleRange(first, last)（由视图自动连接，已含预取行）
+ *   → 对范围内未缓存、未在途的页发出 pageRequested(page, firstRow, count)
+ *   → 数据源异步取数后调用 setPageRows(page, rows) 回填，发出 dataChanged；
+ *   在途页离请求范围超过 cancelDistance 行时发出 pageCancelled(page)，之后的回填被忽略。
+ * 缓存超过 maxCachedPages 页时丢弃离视口最远的页（重新变为占位行）。
+ *
+ * 总数已知时 setTotalCount(n) 一次给出全部行；总数未知（默认）时走 canFetchMore / fetchMore：
+ * 每次在末尾追加一页占位行并请求该页，回填不足一页即视为到达末尾。
+ *
+ * 使用示例：
+ *   auto* model = new PagedListModel(100, parent);
+ *   model->setTotalCount(server->count());
+ *   connect(model, &PagedListModel::pageRequested, server, &Server::fetch);
+ *   connect(model, &PagedListModel::pageCancelled, server, &Server::abort);
+ *   connect(server, &Server::fetched, model, &PagedListModel::setPageRows);
+ *   listView->setIncrementalLoading(true);
+ *   listView->setModel(model);
+ */
+class PagedListModel : public QAbstractListModel {
+    Q_OBJECT
+    Q_PROPERTY(int totalCount READ totalCount WRITE setTotalCount NOTIFY totalCountChanged)
+
+public:
+    using Row = QVector<QVariant>;   ///< 与 roles() 一一对应
+
+    explicit PagedListModel(int pageSize = 100, QObject* parent = nullptr);
+    PagedListModel(int pageSize, const QVector<int>& roles, QObject* parent = nullptr);
+
+    int pageSize() const { return m_pageSize; }
+    QVector<int> roles() const { return m_roles; }
+
+    /** 总行数；< 0 表示未知（追加模式）。修改会重置模型并取消全部在途请求 */
+    int totalCount() const { return m_totalCount; }
+    void setTotalCount(int count);
+
+    int cancelDistance() const { return m_cancelDistance; }
+    void setCancelDistance(int rows);
+    int maxCachedPages() const { return m_maxCachedPages; }
+    void setMaxCachedPages(int pages);
+
+    bool isPageLoaded(int page) const { return m_pages.contains(page); }
+    bool isPageRequested(int page) const { return m_inFlight.contains(page); }
+    QList<int> requestedPages() const { return m_inFlight.values(); }
+
+    /** 回填一页数据；该页已被取消或从未请求时忽略 */
+    void setPageRows(int page, const QVector<Row>& rows);
+    /** 请求失败：该页回到未请求状态，下次进入范围时重新请求 */
+    void setPageFailed(int page);
+
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
+public slots:
+    /** 视图当前需要的行范围（含预取）；first < 0 表示没有可见行 */
+    void setVisibleRange(int first, int last);
+
+signals:
+    void pageRequested(int page, int firstRow, int count);
+    void pageCancelled(int page);
+    void totalCountChanged(int count);
+
+private:
+    void requestPage(int page);
+    void cancelFarRequests();
+    void evictFarPages();
+    /** 页与当前请求范围之间相隔的行数；相交为 0 */
+    int distanceToRange(int page) const;
+
+    int m_pageSize;
+    QVector<int> m_roles;
+    int m_totalCount = -1;
+    int m_rowCount = 0;
+    bool m_endReached = false;
+    int m_tailPage = -1;            ///< 追加模式下正在加载的末页
+    int m_cancelDistance;
+    int m_maxCachedPages = 64;
+    int m_rangeFirst = -1;
+    int m_rangeLast = -1;
+    QHash<int, QVector<Row>> m_pages;
+    QSet<int> m_inFlight;
+};
+
+#endif // PAGEDLISTMODEL_H
@@ -0,0 +1,129 @@
+#include "RowFeed.h"
+#include <QElapsedTimer>
+#include <QThread>
+#include <utility>
+
+RowFeed::RowFeed(CollectionViewModel *model, int capacity)
+    : QObject(model), m_model(model), m_queue(std::size_t(qMax(2, capacity))) {
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(16);
+    connect(&m_timer, &QTimer::timeout, this, &RowFeed::onFrame);
+}
+
+RowFeed::~RowFeed() = default;
+
+bool RowFeed::tryAppend(QVector<Record> rows) {
+    if (rows.isEmpty()) return true;
+    Batch batch{ false, std::move(rows) };
+    return push(batch);
+}
+
+bool RowFeed::append(QVector<Record> rows, int timeoutMs) {
+    if (rows.isEmpty()) return true;
+    Batch batch{ false, std::move(rows) };
+    if (push(batch)) return true;
+    // GUI 线程就是消费者，在这里等待只会卡死
+    if (QThread::currentThread() == thread()) return false;
+
+    QElapsedTimer waited;
+    waited.start();
+    while (!push(batch)) {
+        if (timeoutMs >= 0 && waited.elapsed() >= timeoutMs) return false;
+        QThread::usleep(200);
+    }
+    return true;
+}
+
+bool RowFeed::trySetSnapshot(QVector<Record> rows) {
+    Batch batch{ true, std::move(rows) };
+    return push(batch);
+}
+
+void RowFeed::setRowBudget(int rowsPerFrame) {
+    m_rowBudget = qMax(1, rowsPerFrame);
+}
+
+void RowFeed::setTimeBudget(int ms) {
+    m_timeBudgetMs = qMax(1, ms);
+}
+
+void RowFeed::setFrameInterval(int ms) {
+    m_timer.setInterval(qMax(1, ms));
+}
+
+bool RowFeed::hasPending() const {
+    return !m_carry.rows.isEmpty() || !m_queue.isEmpty();
+}
+
+bool RowFeed::push(Batch &batch) {
+    if (!m_queue.tryPush(batch)) return false;
+    wake();
+    return true;
+}
+
+void RowFeed::wake() {
+    // 只有第一个把标志从 false 置为 true 的生产者投递唤醒，其余入队不产生事件
+    if (m_wakePending.exchange(true)) return;
+    QMetaObject::invokeMethod(this, [this]() {
+        if (!m_timer.isActive()) m_timer.start();
+    }, Qt::QueuedConnection);
+}
+
+void RowFeed::onFrame() {
+    drain();
+    if (hasPending()) return;
+
+    m_timer.stop();
+    m_wakePending.store(false);
+    // 生产者可能在标志复位前入队而未唤醒：复位后再检查一次
+    if (!m_queue.isEmpty() && !m_wakePending.exchange(true)) m_timer.start();
+}
+
+int RowFeed::drain() {
+    if (!m_model) return 0;
+
+    QElapsedTimer clock;
+    clock.start();
+    QVector<Record> rows;
+    int budget = m_rowBudget;
+    int written = 0;
+
+    // 同一帧取出的追加行合并为一次 appendRecords
+    auto flush = [&]() {
+        if (rows.isEmpty()) return;
+        m_model->appendRecords(rows);
+        written += rows.size();
+        rows.clear();
+    };
+    auto takeCarry = [&]() {
+        const int n = qMin(budget, m_carry.rows.size() - m_carryOffset);
+        if (rows.isEmpty() && m_carryOffset == 0 && n == m_carry.rows.size()) rows = std::move(m_carry.rows);
+        else rows += m_carry.rows.mid(m_carryOffset, n);
+        m_carryOffset += n;
+        budget -= n;
+        if (m_carryOffset >= m_carry.rows.size()) {
+            m_carry = Batch();
+            m_carryOffset = 0;
+        }
+    };
+
+    if (!m_carry.rows.isEmpty()) takeCarry();
+    while (budget > 0 && clock.elapsed() < m_timeBudgetMs) {
+        Batch batch;
+        if (!m_queue.tryPop(batch)) break;
+        if (batch.snapshot) {
+            flush();
+            budget -= batch.rows.size();
+            written += batch.rows.size();
+            m_model->setRecords(std::move(batch.rows));
+            continue;
+        }
+        m_carry = std::move(batch);
+        m_carryOffset = 0;
+        takeCarry();
+    }
+    flush();
+
+    if (written > 0) emit drained(written);
+    return written;
+}
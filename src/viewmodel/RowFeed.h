@@ -0,0 +1,84 @@
+#ifndef ROWFEED_H
+#define ROWFEED_H
+
+#include <QObject>
+#include <QPointer>
+#include <QTimer>
+#include <QVector>
+#include <atomic>
+
+#include "CollectionViewModel.h"
+#include "utils/RingBuffer.h"
+
+/**
+ * @brief RowFeed - 工作线程向 CollectionViewModel 投递行数据的通道
+ *
+ * 生产者（任意线程，可多个）把整批记录放入无锁环形队列，不经过排队信号；
+ * GUI 线程每帧（默认 16ms）取一次，受行数预算与时间预算限制，
+ * 同一帧取出的追加行合并为一次 rowsInserted，超出预算的部分留到下一帧，
+ * 因此持续高速写入时输入事件与绘制仍能按时处理。
+ *
+ * 队列满即背压：tryAppend 立即返回 false；append 在工作线程中等待空位（可设超时）。
+ * 快照批次（trySetSnapshot）按顺序经 setRecords 整体比较后应用，不拆分。
+ *
+ * 使用示例（ListView / GridView / TreeView 均可直接以 model 作为数据模型）：
+ *   auto* model = new CollectionViewModel(parent);
+ *   auto* feed = new RowFeed(model);
+ *   listView->setModel(model);
+ *   // 工作线程
+ *   feed->append(std::move(rows));
+ */
+class RowFeed : public QObject {
+    Q_OBJECT
+
+public:
+    using Record = CollectionViewModel::Record;
+
+    /// capacity 为队列可容纳的批次数
+    explicit RowFeed(CollectionViewModel* model, int capacity = 256);
+    ~RowFeed() override;
+
+    // --- 生产者接口（线程安全） ---
+    bool tryAppend(QVector<Record> rows);
+    /** 队列满时等待空位；timeoutMs < 0 表示一直等待。在 GUI 线程调用时不等待 */
+    bool append(QVector<Record> rows, int timeoutMs = -1);
+    bool trySetSnapshot(QVector<Record> rows);
+
+    // --- GUI 线程 ---
+    int rowBudget() const { return m_rowBudget; }
+    void setRowBudget(int rowsPerFrame);
+    int timeBudget() const { return m_timeBudgetMs; }
+    void setTimeBudget(int ms);
+    int frameInterval() const { return m_timer.interval(); }
+    void setFrameInterval(int ms);
+
+    /** 按预算消费一帧，返回写入模型的行数（帧定时器内部调用，也可手动调用） */
+    int drain();
+    /** 是否还有未写入模型的数据 */
+    bool hasPending() const;
+
+signals:
+    void drained(int rows);
+
+private:
+    struct Batch {
+        bool snapshot = false;
+        QVector<Record> rows;
+    };
+
+    bool push(Batch& batch);
+    void wake();
+    void onFrame();
+
+    QPointer<CollectionViewModel> m_model;
+    RingBuffer<Batch> m_queue;
+    std::atomic<bool> m_wakePending{ false };
+    QTimer m_timer;
+
+    Batch m_carry;            ///< 上一帧未取完的追加批次
+    int m_carryOffset = 0;
+    int m_rowBudget = 4096;
+    int m_timeBudgetMs = 4;
+};
+
+#endif // ROWFEED_H
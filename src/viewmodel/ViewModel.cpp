@@ -1,4 +1,6 @@
 #include "ViewModel.h"
+#include "view/QMLPlus.h"
+#include <utility>
 
 ViewModel::ViewModel(QObject *parent)
     : QObject(parent) {
@@ -7,28 +9,62 @@ ViewModel::ViewModel(QObject *parent)
 void ViewModel::setText(const QString &t) {
     if (m_text != t) {
         m_text = t;
-        emit textChanged(t);
+        notifyChanged(TextProperty);
     }
 }
 
 void ViewModel::setEnabled(bool e) {
     if (m_enabled != e) {
         m_enabled = e;
-        emit enabledChanged(e);
+        notifyChanged(EnabledProperty);
     }
 }
 
 void ViewModel::setTitle(const QString &t) {
     if (m_title != t) {
         m_title = t;
-        emit titleChanged(t);
+        notifyChanged(TitleProperty);
     }
 }
 
 void ViewModel::setVisible(bool v) {
     if (m_visible != v) {
         m_visible = v;
-        emit visibleChanged(v);
+        notifyChanged(VisibleProperty);
     }
 }
 
+void ViewModel::beginUpdate() {
+    ++m_updateDepth;
+    view::BindingEngine::instance().beginBatch();
+}
+
+void ViewModel::endUpdate() {
+    if (m_updateDepth == 0) return;
+    if (--m_updateDepth == 0) {
+        // 按属性声明顺序逐个通知一次；通知中再次修改属性会立即发出（已不在事务中）
+        const quint32 pending = std::exchange(m_pendingChanges, 0u);
+        for (Property p : { TextProperty, EnabledProperty, TitleProperty, VisibleProperty }) {
+            if (pending & (1u << p)) emitChanged(p);
+        }
+    }
+    // 通知全部发出后再结束批处理，绑定目标在此统一写入一次
+    view::BindingEngine::instance().endBatch();
+}
+
+void ViewModel::notifyChanged(Property property) {
+    if (m_updateDepth > 0) {
+        m_pendingChanges |= 1u << property;
+        return;
+    }
+    emitChanged(property);
+}
+
+void ViewModel::emitChanged(Property property) {
+    switch (property) {
+        case TextProperty:    emit textChanged(m_text); break;
+        case EnabledProperty: emit enabledChanged(m_enabled); break;
+        case TitleProperty:   emit titleChanged(m_title); break;
+        case VisibleProperty: emit visibleChanged(m_visible); break;
+    }
+}
@@ -16,6 +16,13 @@
  *   PropertyBinder::bind(vm, "enabled", button, "enabled");
  *   PropertyBinder::bind(vm, "title", dialog, "windowTitle");
  *   PropertyBinder::bind(vm, "visible", dialog, "visible", PropertyBinder::TwoWay);
+ *
+ * 事务：beginUpdate() / endUpdate() 之间的修改不立即发出通知信号，
+ * 最外层 endUpdate() 时每个变化过的属性只通知一次（携带最终值），
+ * 并同步刷新 BindingEngine，经 QMLPlus::bind 绑定的控件只写入 / 重新布局一次：
+ *   vm->beginUpdate();
+ *   vm->setTitle("..."); vm->setText("..."); vm->setEnabled(false);
+ *   vm->endUpdate();
  */
 class ViewModel : public QObject {
     Q_OBJECT
@@ -43,6 +50,11 @@ public:
     bool visible() const { return m_visible; }
     void setVisible(bool v);
 
+    // 事务（可嵌套）
+    void beginUpdate();
+    void endUpdate();
+    bool isUpdating() const { return m_updateDepth > 0; }
+
 signals:
     void textChanged(const QString &t);
     void enabledChanged(bool e);
@@ -50,6 +62,13 @@ signals:
     void visibleChanged(bool v);
 
 private:
+    enum Property { TextProperty, EnabledProperty, TitleProperty, VisibleProperty };
+    void notifyChanged(Property property);
+    void emitChanged(Property property);
+
+    int m_updateDepth = 0;
+    quint32 m_pendingChanges = 0;   ///< 事务中待通知的属性位集
+
     QString m_text;
     bool m_enabled = true;
     QString m_title;
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <QAbstractItemModelTester>
+#include <QCoreApplication>
+#include <QPersistentModelIndex>
+#include <QRandomGenerator>
+#include <QtTest/QSignalSpy>
+
+#include "viewmodel/CollectionViewModel.h"
+
+using Record = CollectionViewModel::Record;
+
+namespace {
+
+QVector<Record> makeRecords(const QStringList& keys, const QString& suffix = QString()) {
+    QVector<Record> records;
+    for (const QString& key : keys) records.append({ key, { key + suffix } });
+    return records;
+}
+
+QStringList keysOf(const CollectionViewModel& vm) {
+    QStringList keys;
+    for (const Record& r : vm.records()) keys.append(r.key);
+    return keys;
+}
+
+} // namespace
+
+class CollectionViewModelTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        int argc = 0;
+        char** argv = nullptr;
+        if (!QCoreApplication::instance()) new QCoreApplication(argc, argv);
+    }
+};
+
+TEST_F(CollectionViewModelTest, FirstSnapshotIsOneInsertion) {
+    CollectionViewModel vm;
+    QSignalSpy inserted(&vm, &QAbstractItemModel::rowsInserted);
+    QSignalSpy reset(&vm, &QAbstractItemModel::modelReset);
+    QSignalSpy count(&vm, &CollectionViewModel::countChanged);
+
+    vm.setRecords(makeRecords({ "a", "b", "c" }));
+    EXPECT_EQ(inserted.count(), 1);
+    EXPECT_EQ(reset.count(), 0);
+    EXPECT_EQ(count.count(), 1);
+    EXPECT_EQ(vm.rowCount(), 3);
+    EXPECT_EQ(vm.data(vm.index(1)).toString(), QStringLiteral("b"));
+}
+
+TEST_F(CollectionViewModelTest, ValueChangeEmitsDataChangedForChangedRowsOnly) {
+    CollectionViewModel vm({ Qt::DisplayRole, Qt::ToolTipRole });
+    vm.setRecords({ { "a", { "A", "tip" } }, { "b", { "B", "tip" } }, { "c", { "C", "tip" } } });
+
+    QSignalSpy changed(&vm, &QAbstractItemModel::dataChanged);
+    QSignalSpy inserted(&vm, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removed(&vm, &QAbstractItemModel::rowsRemoved);
+    vm.setRecords({ { "a", { "A", "tip" } }, { "b", { "B", "changed" } }, { "c", { "C", "tip" } } });
+
+    ASSERT_EQ(changed.count(), 1);
+    EXPECT_EQ(changed.at(0).at(0).value<QModelIndex>().row(), 1);
+    EXPECT_EQ(changed.at(0).at(1).value<QModelIndex>().row(), 1);
+    EXPECT_EQ(changed.at(0).at(2).value<QVector<int>>(), QVector<int>{ Qt::ToolTipRole });
+    EXPECT_EQ(inserted.count(), 0);
+    EXPECT_EQ(removed.count(), 0);
+}
+
+TEST_F(CollectionViewModelTest, MovingOneRowIsASingleMove) {
+    CollectionViewModel vm;
+    vm.setRecords(makeRecords({ "a", "b", "c", "d", "e" }));
+
+    QSignalSpy moved(&vm, &QAbstractItemModel::rowsMoved);
+    QSignalSpy inserted(&vm, &QAbstractItemModel::rowsInserted);
+    QSignalSpy removed(&vm, &QAbstractItemModel::rowsRemoved);
+    vm.setRecords(makeRecords({ "b", "c", "d", "e", "a" }));
+
+    EXPECT_EQ(moved.count(), 1);
+    EXPECT_EQ(inserted.count(), 0);
+    EXPECT_EQ(removed.count(), 0);
+    EXPECT_EQ(keysOf(vm), QStringList({ "b", "c", "d", "e", "a" }));
+}
+
+TEST_F(CollectionViewModelTest, ContiguousRangesAreBatched) {
+    CollectionViewModel vm;
+    vm.setRecords(makeRecords({ "a", "b", "c", "d", "e", "f" }));
+
+    // 删除 b..d 为一个区间，新增 x..z 为一个区间
+    vm.setRecords(makeRecords({ "a", "x", "y", "z", "e", "f" }));
+    EXPECT_EQ(vm.lastDiff().removed, 1);
+    EXPECT_EQ(vm.lastDiff().inserted, 1);
+    EXPECT_EQ(vm.lastDiff().moved, 0);
+    EXPECT_EQ(vm.lastDiff().updated, 0);
+    EXPECT_EQ(keysOf(vm), QStringList({ "a", "x", "y", "z", "e", "f" }));
+}
+
+TEST_F(CollectionViewModelTest, PersistentIndexFollowsItsRecord) {
+    CollectionViewModel vm;
+    vm.setRecords(makeRecords({ "a", "b", "c", "d" }));
+    QPersistentModelIndex selected(vm.index(2));   // "c"
+
+    vm.setRecords(makeRecords({ "n", "d", "c", "a" }, QStringLiteral("!")));
+    ASSERT_TRUE(selected.isValid());
+    EXPECT_EQ(selected.row(), 2);
+    EXPECT_EQ(selected.data().toString(), QStringLiteral("c!"));
+}
+
+TEST_F(CollectionViewModelTest, RandomSnapshotsMatchAndKeepModelConsistent) {
+    CollectionViewModel vm;
+    QAbstractItemModelTester tester(&vm, QAbstractItemModelTester::FailureReportingMode::Warning);
+    QRandomGenerator rng(20240517);
+
+    QStringList pool;
+    for (int i = 0; i < 60; ++i) pool.append(QStringLiteral("k%1").arg(i));
+
+    for (int round = 0; round < 200; ++round) {
+        QStringList keys;
+        for (const QString& key : pool) {
+            if (rng.bounded(3) != 0) keys.append(key);
+        }
+        // 打乱部分顺序
+        for (int swaps = rng.bounded(6); swaps > 0 && keys.size() > 1; --swaps)
+            keys.swapItemsAt(rng.bounded(keys.size()), rng.bounded(keys.size()));
+
+        vm.setRecords(makeRecords(keys, QString::number(rng.bounded(2))));
+        ASSERT_EQ(keysOf(vm), keys) << "round " << round;
+        ASSERT_FALSE(vm.lastDiff().reset);
+    }
+}
+
+TEST_F(CollectionViewModelTest, LargeReversedSnapshotMovesEachRowOnce) {
+    CollectionViewModel vm;
+    QStringList keys;
+    for (int i = 0; i < 5000; ++i) keys.append(QStringLiteral("k%1").arg(i));
+    vm.setRecords(makeRecords(keys));
+    QPersistentModelIndex first(vm.index(0));
+
+    // 完全倒序：最长递增子序列只有一行，其余每行各移动一次
+    QStringList reversed(keys.crbegin(), keys.crend());
+    QSignalSpy moved(&vm, &QAbstractItemModel::rowsMoved);
+    vm.setRecords(makeRecords(reversed));
+
+    EXPECT_EQ(keysOf(vm), reversed);
+    EXPECT_EQ(vm.lastDiff().moved, keys.size() - 1);
+    EXPECT_EQ(moved.count(), keys.size() - 1);
+    EXPECT_FALSE(vm.lastDiff().reset);
+    ASSERT_TRUE(first.isValid());
+    EXPECT_EQ(first.row(), keys.size() - 1);
+}
+
+TEST_F(CollectionViewModelTest, DuplicateKeysFallBackToReset) {
+    CollectionViewModel vm;
+    vm.setRecords(makeRecords({ "a", "b" }));
+    QSignalSpy reset(&vm, &QAbstractItemModel::modelReset);
+
+    vm.setRecords(makeRecords({ "a", "a", "c" }));
+    EXPECT_EQ(reset.count(), 1);
+    EXPECT_TRUE(vm.lastDiff().reset);
+    EXPECT_EQ(vm.rowCount(), 3);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QtTest/QSignalSpy>
+
+#include "view/collections/IncrementalLoading.h"
+#include "viewmodel/LazyTreeModel.h"
+
+using view::collections::ItemLoadingRole;
+
+namespace {
+
+QVector<LazyTreeModel::Child> folders(const QString& prefix, int first, int count, bool hasChildren = true) {
+    QVector<LazyTreeModel::Child> children;
+    for (int i = first; i < first + count; ++i)
+        children.append({ { QStringLiteral("%1 %2").arg(prefix).arg(i) }, hasChildren });
+    return children;
+}
+
+} // namespace
+
+class LazyTreeModelTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        int argc = 0;
+        char** argv = nullptr;
+        if (!QCoreApplication::instance()) new QCoreApplication(argc, argv);
+    }
+};
+
+TEST_F(LazyTreeModelTest, FetchMoreRequestsFirstPageBehindPlaceholder) {
+    LazyTreeModel model(10);
+    QSignalSpy requested(&model, &LazyTreeModel::childrenRequested);
+
+    ASSERT_TRUE(model.canFetchMore(QModelIndex()));
+    model.fetchMore(QModelIndex());
+    ASSERT_EQ(requested.count(), 1);
+    EXPECT_EQ(requested.at(0).at(1).toInt(), 0);
+    EXPECT_EQ(requested.at(0).at(2).toInt(), 10);
+    ASSERT_EQ(model.rowCount(), 1);
+    EXPECT_TRUE(model.index(0, 0).data(ItemLoadingRole).toBool());
+    // 在途期间不重复请求
+    EXPECT_FALSE(model.canFetchMore(QModelIndex()));
+    EXPECT_TRUE(model.isLoading(QModelIndex()));
+}
+
+TEST_F(LazyTreeModelTest, PagesAppendBeforePlaceholderUntilExhausted) {
+    LazyTreeModel model(10);
+    QSignalSpy requested(&model, &LazyTreeModel::childrenRequested);
+    model.fetchMore(QModelIndex());
+    model.setChildren(QModelIndex(), 0, folders(QStringLiteral("Dir"), 0, 10), true);
+
+    ASSERT_EQ(model.rowCount(), 11);
+    EXPECT_EQ(model.index(9, 0).data().toString(), QStringLiteral("Dir 9"));
+    EXPECT_TRUE(model.index(10, 0).data(ItemLoadingRole).toBool());
+    ASSERT_TRUE(model.canFetchMore(QModelIndex()));
+
+    model.fetchMore(QModelIndex());
+    ASSERT_EQ(requested.count(), 2);
+    EXPECT_EQ(requested.last().at(1).toInt(), 10);
+    model.setChildren(QModelIndex(), 10, folders(QStringLiteral("Dir"), 10, 3), false);
+
+    EXPECT_EQ(model.rowCount(), 13);
+    EXPECT_FALSE(model.index(12, 0).data(ItemLoadingRole).toBool());
+    EXPECT_FALSE(model.canFetchMore(QModelIndex()));
+    EXPECT_EQ(model.pendingRequests(), 0);
+}
+
+TEST_F(LazyTreeModelTest, EmptyFolderBecomesLeaf) {
+    LazyTreeModel model(10);
+    model.fetchMore(QModelIndex());
+    model.setChildren(QModelIndex(), 0, folders(QStringLiteral("Dir"), 0, 1), false);
+    const QModelIndex dir = model.index(0, 0);
+    ASSERT_TRUE(model.hasChildren(dir));
+
+    QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+    model.fetchMore(dir);
+    model.setChildren(dir, 0, {}, false);
+    EXPECT_EQ(model.rowCount(dir), 0);
+    EXPECT_FALSE(model.hasChildren(dir));
+    EXPECT_EQ(changed.count(), 1);
+}
+
+TEST_F(LazyTreeModelTest, CancelFetchCoversSubtreeAndIgnoresLateReplies) {
+    LazyTreeModel model(10);
+    model.fetchMore(QModelIndex());
+    model.setChildren(QModelIndex(), 0, folders(QStringLiteral("Dir"), 0, 2), false);
+    const QModelIndex dir = model.index(0, 0);
+    model.fetchMore(dir);
+    model.setChildren(dir, 0, folders(QStringLiteral("Sub"), 0, 2), true);
+    const QModelIndex sub = model.index(0, 0, dir);
+    model.fetchMore(dir);
+    model.fetchMore(sub);
+    ASSERT_EQ(model.pendingRequests(), 2);
+
+    QSignalSpy cancelled(&model, &LazyTreeModel::childrenCancelled);
+    model.cancelFetch(dir);
+    EXPECT_EQ(cancelled.count(), 2);
+    EXPECT_EQ(model.pendingRequests(), 0);
+
+    // 过期回填被忽略；占位行保留，再次展开时重新请求同一页
+    model.setChildren(dir, 2, folders(QStringLiteral("Sub"), 2, 5), false);
+    EXPECT_EQ(model.rowCount(dir), 3);
+    EXPECT_TRUE(model.index(2, 0, dir).data(ItemLoadingRole).toBool());
+    QSignalSpy requested(&model, &LazyTreeModel::childrenRequested);
+    ASSERT_TRUE(model.canFetchMore(dir));
+    model.fetchMore(dir);
+    ASSERT_EQ(requested.count(), 1);
+    EXPECT_EQ(requested.at(0).at(1).toInt(), 2);
+}
+
+TEST_F(LazyTreeModelTest, FetchFailureRemovesPlaceholderAndAllowsRetry) {
+    LazyTreeModel model(10);
+    model.fetchMore(QModelIndex());
+    model.setFetchFailed(QModelIndex());
+    EXPECT_EQ(model.rowCount(), 0);
+    EXPECT_TRUE(model.canFetchMore(QModelIndex()));
+}
+
+TEST_F(LazyTreeModelTest, MoveRowsBetweenParentsKeepsPagingOffsets) {
+    LazyTreeModel model(10);
+    model.fetchMore(QModelIndex());
+    model.setChildren(QModelIndex(), 0, folders(QStringLiteral("Dir"), 0, 3), false);
+    const QPersistentModelIndex a(model.index(0, 0));
+    const QPersistentModelIndex b(model.index(1, 0));
+    model.fetchMore(b);
+    model.setChildren(b, 0, folders(QStringLiteral("Sub"), 0, 10), true);
+
+    // 占位行之后、祖先移入后代都被拒绝
+    EXPECT_FALSE(model.moveRow(QModelIndex(), 0, b, 11));
+    EXPECT_FALSE(model.moveRow(QModelIndex(), 1, model.index(0, 0, b), 0));
+
+    ASSERT_TRUE(model.moveRow(QModelIndex(), 0, b, 10));
+    EXPECT_EQ(model.rowCount(), 2);
+    EXPECT_EQ(a.parent(), QModelIndex(b));
+    EXPECT_EQ(a.row(), 10);
+    EXPECT_TRUE(model.index(11, 0, b).data(ItemLoadingRole).toBool());
+
+    // 下一页的 offset 仍按数据源计数，不含拖入的节点
+    QSignalSpy requested(&model, &LazyTreeModel::childrenRequested);
+    model.fetchMore(b);
+    ASSERT_EQ(requested.count(), 1);
+    EXPECT_EQ(requested.at(0).at(1).toInt(), 10);
+    model.setChildren(b, 10, folders(QStringLiteral("Sub"), 10, 2), false);
+    EXPECT_EQ(model.rowCount(b), 13);
+    EXPECT_EQ(model.index(12, 0, b).data().toString(), QStringLiteral("Sub 11"));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QtTest/QSignalSpy>
+
+#include "view/collections/IncrementalLoading.h"
+#include "viewmodel/PagedListModel.h"
+
+using view::collections::ItemLoadingRole;
+
+namespace {
+
+QVector<PagedListModel::Row> pageRows(int first, int count) {
+    QVector<PagedListModel::Row> rows;
+    for (int i = first; i < first + count; ++i) rows.append({ QStringLiteral("Row %1").arg(i) });
+    return rows;
+}
+
+} // namespace
+
+class PagedListModelTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        int argc = 0;
+        char** argv = nullptr;
+        if (!QCoreApplication::instance()) new QCoreApplication(argc, argv);
+    }
+};
+
+TEST_F(PagedListModelTest, RequestsPagesCoveringRangeOnce) {
+    PagedListModel model(10);
+    model.setTotalCount(100);
+    QSignalSpy requested(&model, &PagedListModel::pageRequested);
+
+    model.setVisibleRange(15, 34);
+    ASSERT_EQ(requested.count(), 3);
+    EXPECT_EQ(requested.at(0).at(0).toInt(), 1);
+    EXPECT_EQ(requested.at(0).at(1).toInt(), 10);
+    EXPECT_EQ(requested.at(2).at(0).toInt(), 3);
+
+    // 在途页不重复请求
+    model.setVisibleRange(20, 49);
+    ASSERT_EQ(requested.count(), 4);
+    EXPECT_EQ(requested.last().at(0).toInt(), 4);
+}
+
+TEST_F(PagedListModelTest, LoadedPageReplacesPlaceholders) {
+    PagedListModel model(10);
+    model.setTotalCount(25);
+    model.setVisibleRange(0, 24);
+    EXPECT_TRUE(model.index(20).data(ItemLoadingRole).toBool());
+
+    QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+    model.setPageRows(2, pageRows(20, 5));
+    ASSERT_EQ(changed.count(), 1);
+    EXPECT_EQ(changed.at(0).at(0).toModelIndex().row(), 20);
+    EXPECT_EQ(changed.at(0).at(1).toModelIndex().row(), 24);
+    EXPECT_FALSE(model.index(20).data(ItemLoadingRole).toBool());
+    EXPECT_EQ(model.index(24).data().toString(), QStringLiteral("Row 24"));
+    EXPECT_TRUE(model.isPageLoaded(2));
+    EXPECT_FALSE(model.isPageRequested(2));
+}
+
+TEST_F(PagedListModelTest, FarRequestsAreCancelledAndLateRepliesIgnored) {
+    PagedListModel model(10);
+    model.setTotalCount(1000);
+    model.setCancelDistance(20);
+    QSignalSpy cancelled(&model, &PagedListModel::pageCancelled);
+
+    model.setVisibleRange(0, 9);
+    ASSERT_TRUE(model.isPageRequested(0));
+    model.setVisibleRange(500, 509);
+    ASSERT_EQ(cancelled.count(), 1);
+    EXPECT_EQ(cancelled.at(0).at(0).toInt(), 0);
+    EXPECT_FALSE(model.isPageRequested(0));
+
+    QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+    model.setPageRows(0, pageRows(0, 10));
+    EXPECT_EQ(changed.count(), 0);
+    EXPECT_FALSE(model.isPageLoaded(0));
+}
+
+TEST_F(PagedListModelTest, EvictsPagesFarthestFromRange) {
+    PagedListModel model(10);
+    model.setTotalCount(1000);
+    model.setMaxCachedPages(2);
+    for (int page = 0; page < 3; ++page) {
+        model.setVisibleRange(page * 10, page * 10 + 9);
+        model.setPageRows(page, pageRows(page * 10, 10));
+    }
+    EXPECT_FALSE(model.isPageLoaded(0));
+    EXPECT_TRUE(model.isPageLoaded(1));
+    EXPECT_TRUE(model.isPageLoaded(2));
+    EXPECT_TRUE(model.index(0).data(ItemLoadingRole).toBool());
+}
+
+TEST_F(PagedListModelTest, FetchMoreAppendsUntilShortPage) {
+    PagedListModel model(10);
+    QSignalSpy requested(&model, &PagedListModel::pageRequested);
+    ASSERT_TRUE(model.canFetchMore(QModelIndex()));
+
+    model.fetchMore(QModelIndex());
+    EXPECT_EQ(model.rowCount(), 10);
+    EXPECT_FALSE(model.canFetchMore(QModelIndex()));   // 在途期间不再追加
+    model.setPageRows(0, pageRows(0, 10));
+    ASSERT_TRUE(model.canFetchMore(QModelIndex()));
+
+    model.fetchMore(QModelIndex());
+    model.setPageRows(1, pageRows(10, 4));
+    EXPECT_EQ(model.rowCount(), 14);
+    EXPECT_FALSE(model.canFetchMore(QModelIndex()));
+    EXPECT_EQ(requested.count(), 2);
+}
+
+TEST_F(PagedListModelTest, FailedAppendCanBeRetried) {
+    PagedListModel model(10);
+    model.fetchMore(QModelIndex());
+    model.setPageFailed(0);
+    EXPECT_EQ(model.rowCount(), 0);
+    EXPECT_TRUE(model.canFetchMore(QModelIndex()));
+}
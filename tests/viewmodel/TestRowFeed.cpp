@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QtTest/QSignalSpy>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "utils/RingBuffer.h"
+#include "viewmodel/RowFeed.h"
+
+using Record = CollectionViewModel::Record;
+
+namespace {
+
+QVector<Record> makeRows(int first, int count) {
+    QVector<Record> rows;
+    rows.reserve(count);
+    for (int i = first; i < first + count; ++i) rows.append({ QString::number(i), { i } });
+    return rows;
+}
+
+bool waitUntil(const std::function<bool()>& done, int timeoutMs = 5000) {
+    QElapsedTimer timer;
+    timer.start();
+    while (!done() && timer.elapsed() < timeoutMs)
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    return done();
+}
+
+} // namespace
+
+class RowFeedTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        int argc = 0;
+        char** argv = nullptr;
+        if (!QCoreApplication::instance()) new QCoreApplication(argc, argv);
+    }
+};
+
+TEST_F(RowFeedTest, RingBufferKeepsPerProducerOrder) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+    RingBuffer<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (int i = 0; i < kPerProducer; ++i) {
+                int value = p * kPerProducer + i;
+                while (!queue.tryPush(value)) std::this_thread::yield();
+            }
+        });
+    }
+
+    int last[kProducers] = { -1, -1, -1, -1 };
+    int received = 0;
+    bool ordered = true;
+    while (received < kProducers * kPerProducer) {
+        int value = 0;
+        if (!queue.tryPop(value)) { std::this_thread::yield(); continue; }
+        const int p = value / kPerProducer;
+        ordered = ordered && value % kPerProducer > last[p];
+        last[p] = value % kPerProducer;
+        ++received;
+    }
+    for (auto& t : producers) t.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(queue.isEmpty());
+}
+
+TEST_F(RowFeedTest, FullQueueAppliesBackPressure) {
+    CollectionViewModel model;
+    RowFeed feed(&model, 4);
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(feed.tryAppend(makeRows(i * 10, 10)));
+    EXPECT_FALSE(feed.tryAppend(makeRows(40, 10)));
+    EXPECT_FALSE(feed.append(makeRows(40, 10), 0));   // GUI 线程不等待
+
+    feed.setRowBudget(1000);
+    EXPECT_EQ(feed.drain(), 40);
+    EXPECT_TRUE(feed.tryAppend(makeRows(40, 10)));
+}
+
+TEST_F(RowFeedTest, DrainRespectsRowBudgetAndCoalescesInserts) {
+    CollectionViewModel model;
+    RowFeed feed(&model);
+    feed.setRowBudget(250);
+    for (int i = 0; i < 6; ++i) ASSERT_TRUE(feed.tryAppend(makeRows(i * 100, 100)));
+
+    QSignalSpy inserted(&model, &QAbstractItemModel::rowsInserted);
+    EXPECT_EQ(feed.drain(), 250);
+    EXPECT_EQ(inserted.count(), 1);
+    EXPECT_EQ(feed.drain(), 250);
+    EXPECT_EQ(feed.drain(), 100);
+    EXPECT_FALSE(feed.hasPending());
+    ASSERT_EQ(model.rowCount(), 600);
+    for (int i = 0; i < 600; ++i) ASSERT_EQ(model.record(i).key, QString::number(i));
+}
+
+TEST_F(RowFeedTest, SnapshotIsAppliedInOrder) {
+    CollectionViewModel model;
+    RowFeed feed(&model);
+    ASSERT_TRUE(feed.tryAppend(makeRows(0, 5)));
+    ASSERT_TRUE(feed.trySetSnapshot(makeRows(3, 4)));
+    ASSERT_TRUE(feed.tryAppend(makeRows(7, 1)));
+
+    feed.drain();
+    ASSERT_EQ(model.rowCount(), 5);
+    EXPECT_EQ(model.record(0).key, QStringLiteral("3"));
+    EXPECT_EQ(model.record(4).key, QStringLiteral("7"));
+}
+
+TEST_F(RowFeedTest, WorkerThreadsFeedModelWithoutQueuedSignalsPerRow) {
+    constexpr int kBatches = 100;
+    constexpr int kBatchSize = 500;
+    CollectionViewModel model;
+    RowFeed feed(&model, 8);
+    feed.setRowBudget(2000);
+    feed.setFrameInterval(4);
+
+    std::atomic<bool> ok{ true };
+    QThread* worker = QThread::create([&feed, &ok]() {
+        for (int b = 0; b < kBatches; ++b) {
+            if (!feed.append(makeRows(b * kBatchSize, kBatchSize), 5000)) ok = false;
+        }
+    });
+    worker->start();
+
+    EXPECT_TRUE(waitUntil([&model]() { return model.rowCount() == kBatches * kBatchSize; }));
+    worker->wait();
+    delete worker;
+
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(model.record(kBatches * kBatchSize - 1).key, QString::number(kBatches * kBatchSize - 1));
+}
@@ -10,6 +10,26 @@
 
 using namespace view;
 
+namespace {
+// 统计 Move / Resize 事件，用于确认未变化的控件没有被重新 setGeometry
+class GeometryEventCounter : public QObject {
+public:
+    using QObject::QObject;
+    int count = 0;
+protected:
+    bool eventFilter(QObject*, QEvent* event) override {
+        if (event->type() == QEvent::Move || event->type() == QEvent::Resize) ++count;
+        return false;
+    }
+};
+
+// 混入 QMLPlus 的最小控件：锚点经 anchors() 修改，由布局按版本号同步
+class AnchoredWidget : public QWidget, public QMLPlus {
+public:
+    using QWidget::QWidget;
+};
+} // namespace
+
 class AnchorLayoutTest : public ::testing::Test {
 protected:
     static void SetUpTestSuite() {
@@ -169,3 +189,211 @@ TEST_F(AnchorLayoutTest, FullScenarioVisualCheck) {
         qApp->exec();
     }
 }
+
+TEST_F(AnchorLayoutTest, DeepChainResolvesInSingleLayoutRegardlessOfOrder) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    // 依赖方先于被依赖方加入，且链深远超旧实现的 5 轮迭代上限
+    const int count = 200;
+    QVector<QWidget*> widgets;
+    for (int i = 0; i < count; ++i) {
+        auto* w = new QWidget(window);
+        w->setFixedSize(40, 20);
+        widgets.append(w);
+    }
+    for (int i = count - 1; i >= 0; --i) {
+        AnchorLayout::Anchors a;
+        a.left = i == 0 ? AnchorLayout::Anchor(window, Edge::Left, 0)
+                        : AnchorLayout::Anchor(widgets[i - 1], Edge::Right, 2);
+        a.top = {window, Edge::Top, 5};
+        layout->addAnchoredWidget(widgets[i], a);
+    }
+    window->show();
+
+    EXPECT_TRUE(layout->anchorCycle().isEmpty());
+    for (int i = 0; i < count; ++i) {
+        // right() = left + width - 1，再加 2 像素偏移
+        EXPECT_EQ(widgets[i]->geometry(), QRect(i * 41, 5, 40, 20)) << "widget " << i;
+    }
+}
+
+TEST_F(AnchorLayoutTest, CycleIsReportedAndOtherItemsStillResolve) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    auto* a = new QWidget(window);
+    auto* b = new QWidget(window);
+    auto* c = new QWidget(window);
+    for (QWidget* w : { a, b, c }) w->setFixedSize(30, 30);
+
+    AnchorLayout::Anchors aa;
+    aa.left = {b, Edge::Right, 0};
+    layout->addAnchoredWidget(a, aa);
+    AnchorLayout::Anchors ab;
+    ab.left = {a, Edge::Right, 0};
+    layout->addAnchoredWidget(b, ab);
+    AnchorLayout::Anchors ac;
+    ac.right = {window, Edge::Right, -10};
+    ac.bottom = {window, Edge::Bottom, -10};
+    layout->addAnchoredWidget(c, ac);
+
+    window->show();
+
+    const QVector<QWidget*> cycle = layout->anchorCycle();
+    EXPECT_EQ(cycle.size(), 2);
+    EXPECT_TRUE(cycle.contains(a));
+    EXPECT_TRUE(cycle.contains(b));
+    EXPECT_EQ(c->geometry(), QRect(600 - 10 - 30, 600 - 10 - 30, 30, 30));
+
+    // 打破环后重新编译，诊断清空
+    AnchorLayout::Anchors fixed;
+    fixed.left = {window, Edge::Left, 10};
+    layout->addAnchoredWidget(a, fixed);
+    layout->setGeometry(window->rect());
+    EXPECT_TRUE(layout->anchorCycle().isEmpty());
+    EXPECT_EQ(a->x(), 10);
+    EXPECT_EQ(b->x(), 10 + 30);
+}
+
+TEST_F(AnchorLayoutTest, RetargetingAnchorRecompilesOrder) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    auto* first = new QWidget(window);
+    auto* second = new QWidget(window);
+    first->setFixedSize(50, 20);
+    second->setFixedSize(50, 20);
+
+    AnchorLayout::Anchors a1;
+    a1.left = {window, Edge::Left, 0};
+    layout->addAnchoredWidget(first, a1);
+    AnchorLayout::Anchors a2;
+    a2.left = {first, Edge::Right, 1};
+    layout->addAnchoredWidget(second, a2);
+    window->show();
+    EXPECT_EQ(second->x(), 50);
+
+    // 反转依赖方向：first 改为锚定 second，second 改为锚定父控件
+    a2.left = {window, Edge::Left, 100};
+    layout->addAnchoredWidget(second, a2);
+    a1.left = {second, Edge::Right, 1};
+    layout->addAnchoredWidget(first, a1);
+    layout->setGeometry(window->rect());
+    EXPECT_EQ(second->x(), 100);
+    EXPECT_EQ(first->x(), 150);
+}
+
+TEST_F(AnchorLayoutTest, RelayoutOnlyTouchesDirtySubgraph) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    // a → b → c 为锚定父控件左侧的链；d 锚定父控件右下
+    auto* a = new QWidget(window);
+    auto* b = new QWidget(window);
+    auto* c = new QWidget(window);
+    auto* d = new QWidget(window);
+    for (QWidget* w : { a, b, c, d }) w->setFixedSize(40, 20);
+
+    AnchorLayout::Anchors aa;
+    aa.left = {window, Edge::Left, 10};
+    aa.top = {window, Edge::Top, 10};
+    layout->addAnchoredWidget(a, aa);
+    AnchorLayout::Anchors ab;
+    ab.left = {a, Edge::Right, 5};
+    ab.top = {a, Edge::Top, 0};
+    layout->addAnchoredWidget(b, ab);
+    AnchorLayout::Anchors ac;
+    ac.left = {b, Edge::Right, 5};
+    ac.top = {b, Edge::Top, 0};
+    layout->addAnchoredWidget(c, ac);
+    AnchorLayout::Anchors ad;
+    ad.right = {window, Edge::Right, -10};
+    ad.bottom = {window, Edge::Bottom, -10};
+    layout->addAnchoredWidget(d, ad);
+
+    window->show();
+    layout->setGeometry(QRect(0, 0, 600, 600));
+    EXPECT_EQ(layout->lastEvaluatedCount(), 0);
+
+    GeometryEventCounter moved[4];
+    QWidget* widgets[4] = { a, b, c, d };
+    for (int i = 0; i < 4; ++i) widgets[i]->installEventFilter(&moved[i]);
+
+    // 父矩形变化：只有直接依赖父控件的 a、d 被求值；a 结果不变，不向下游传播
+    layout->setGeometry(QRect(0, 0, 500, 600));
+    EXPECT_EQ(layout->lastEvaluatedCount(), 2);
+    EXPECT_EQ(moved[0].count, 0);
+    EXPECT_EQ(moved[1].count, 0);
+    EXPECT_EQ(moved[2].count, 0);
+    EXPECT_GT(moved[3].count, 0);
+    EXPECT_EQ(d->geometry(), QRect(500 - 10 - 40, 600 - 10 - 20, 40, 20));
+
+    // b 的 sizeHint 变化：只重新求值 b 及其下游 c
+    b->setFixedSize(80, 20);
+    layout->setGeometry(QRect(0, 0, 500, 600));
+    EXPECT_EQ(layout->lastEvaluatedCount(), 2);
+    // right() = left + width - 1
+    EXPECT_EQ(b->geometry(), QRect(10 + 39 + 5, 10, 80, 20));
+    EXPECT_EQ(c->x(), b->geometry().right() + 5);
+    EXPECT_EQ(moved[0].count, 0);
+}
+
+TEST_F(AnchorLayoutTest, OffsetChangeReevaluatesItemAndDownstream) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    auto* a = new QWidget(window);
+    auto* b = new QWidget(window);
+    a->setFixedSize(40, 20);
+    b->setFixedSize(40, 20);
+    AnchorLayout::Anchors aa;
+    aa.left = {window, Edge::Left, 0};
+    layout->addAnchoredWidget(a, aa);
+    AnchorLayout::Anchors ab;
+    ab.left = {a, Edge::Right, 1};
+    layout->addAnchoredWidget(b, ab);
+    window->show();
+
+    aa.left.offset = 30;
+    layout->addAnchoredWidget(a, aa);
+    layout->setGeometry(window->rect());
+    EXPECT_EQ(a->x(), 30);
+    EXPECT_EQ(b->x(), 30 + 40);
+    EXPECT_TRUE(layout->anchorCycle().isEmpty());
+}
+
+TEST_F(AnchorLayoutTest, QmlPlusAnchorsSyncByVersion) {
+    using Edge = AnchorLayout::Edge;
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+
+    auto* item = new AnchoredWidget(window);
+    item->setFixedSize(40, 20);
+    item->anchors()->left = {window, Edge::Left, 10};
+    item->anchors()->top = {window, Edge::Top, 10};
+    layout->addWidget(item);
+    window->show();
+    EXPECT_EQ(item->pos(), QPoint(10, 10));
+
+    // 稳态：锚点版本未变，不重新求值
+    const quint64 version = item->anchorsVersion();
+    layout->setGeometry(window->rect());
+    EXPECT_EQ(layout->lastEvaluatedCount(), 0);
+    EXPECT_EQ(item->anchorsVersion(), version);
+
+    // 只读访问不改变版本号
+    EXPECT_EQ(item->currentAnchors().left.offset, 10);
+    EXPECT_EQ(item->anchorsVersion(), version);
+
+    // 经 anchors() 修改：版本号递增，下次布局同步并重新求值
+    item->anchors()->left.offset = 50;
+    EXPECT_GT(item->anchorsVersion(), version);
+    layout->setGeometry(window->rect());
+    EXPECT_EQ(layout->lastEvaluatedCount(), 1);
+    EXPECT_EQ(item->pos(), QPoint(50, 10));
+
+    // 版本号变化但内容相同：同步后不置脏
+    item->anchors();
+    layout->setGeometry(window->rect());
+    EXPECT_EQ(layout->lastEvaluatedCount(), 0);
+}
@@ -0,0 +1,246 @@
+#include <gtest/gtest.h>
+#include <QApplication>
+#include <QWidget>
+#include <QVBoxLayout>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QTest>
+#include <QTimer>
+#include <QPointer>
+#include <QStringListModel>
+#include <QStyledItemDelegate>
+#include "utils/DebugOverlay.h"
+#include "utils/PaintProfiler.h"
+#include "view/FluentElement.h"
+#include "view/basicinput/Button.h"
+#include "view/collections/ListView.h"
+
+class DebugOverlayTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        int argc = 0;
+        char **argv = nullptr;
+        if (!qApp) {
+            new QApplication(argc, argv);
+        }
+        QApplication::setStyle("Fusion");
+    }
+
+    void SetUp() override {
+        FluentElement::setTheme(FluentElement::Light);
+
+        window = new QWidget();
+        window->setAttribute(Qt::WA_DontShowOnScreen, true);
+        window->resize(300, 200);
+        auto* layout = new QVBoxLayout(window);
+        canvas = new QWidget(window);
+        canvas->setObjectName(QStringLiteral("canvas"));
+        canvas->setMinimumSize(200, 100);
+        layout->addWidget(canvas);
+    }
+
+    void TearDown() override {
+        delete window;
+        FluentElement::setTheme(FluentElement::Light);
+    }
+
+    QWidget* window;
+    QWidget* canvas;
+};
+
+TEST_F(DebugOverlayTest, ProfilerRecordsPaintsInSubtree) {
+    PaintProfiler profiler;
+    profiler.attach(window);
+    window->show();
+    QTest::qWait(50);
+
+    const int before = profiler.stats(canvas).paintCount;
+    for (int i = 0; i < 5; ++i) canvas->repaint(QRect(10, 10, 20, 20));
+    const PaintProfiler::WidgetStats stats = profiler.stats(canvas);
+    EXPECT_EQ(stats.paintCount, before + 5);
+    EXPECT_EQ(stats.name, QStringLiteral("QWidget#canvas"));
+    EXPECT_GE(stats.paintNs, stats.maxPaintNs);
+
+    // 重绘区域以 root 坐标记录
+    const QVector<QRect> rects = profiler.recentRepaints(1000);
+    const QRect expected(canvas->mapTo(window, QPoint(10, 10)), QSize(20, 20));
+    EXPECT_TRUE(rects.contains(expected));
+
+    // attach 之后新增的子控件同样被采样
+    auto* late = new QWidget(canvas);
+    late->setGeometry(0, 0, 30, 30);
+    late->show();
+    late->repaint();
+    EXPECT_GE(profiler.stats(late).paintCount, 1);
+
+    profiler.detach();
+    const int detached = profiler.stats(canvas).paintCount;
+    canvas->repaint();
+    EXPECT_EQ(profiler.stats(canvas).paintCount, detached);
+}
+
+namespace {
+
+class CountingDelegate : public QStyledItemDelegate {
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+    void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const override {
+        ++paints;
+        QStyledItemDelegate::paint(painter, option, index);
+    }
+    mutable int paints = 0;
+};
+
+class PaintCounter : public QObject {
+public:
+    using QObject::QObject;
+    bool eventFilter(QObject*, QEvent* event) override {
+        if (event->type() == QEvent::Paint) ++paints;
+        return false;
+    }
+    int paints = 0;
+};
+
+} // namespace
+
+TEST_F(DebugOverlayTest, ProfilerKeepsScrollAreaViewportPainting) {
+    // QAbstractScrollArea 通过视口上的事件过滤器绘制内容，采样器不能绕过它
+    auto* list = new view::collections::ListView(canvas);
+    list->setGeometry(0, 0, 200, 100);
+    list->setModel(new QStringListModel({ "A", "B", "C" }, list));
+    auto* delegate = new CountingDelegate(list);
+    list->setItemDelegate(delegate);
+
+    PaintProfiler profiler;
+    profiler.attach(window);
+    window->show();
+    QTest::qWait(50);
+
+    delegate->paints = 0;
+    list->viewport()->repaint();
+    EXPECT_GE(delegate->paints, 3);
+    EXPECT_GE(profiler.stats(list->viewport()).paintCount, 1);
+}
+
+TEST_F(DebugOverlayTest, ProfilerIsTransparentToLaterFilters) {
+    PaintProfiler profiler;
+    profiler.attach(window);
+    window->show();
+    QTest::qWait(50);
+
+    // 晚于采样器安装的过滤器先收到事件，每次重绘仍只应看到一次 Paint
+    PaintCounter counter;
+    canvas->installEventFilter(&counter);
+    const int before = profiler.stats(canvas).paintCount;
+    for (int i = 0; i < 3; ++i) canvas->repaint();
+    EXPECT_EQ(counter.paints, 3);
+    EXPECT_EQ(profiler.stats(canvas).paintCount, before + 3);
+    canvas->removeEventFilter(&counter);
+}
+
+TEST_F(DebugOverlayTest, ProfilerMeasuresThemeUpdates) {
+    auto* button = new view::basicinput::Button(QStringLiteral("Fluent"), canvas);
+    PaintProfiler profiler;
+    profiler.attach(window);
+    window->show();
+    QTest::qWait(50);
+
+    FluentElement::setTheme(FluentElement::Dark);
+    EXPECT_EQ(profiler.stats(button).themeUpdates, 1);
+    EXPECT_GE(profiler.lastThemeUpdateCount(), 1);
+    EXPECT_GT(profiler.lastThemeUpdateNs(), 0);
+
+    // 子树外的元素不计入
+    view::basicinput::Button outside(QStringLiteral("Outside"));
+    FluentElement::setTheme(FluentElement::Light);
+    FluentElement::flushThemeUpdates();
+    EXPECT_EQ(profiler.stats(&outside).themeUpdates, 0);
+}
+
+TEST_F(DebugOverlayTest, ProfilerRingBufferKeepsNewestSamples) {
+    PaintProfiler profiler;
+    profiler.attach(window);
+    profiler.setMaxSamples(5);
+    window->show();
+    QTest::qWait(50);
+
+    for (int i = 0; i < 12; ++i) canvas->repaint();
+    const QVector<PaintProfiler::Sample> samples = profiler.samples();
+    ASSERT_EQ(samples.size(), 5);
+    for (int i = 1; i < samples.size(); ++i)
+        EXPECT_LE(samples[i - 1].timestampUs, samples[i].timestampUs);
+    EXPECT_EQ(samples.last().kind, PaintProfiler::SampleKind::Paint);
+}
+
+TEST_F(DebugOverlayTest, ProfilerExportsCsvAndJsonTrace) {
+    PaintProfiler profiler;
+    profiler.attach(window);
+    window->show();
+    QTest::qWait(50);
+    for (int i = 0; i < 3; ++i) canvas->repaint();
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const int count = profiler.samples().size();
+    ASSERT_GT(count, 0);
+
+    const QString csvPath = dir.filePath(QStringLiteral("trace.csv"));
+    ASSERT_TRUE(profiler.exportCsv(csvPath));
+    QFile csv(csvPath);
+    ASSERT_TRUE(csv.open(QIODevice::ReadOnly | QIODevice::Text));
+    const QList<QByteArray> lines = csv.readAll().trimmed().split('\n');
+    EXPECT_EQ(lines.first(), QByteArray("timestamp_us,kind,widget,duration_us,x,y,width,height,value"));
+    EXPECT_EQ(lines.size(), count + 1);
+
+    const QString jsonPath = dir.filePath(QStringLiteral("trace.json"));
+    ASSERT_TRUE(profiler.exportJson(jsonPath));
+    QFile json(jsonPath);
+    ASSERT_TRUE(json.open(QIODevice::ReadOnly));
+    const QJsonArray events = QJsonDocument::fromJson(json.readAll()).object()
+                                  .value(QStringLiteral("traceEvents")).toArray();
+    ASSERT_EQ(events.size(), count);
+    bool sawCanvas = false;
+    for (const QJsonValue& v : events) {
+        const QJsonObject e = v.toObject();
+        if (e.value(QStringLiteral("name")).toString() == QStringLiteral("QWidget#canvas")) {
+            sawCanvas = true;
+            EXPECT_EQ(e.value(QStringLiteral("ph")).toString(), QStringLiteral("X"));
+            EXPECT_EQ(e.value(QStringLiteral("args")).toObject().value(QStringLiteral("rect")).toArray().size(), 4);
+        }
+    }
+    EXPECT_TRUE(sawCanvas);
+}
+
+TEST_F(DebugOverlayTest, HudRollsPerSecondStatsAndFollowsRoot) {
+    window->show();
+    QTest::qWait(50);
+
+    QPointer<DebugOverlay> hud = DebugOverlay::attachHud(window);
+    ASSERT_TRUE(hud);
+    ASSERT_TRUE(hud->profiler());
+    EXPECT_EQ(hud->profiler()->root(), window);
+    EXPECT_TRUE(hud->isWindow());
+    EXPECT_TRUE(hud->windowFlags().testFlag(Qt::WindowTransparentForInput));
+    EXPECT_EQ(hud->size(), window->size());
+
+    QTimer driver;
+    QObject::connect(&driver, &QTimer::timeout, canvas, [this]() { canvas->update(); });
+    driver.start(20);
+    QTest::qWait(1100);
+    driver.stop();
+
+    EXPECT_GT(hud->profiler()->paintsPerSecond(), 0);
+    const auto top = hud->profiler()->topWidgets(3);
+    ASSERT_FALSE(top.isEmpty());
+    EXPECT_GT(top.first().paintsPerSecond, 0);
+    // HUD 为独立窗口，不出现在被测子树的统计中
+    EXPECT_EQ(hud->profiler()->stats(hud).paintCount, 0);
+
+    delete window;
+    window = nullptr;
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    EXPECT_FALSE(hud);
+}
@@ -3,6 +3,7 @@
 #include <QWidget>
 #include "view/FluentElement.h"
 #include "design/CornerRadius.h"
+#include "design/Animation.h"
 
 // 模拟一个继承自 FluentElement 的组件
 class MockComponent : public QWidget, public FluentElement {
@@ -29,6 +30,7 @@ public:
 #include <QGraphicsDropShadowEffect>
 #include <QStackedLayout>
 #include <QMap>
+#include <QVector>
 
 #include <QPropertyAnimation>
 #include <QResizeEvent>
@@ -36,6 +38,8 @@ public:
 #include <QPainter>
 #include <QPainterPath>
 #include <QLinearGradient>
+#include <QTest>
+#include <algorithm>
 
 // 材质预览卡片：用 paintEvent 手动合成渐变底图 + 材质覆盖层，避免 QSS/QPalette 无法做透明合成的问题
 class MaterialPreviewCard : public QWidget {
@@ -462,6 +466,7 @@ protected:
 
 TEST_F(FluentElementTest, ThemeSwitching) {
     MockComponent component;
+    component.show();  // 可见窗口同步收到主题回调（隐藏窗口见 DeferredThemeUpdate）
     EXPECT_EQ(FluentElement::currentTheme(), FluentElement::Light);
     EXPECT_EQ(component.updateCount, 0);
 
@@ -476,6 +481,57 @@ TEST_F(FluentElementTest, ThemeSwitching) {
     EXPECT_EQ(component.updateCount, 2);
 }
 
+TEST_F(FluentElementTest, DeferredThemeUpdateForHiddenWindow) {
+    MockComponent hidden;
+    MockComponent child(&hidden);
+
+    // 隐藏窗口不立即回调，显示时一次性补发
+    FluentElement::setTheme(FluentElement::Dark);
+    EXPECT_EQ(hidden.updateCount, 0);
+    EXPECT_EQ(child.updateCount, 0);
+
+    // 隐藏期间多次切换只补发一次
+    FluentElement::setTheme(FluentElement::Light);
+    FluentElement::setTheme(FluentElement::Dark);
+    hidden.show();
+    EXPECT_EQ(hidden.updateCount, 1);
+    EXPECT_EQ(child.updateCount, 1);
+
+    // 显式 flush 用于离屏渲染等不显示窗口的场景
+    hidden.hide();
+    FluentElement::setTheme(FluentElement::Light);
+    EXPECT_EQ(hidden.updateCount, 1);
+    FluentElement::flushThemeUpdates();
+    EXPECT_EQ(hidden.updateCount, 2);
+    EXPECT_EQ(child.updateCount, 2);
+}
+
+TEST_F(FluentElementTest, ThemeTransitionHookReportsPhases) {
+    MockComponent visible;
+    visible.show();
+    MockComponent hidden;
+
+    QVector<FluentElement::ThemeTransitionStats> stats;
+    FluentElement::setThemeTransitionHook([&](const FluentElement::ThemeTransitionStats& s) {
+        stats.append(s);
+    });
+
+    FluentElement::setTheme(FluentElement::Dark);
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats[0].phase, FluentElement::ThemeTransitionStats::Grouping);
+    EXPECT_EQ(stats[1].phase, FluentElement::ThemeTransitionStats::VisibleWindows);
+    EXPECT_GE(stats[1].elements, 1);
+    EXPECT_GE(stats[1].nsecs, 0);
+
+    hidden.show();
+    ASSERT_EQ(stats.size(), 3);
+    EXPECT_EQ(stats[2].phase, FluentElement::ThemeTransitionStats::DeferredWindows);
+    EXPECT_EQ(stats[2].windows, 1);
+    EXPECT_EQ(stats[2].elements, 1);
+
+    FluentElement::setThemeTransitionHook(nullptr);
+}
+
 TEST_F(FluentElementTest, ColorTokenMapping) {
     MockComponent component;
     
@@ -497,6 +553,26 @@ TEST_F(FluentElementTest, ColorTokenMapping) {
     EXPECT_TRUE(darkColors.grey190.isValid());
 }
 
+TEST_F(FluentElementTest, ColorTableIsCachedPerTheme) {
+    MockComponent a;
+    MockComponent b;
+
+    // 同一主题下所有实例共享同一张不可变表：返回引用而非每次构建新结构
+    FluentElement::setTheme(FluentElement::Light);
+    const FluentElement::Colors* light = &a.themeColors();
+    EXPECT_EQ(light, &b.themeColors());
+    EXPECT_EQ(light, &a.themeColors());
+
+    // setTheme 切换整张表，旧引用仍指向 Light 表且内容不变
+    FluentElement::setTheme(FluentElement::Dark);
+    const FluentElement::Colors* dark = &a.themeColors();
+    EXPECT_NE(light, dark);
+    EXPECT_NE(light->accentDefault, dark->accentDefault);
+
+    FluentElement::setTheme(FluentElement::Light);
+    EXPECT_EQ(light, &a.themeColors());
+}
+
 TEST_F(FluentElementTest, FontTokenMapping) {
     MockComponent component;
     
@@ -509,6 +585,25 @@ TEST_F(FluentElementTest, FontTokenMapping) {
     EXPECT_GT(titleFont.weight, bodyFont.weight);
 }
 
+TEST_F(FluentElementTest, FontRoleCache) {
+    MockComponent component;
+
+    // 字符串角色与枚举角色解析到同一缓存条目
+    EXPECT_EQ(FluentElement::fontRole("Title"), FluentElement::FontRole::Title);
+    EXPECT_EQ(FluentElement::fontRole("NoSuchRole"), FluentElement::FontRole::Body);
+    const QFont* title = &component.themeQFont(FluentElement::FontRole::Title);
+    EXPECT_EQ(title, &component.themeQFont("Title"));
+    EXPECT_EQ(title->pixelSize(), Typography::FontSize::Title);
+
+    const QFontMetrics& fm = component.themeFontMetrics(FluentElement::FontRole::Title);
+    EXPECT_EQ(fm.height(), QFontMetrics(component.themeFont("Title").toQFont()).height());
+    EXPECT_GT(component.themeFontMetricsF(FluentElement::FontRole::Caption).height(), 0.0);
+
+    // 主题切换后缓存重建，内容保持一致
+    FluentElement::setTheme(FluentElement::Dark);
+    EXPECT_EQ(component.themeQFont(FluentElement::FontRole::Title).pixelSize(), Typography::FontSize::Title);
+}
+
 TEST_F(FluentElementTest, RadiusAndSpacingMapping) {
     MockComponent component;
     
@@ -540,6 +635,132 @@ TEST_F(FluentElementTest, AnimationTokenMapping) {
     EXPECT_EQ(anim.decelerate.type(), QEasingCurve::OutCubic);
 }
 
+// 统计绘制次数，用于验证调度器按控件合并重绘
+class PaintCounter : public QWidget {
+public:
+    using QWidget::QWidget;
+    int paints = 0;
+protected:
+    void paintEvent(QPaintEvent*) override { ++paints; }
+};
+
+TEST_F(FluentElementTest, AnimationSchedulerRunsTweenToEnd) {
+    auto& scheduler = Animation::Scheduler::instance();
+    QObject owner;
+    QVector<qreal> values;
+    int finished = 0;
+
+    scheduler.animate(&owner, 0, 0.0, 1.0, Animation::Duration::Fast,
+                      Animation::EasingType::Decelerate,
+                      [&](qreal v) { values.append(v); }, nullptr,
+                      [&]() { ++finished; });
+    EXPECT_TRUE(scheduler.isRunning(&owner, 0));
+
+    EXPECT_TRUE(QTest::qWaitFor([&]() { return !scheduler.isRunning(&owner, 0); }, 1000));
+    ASSERT_GE(values.size(), 2);
+    EXPECT_DOUBLE_EQ(values.first(), 0.0);
+    EXPECT_DOUBLE_EQ(values.last(), 1.0);
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ(finished, 1);
+}
+
+TEST_F(FluentElementTest, AnimationSchedulerRestartAndCancel) {
+    auto& scheduler = Animation::Scheduler::instance();
+    QObject owner;
+    int finished = 0;
+    qreal value = 0.0;
+    auto apply = [&](qreal v) { value = v; };
+
+    scheduler.animate(&owner, 7, 0.0, 1.0, Animation::Duration::Normal,
+                      Animation::EasingType::Standard, apply, nullptr, [&]() { ++finished; });
+    QTest::qWait(50);
+    // 同一 (owner, key) 重新启动：前一条补间被替换，其 finished 不回调
+    scheduler.animate(&owner, 7, value, 0.0, Animation::Duration::Fast,
+                      Animation::EasingType::Standard, apply, nullptr, [&]() { finished += 10; });
+    EXPECT_TRUE(QTest::qWaitFor([&]() { return !scheduler.isRunning(&owner, 7); }, 1000));
+    EXPECT_EQ(finished, 10);
+    EXPECT_DOUBLE_EQ(value, 0.0);
+
+    scheduler.animate(&owner, 7, 0.0, 1.0, Animation::Duration::Normal,
+                      Animation::EasingType::Standard, apply, nullptr, [&]() { ++finished; });
+    QTest::qWait(50);
+    scheduler.cancel(&owner, 7);
+    const qreal frozen = value;
+    QTest::qWait(300);
+    EXPECT_FALSE(scheduler.isRunning(&owner, 7));
+    EXPECT_DOUBLE_EQ(value, frozen);
+    EXPECT_EQ(finished, 10);
+
+    // durationMs <= 0：立即应用终值并结束
+    scheduler.animate(&owner, 8, 0.0, 0.5, 0, Animation::EasingType::Standard, apply, nullptr,
+                      [&]() { ++finished; });
+    EXPECT_DOUBLE_EQ(value, 0.5);
+    EXPECT_EQ(finished, 11);
+    EXPECT_FALSE(scheduler.isRunning(&owner, 8));
+}
+
+TEST_F(FluentElementTest, AnimationSchedulerDropsDestroyedOwner) {
+    auto& scheduler = Animation::Scheduler::instance();
+    int applied = 0;
+    int finished = 0;
+    {
+        QObject owner;
+        scheduler.animate(&owner, 0, 0.0, 1.0, Animation::Duration::Normal,
+                          Animation::EasingType::Standard, [&](qreal) { ++applied; }, nullptr,
+                          [&]() { ++finished; });
+    }
+    const int before = applied;
+    QTest::qWait(350);
+    EXPECT_EQ(applied, before);
+    EXPECT_EQ(finished, 0);
+    EXPECT_EQ(scheduler.activeCount(), 0);
+}
+
+TEST_F(FluentElementTest, AnimationSchedulerPoolsTweensAndBatchesRepaints) {
+    auto& scheduler = Animation::Scheduler::instance();
+    auto* target = new PaintCounter(window);
+    layout->addWidget(target);
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    window->resize(200, 200);
+    window->show();
+    QTest::qWait(50);
+
+    constexpr int kTweens = 64;
+    QVector<qreal> values(kTweens);
+    int frames = 0;
+    auto conn = QObject::connect(&scheduler, &Animation::Scheduler::frameTicked,
+                                 [&](int) { ++frames; });
+
+    auto startAll = [&](qreal to) {
+        for (int i = 0; i < kTweens; ++i) {
+            scheduler.animate(target, quintptr(i), values[i], to, Animation::Duration::Fast,
+                              Animation::EasingType::Decelerate,
+                              [&values, i](qreal v) { values[i] = v; }, target);
+        }
+    };
+
+    // 第一轮：池扩容到并发上限
+    startAll(1.0);
+    EXPECT_EQ(scheduler.activeCount(), kTweens);
+    EXPECT_TRUE(QTest::qWaitFor([&]() { return scheduler.activeCount() == 0; }, 1000));
+    const int pool = scheduler.poolSize();
+    EXPECT_GE(pool, kTweens);
+
+    // 第二轮（模拟悬停风暴反复启停）：复用池中的补间，不再扩容
+    target->paints = 0;
+    frames = 0;
+    for (int round = 0; round < 5; ++round) startAll(round % 2 ? 1.0 : 0.0);
+    EXPECT_TRUE(QTest::qWaitFor([&]() { return scheduler.activeCount() == 0; }, 1000));
+    EXPECT_EQ(scheduler.poolSize(), pool);
+
+    // 64 条补间共用一个重绘目标：每帧至多一次绘制，而不是每条补间一次
+    EXPECT_GT(frames, 0);
+    EXPECT_LE(target->paints, frames + 1);
+    for (qreal v : values) EXPECT_DOUBLE_EQ(v, 0.0);
+
+    QObject::disconnect(conn);
+}
+
 TEST_F(FluentElementTest, MaterialAndShadow) {
     MockComponent component;
 
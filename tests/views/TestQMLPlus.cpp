@@ -4,9 +4,12 @@
 #include <QPushButton>
 #include <QLabel>
 #include <QTimer>
+#include <QColor>
+#include <QElapsedTimer>
 #include "view/QMLPlus.h"
 #include "view/basicinput/Button.h"
 #include "view/textfields/Label.h"
+#include "viewmodel/ViewModel.h"
 
 using namespace view;
 using namespace view::basicinput;
@@ -59,6 +62,38 @@ public:
     }
 };
 
+// 统计属性写入次数的目标控件（用于验证合并更新）
+class WriteCounter : public QWidget, public QMLPlus {
+    Q_OBJECT
+    Q_PROPERTY(QString value READ value WRITE setValue)
+public:
+    using QWidget::QWidget;
+    QString value() const { return m_value; }
+    void setValue(const QString& v) { m_value = v; ++writes; }
+    int writes = 0;
+private:
+    QString m_value;
+};
+
+// 状态切换目标：可插值（int / QColor）与不可插值（QString）属性各一
+class StateTarget : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int level READ level WRITE setLevel)
+    Q_PROPERTY(QColor color READ color WRITE setColor)
+    Q_PROPERTY(QString label READ label WRITE setLabel)
+public:
+    int level() const { return m_level; }
+    void setLevel(int v) { m_level = v; }
+    QColor color() const { return m_color; }
+    void setColor(const QColor& c) { m_color = c; }
+    QString label() const { return m_label; }
+    void setLabel(const QString& l) { m_label = l; }
+private:
+    int m_level = 0;
+    QColor m_color = Qt::white;
+    QString m_label = QStringLiteral("idle");
+};
+
 // =============================================================================
 // 3. Test Fixture
 // =============================================================================
@@ -91,7 +126,219 @@ protected:
 };
 
 // =============================================================================
-// 4. Test Case
+// 4. 类型化绑定
+// =============================================================================
+TEST_F(QMLPlusTest, TypedBindingCallsGetterAndSetterDirectly) {
+    Label* label = new Label(window);
+    QMetaObject::Connection c = PropertyBinder::bind<&QMLPlusViewModel::statusText, &Label::setText>(
+        vm, &QMLPlusViewModel::statusTextChanged, label);
+    ASSERT_TRUE(c);
+    EXPECT_EQ(label->text(), "System Ready");
+
+    vm->setStatusText("Online");
+    EXPECT_EQ(label->text(), "Online");
+
+    // 解除绑定后不再同步
+    QObject::disconnect(c);
+    vm->setStatusText("Offline");
+    EXPECT_EQ(label->text(), "Online");
+
+    // 目标销毁后源信号不再触达
+    Label* shortLived = new Label(window);
+    PropertyBinder::bind<&QMLPlusViewModel::statusText, &Label::setText>(
+        vm, &QMLPlusViewModel::statusTextChanged, shortLived);
+    delete shortLived;
+    vm->setStatusText("After delete");
+}
+
+TEST_F(QMLPlusTest, TypedTwoWayBindingDoesNotPingPong) {
+    QMLPlusViewModel other;
+    int sourceChanges = 0;
+    int targetChanges = 0;
+    QObject::connect(vm, &QMLPlusViewModel::isOnlineChanged, [&sourceChanges]() { ++sourceChanges; });
+    QObject::connect(&other, &QMLPlusViewModel::isOnlineChanged, [&targetChanges]() { ++targetChanges; });
+
+    vm->setIsOnline(false);
+    sourceChanges = 0;
+    PropertyBinder::bind<&QMLPlusViewModel::isOnline, &QMLPlusViewModel::setIsOnline,
+                         &QMLPlusViewModel::isOnline, &QMLPlusViewModel::setIsOnline>(
+        vm, &QMLPlusViewModel::isOnlineChanged, &other, &QMLPlusViewModel::isOnlineChanged);
+    EXPECT_FALSE(other.isOnline());
+    EXPECT_EQ(targetChanges, 1);
+
+    other.setIsOnline(true);
+    EXPECT_TRUE(vm->isOnline());
+    EXPECT_EQ(sourceChanges, 1);
+    EXPECT_EQ(targetChanges, 2);
+
+    vm->setIsOnline(false);
+    EXPECT_FALSE(other.isOnline());
+    EXPECT_EQ(sourceChanges, 2);
+    EXPECT_EQ(targetChanges, 3);
+}
+
+TEST_F(QMLPlusTest, NamedBindingStillSyncs) {
+    Label* label = new Label(window);
+    PropertyBinder::bind(vm, "statusText", label, "text");
+    EXPECT_EQ(label->text(), "System Ready");
+    vm->setStatusText("Named");
+    EXPECT_EQ(label->text(), "Named");
+}
+
+TEST_F(QMLPlusTest, BindingsCoalesceWithinOneEventLoopTick) {
+    auto* target = new WriteCounter(window);
+    target->bind("value", vm, "statusText");
+    EXPECT_EQ(target->value(), "System Ready");   // 建立时立即同步
+    EXPECT_EQ(target->writes, 1);
+
+    vm->setStatusText("a");
+    vm->setStatusText("b");
+    vm->setStatusText("c");
+    EXPECT_EQ(target->writes, 1);                  // 本轮尚未写入
+    QCoreApplication::processEvents();
+    EXPECT_EQ(target->value(), "c");
+    EXPECT_EQ(target->writes, 2);                  // 三次变化只写入一次
+}
+
+TEST_F(QMLPlusTest, ExpressionBindingTracksDependenciesDynamically) {
+    auto* target = new WriteCounter(window);
+    int evaluations = 0;
+    target->bindExpression("value", [this, &evaluations](BindingScope& s) -> QVariant {
+        ++evaluations;
+        if (!s.get<bool>(vm, "isOnline")) return QStringLiteral("offline");
+        return s.get<QString>(vm, "statusText") + QStringLiteral(" (online)");
+    });
+    EXPECT_EQ(target->value(), "System Ready (online)");
+
+    // 两个依赖同一轮内变化：只求值、写入一次
+    vm->setStatusText("Busy");
+    vm->setIsOnline(false);
+    QCoreApplication::processEvents();
+    EXPECT_EQ(target->value(), "offline");
+    EXPECT_EQ(evaluations, 2);
+    EXPECT_EQ(target->writes, 2);
+
+    // 离线分支未读取 statusText，其变化不再触发求值
+    vm->setStatusText("Ignored");
+    QCoreApplication::processEvents();
+    EXPECT_EQ(evaluations, 2);
+
+    vm->setIsOnline(true);
+    QCoreApplication::processEvents();
+    EXPECT_EQ(target->value(), "Ignored (online)");
+    EXPECT_EQ(evaluations, 3);
+}
+
+TEST_F(QMLPlusTest, ViewModelTransactionNotifiesOnceAndFlushes) {
+    ViewModel model;
+    auto* text = new WriteCounter(window);
+    auto* title = new WriteCounter(window);
+    text->bind("value", &model, "text");
+    title->bind("value", &model, "title");
+    int textSignals = 0;
+    QObject::connect(&model, &ViewModel::textChanged, [&textSignals]() { ++textSignals; });
+
+    model.beginUpdate();
+    model.setText("one");
+    model.setTitle("Title");
+    model.beginUpdate();            // 嵌套
+    model.setText("two");
+    model.endUpdate();
+    model.setText("three");
+    EXPECT_EQ(textSignals, 0);
+    EXPECT_TRUE(model.isUpdating());
+    model.endUpdate();
+
+    // 最外层结束：每个属性通知一次，绑定同步写入一次，无需等待事件循环
+    EXPECT_FALSE(model.isUpdating());
+    EXPECT_EQ(textSignals, 1);
+    // 初始值均为空字符串，建立绑定时无需写入
+    EXPECT_EQ(text->value(), "three");
+    EXPECT_EQ(text->writes, 1);
+    EXPECT_EQ(title->value(), "Title");
+    EXPECT_EQ(title->writes, 1);
+    EXPECT_EQ(BindingEngine::instance().pendingCount(), 0);
+}
+
+TEST_F(QMLPlusTest, BindingRemovedWithTarget) {
+    const int before = BindingEngine::instance().bindingCount();
+    auto* target = new WriteCounter(window);
+    target->bind("value", vm, "statusText");
+    EXPECT_EQ(BindingEngine::instance().bindingCount(), before + 1);
+
+    vm->setStatusText("pending");
+    delete target;
+    EXPECT_EQ(BindingEngine::instance().bindingCount(), before);
+    QCoreApplication::processEvents();   // 已移除的脏绑定不会被求值
+}
+
+// =============================================================================
+// 5. 状态与过渡
+// =============================================================================
+TEST_F(QMLPlusTest, StatesRestoreDefaultsWhenSwitching) {
+    QMLPlusBox box(window);
+    StateTarget target;
+    box.addState({ "hover", { { &target, "level", 10 }, { &target, "color", QColor(Qt::red) } } });
+    box.addState({ "pressed", { { &target, "level", 20 }, { &target, "label", QStringLiteral("down") } } });
+
+    box.QMLPlus::setState("hover");
+    EXPECT_EQ(target.level(), 10);
+    EXPECT_EQ(target.color(), QColor(Qt::red));
+
+    // pressed 不涉及 color：恢复默认值
+    box.QMLPlus::setState("pressed");
+    EXPECT_EQ(target.level(), 20);
+    EXPECT_EQ(target.label(), QStringLiteral("down"));
+    EXPECT_EQ(target.color(), QColor(Qt::white));
+
+    box.QMLPlus::setState("");
+    EXPECT_EQ(target.level(), 0);
+    EXPECT_EQ(target.label(), QStringLiteral("idle"));
+
+    // 未知状态被忽略
+    box.QMLPlus::setState("missing");
+    EXPECT_EQ(target.level(), 0);
+}
+
+TEST_F(QMLPlusTest, TransitionInterpolatesAndLandsOnTarget) {
+    QMLPlusBox box(window);
+    StateTarget target;
+    box.addState({ "hover", { { &target, "level", 100 }, { &target, "color", QColor(Qt::black) },
+                              { &target, "label", QStringLiteral("hot") } } });
+    QMLTransition transition;
+    transition.to = QStringLiteral("hover");
+    transition.duration = 120;
+    transition.properties = { "level" };
+    box.addTransition(transition);
+
+    box.QMLPlus::setState("hover");
+    EXPECT_LT(target.level(), 100);                  // level 走补间
+    EXPECT_EQ(target.color(), QColor(Qt::black));    // 不在过渡列表中：立即写入
+    EXPECT_EQ(target.label(), QStringLiteral("hot"));
+
+    QElapsedTimer timer;
+    timer.start();
+    while (target.level() != 100 && timer.elapsed() < 2000)
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+    EXPECT_EQ(target.level(), 100);
+
+    // 返回默认状态无匹配过渡：立即恢复
+    box.QMLPlus::setState("");
+    EXPECT_EQ(target.level(), 0);
+}
+
+TEST_F(QMLPlusTest, DynamicPropertyStateStillApplies) {
+    QMLPlusBox box(window);
+    QObject target;
+    box.addState({ "active", { { &target, "fluentState", QStringLiteral("on") } } });
+    box.QMLPlus::setState("active");
+    EXPECT_EQ(target.property("fluentState").toString(), QStringLiteral("on"));
+    box.QMLPlus::setState("");
+    EXPECT_FALSE(target.property("fluentState").isValid());
+}
+
+// =============================================================================
+// 6. Test Case
 // =============================================================================
 TEST_F(QMLPlusTest, CoreCapabilitiesVisualCheck) {
     if (qEnvironmentVariableIsSet("SKIP_VISUAL_TEST")) {
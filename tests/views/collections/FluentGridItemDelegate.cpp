@@ -31,12 +31,10 @@ void FluentGridItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem
     painter->setRenderHint(QPainter::Antialiasing);
     painter->setRenderHint(QPainter::SmoothPixmapTransform);
 
-    FluentElement::Colors colors{};
+    static const FluentElement::Colors kNoColors{};
+    const FluentElement::Colors& colors = m_themeHost ? m_themeHost->themeColors() : kNoColors;
     FluentElement::Radius radius{};
-    if (m_themeHost) {
-        colors = m_themeHost->themeColors();
-        radius = m_themeHost->themeRadius();
-    }
+    if (m_themeHost) radius = m_themeHost->themeRadius();
 
     const int cornerR = radius.control > 0 ? radius.control : CornerRadius::Control;
 
@@ -198,8 +196,8 @@ void FluentGridItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem
 
 void FluentGridItemDelegate::drawCheckOverlay(QPainter* painter, const QRectF& cellRect,
                                               bool selected, bool enabled) const {
-    FluentElement::Colors colors{};
-    if (m_themeHost) colors = m_themeHost->themeColors();
+    static const FluentElement::Colors kNoColors{};
+    const FluentElement::Colors& colors = m_themeHost ? m_themeHost->themeColors() : kNoColors;
 
     constexpr int kSize = 20;
     constexpr int kMargin = 6;
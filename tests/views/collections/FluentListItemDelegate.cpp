@@ -65,12 +65,10 @@ void FluentListItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem
     painter->save();
     painter->setRenderHint(QPainter::Antialiasing);
 
-    FluentElement::Colors colors{};
+    static const FluentElement::Colors kNoColors{};
+    const FluentElement::Colors& colors = m_themeHost ? m_themeHost->themeColors() : kNoColors;
     FluentElement::Radius radius{};
-    if (m_themeHost) {
-        colors = m_themeHost->themeColors();
-        radius = m_themeHost->themeRadius();
-    }
+    if (m_themeHost) radius = m_themeHost->themeRadius();
 
     const int hPad = Spacing::Padding::ListItemHorizontal;
     const int cornerR = radius.control > 0 ? radius.control : 4;
@@ -3,6 +3,8 @@
 
 #include <QStyledItemDelegate>
 
+#include "view/collections/ItemPaintCache.h"
+
 class FluentElement;
 class QAbstractItemView;
 class QModelIndex;
@@ -18,7 +20,7 @@ class QVariantAnimation;
  */
 namespace listview_test {
 
-class FluentListItemDelegate : public QStyledItemDelegate {
+class FluentListItemDelegate : public QStyledItemDelegate, public view::collections::PaintCacheAware {
     Q_OBJECT
 public:
     explicit FluentListItemDelegate(FluentElement* themeHost, int rowHeight,
@@ -33,6 +35,10 @@ public:
                const QModelIndex& index) const override;
     QSize sizeHint(const QStyleOptionViewItem& option,
                    const QModelIndex& index) const override;
+    /** accent 指示条动画进行中的行不走 ItemPaintCache */
+    bool isPaintVolatile(const QModelIndex& index) const override {
+        return !m_accentAnims.isEmpty() && m_accentAnims.contains(QPersistentModelIndex(index));
+    }
 
 private:
     qreal accentProgress(const QModelIndex& index) const;
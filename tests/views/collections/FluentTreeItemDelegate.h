@@ -3,6 +3,8 @@
 
 #include <QStyledItemDelegate>
 
+#include "view/collections/ItemPaintCache.h"
+
 #include "view/FluentElement.h"
 
 class QAbstractItemView;
@@ -31,7 +33,7 @@ namespace treeview_test {
 /** 自定义 Role: 存放 Segoe Fluent Icons 字符串作为行前图标 */
 static constexpr int IconGlyphRole = Qt::UserRole + 100;
 
-class FluentTreeItemDelegate : public QStyledItemDelegate {
+class FluentTreeItemDelegate : public QStyledItemDelegate, public view::collections::PaintCacheAware {
     Q_OBJECT
 public:
     explicit FluentTreeItemDelegate(FluentElement* themeHost, int rowHeight,
@@ -50,6 +52,10 @@ public:
                const QModelIndex& index) const override;
     QSize sizeHint(const QStyleOptionViewItem& option,
                    const QModelIndex& index) const override;
+    /** accent 指示条动画进行中的行不走 ItemPaintCache */
+    bool isPaintVolatile(const QModelIndex& index) const override {
+        return !m_accentAnims.isEmpty() && m_accentAnims.contains(QPersistentModelIndex(index));
+    }
     bool editorEvent(QEvent* event, QAbstractItemModel* model,
                      const QStyleOptionViewItem& option,
                      const QModelIndex& index) override;
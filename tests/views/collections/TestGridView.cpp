@@ -18,12 +18,14 @@
 
 #include "FluentGridItemDelegate.h"
 #include "view/collections/GridView.h"
+#include "view/collections/IncrementalLoading.h"
 #include "view/basicinput/Button.h"
 #include "view/scrolling/ScrollBar.h"
 #include "view/textfields/Label.h"
 #include "view/QMLPlus.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
+#include "viewmodel/PagedListModel.h"
 
 using namespace view::collections;
 using namespace view::textfields;
@@ -518,6 +520,113 @@ TEST_F(GridViewTest, CellSizeAffectsColumns) {
     EXPECT_GT(r2.top(), r0.top());
 }
 
+// ── 固定单元格布局 ────────────────────────────────────────────────────────────
+
+TEST_F(GridViewTest, FixedCellGeometryIsArithmetic) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    GridView* gv = new GridView(window);
+    gv->setGeometry(0, 0, 600, 400);
+    QStringList items;
+    for (int i = 0; i < 100; ++i) items << QString::number(i);
+    auto* m = attachStringListModel(gv, items);
+    window->show();
+    QTest::qWait(50);
+
+    // stride 116：600 / 116 = 5 列，cell 在格内水平 / 垂直各留 spacing / 2
+    EXPECT_EQ(gv->visualRect(m->index(6, 0)), QRect(116 + 2, 116 + 2, 112, 112));
+    EXPECT_EQ(gv->indexAt(QPoint(116 + 60, 116 + 60)).row(), 6);
+    // cell 之间的 spacing 不命中任何 item
+    EXPECT_FALSE(gv->indexAt(QPoint(116 + 1, 60)).isValid());
+
+    auto* vsb = gv->verticalScrollBar();
+    EXPECT_EQ(vsb->maximum(), 20 * 116 - gv->viewport()->height());
+    gv->scrollTo(m->index(99, 0));
+    EXPECT_EQ(vsb->value(), vsb->maximum());
+    const QRect r99 = gv->visualRect(m->index(99, 0));
+    EXPECT_TRUE(gv->viewport()->rect().contains(r99));
+    EXPECT_EQ(gv->indexAt(r99.center()).row(), 99);
+
+    // maxColumns 直接参与布局
+    gv->setMaxColumns(3);
+    EXPECT_EQ(gv->visualRect(m->index(3, 0)).left(), gv->visualRect(m->index(0, 0)).left());
+    EXPECT_EQ(vsb->maximum(), 34 * 116 - gv->viewport()->height());
+}
+
+TEST_F(GridViewTest, KeyboardNavigationMovesByGridRows) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    GridView* gv = new GridView(window);
+    gv->setGeometry(0, 0, 600, 400);
+    auto* m = attachStringListModel(gv, {"A","B","C","D","E","F","G","H"});
+    window->show();
+    QTest::qWait(50);
+
+    // 5 列：第二行只有 3 个 item
+    gv->setCurrentIndex(m->index(1, 0));
+    QTest::keyClick(gv, Qt::Key_Down);
+    EXPECT_EQ(gv->currentIndex().row(), 6);
+    QTest::keyClick(gv, Qt::Key_Right);
+    EXPECT_EQ(gv->currentIndex().row(), 7);
+    QTest::keyClick(gv, Qt::Key_Up);
+    EXPECT_EQ(gv->currentIndex().row(), 2);
+
+    // 下一行该列不存在时落到最后一个 item
+    gv->setCurrentIndex(m->index(4, 0));
+    QTest::keyClick(gv, Qt::Key_Down);
+    EXPECT_EQ(gv->currentIndex().row(), 7);
+    QTest::keyClick(gv, Qt::Key_Home);
+    EXPECT_EQ(gv->currentIndex().row(), 0);
+}
+
+TEST_F(GridViewTest, ShiftClickSelectsRunAcrossGridRows) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    GridView* gv = new GridView(window);
+    gv->setGeometry(0, 0, 600, 400);
+    gv->setSelectionMode(GridSelectionMode::Extended);
+    QStringList items;
+    for (int i = 0; i < 20; ++i) items << QString::number(i);
+    auto* m = attachStringListModel(gv, items);
+    window->show();
+    QTest::qWait(50);
+
+    // 锚点在右上、目标在左下：按 item 顺序选中 [3, 11]，而不是矩形
+    QTest::mouseClick(gv->viewport(), Qt::LeftButton, Qt::NoModifier,
+                      gv->visualRect(m->index(3, 0)).center());
+    QTest::mouseClick(gv->viewport(), Qt::LeftButton, Qt::ShiftModifier,
+                      gv->visualRect(m->index(11, 0)).center());
+
+    QList<int> expected;
+    for (int i = 3; i <= 11; ++i) expected << i;
+    EXPECT_EQ(gv->selectedRows(), expected);
+}
+
+TEST_F(GridViewTest, CellGeometryFollowsResize) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    constexpr int kItems = 50;
+    GridView* gv = new GridView(window);
+    gv->setGeometry(0, 0, 600, 300);
+    QStringList items;
+    for (int i = 0; i < kItems; ++i) items << QString::number(i);
+    auto* m = attachStringListModel(gv, items);
+    window->show();
+    QTest::qWait(50);
+
+    // 每次缩放后列数、滚动范围与 cell 矩形立即按 cellSize + spacing 重新计算
+    // （大数据量下的缩放耗时见 bench/views/collections 的 resize/GridView/*）
+    for (int w = 300; w <= 800; w += 70) {
+        gv->resize(w, 300);
+        const int cols = gv->viewport()->width() / 116;
+        ASSERT_GT(cols, 0);
+        auto* vsb = gv->verticalScrollBar();
+        EXPECT_EQ(vsb->maximum(), qMax(0, (kItems + cols - 1) / cols * 116 - gv->viewport()->height()))
+            << "width " << w;
+        for (int i : { 0, cols - 1, cols, kItems - 1 }) {
+            const QRect expected(i % cols * 116 + 2, i / cols * 116 + 2 - vsb->value(), 112, 112);
+            EXPECT_EQ(gv->visualRect(m->index(i, 0)), expected) << "width " << w << ", item " << i;
+        }
+        EXPECT_EQ(gv->indexAt(gv->visualRect(m->index(cols, 0)).center()).row(), cols);
+    }
+}
+
 // ── 可视化测试 ────────────────────────────────────────────────────────────────
 
 namespace {
@@ -1063,6 +1172,41 @@ TEST_F(GridViewTest, DragReorderItemReorderedSignalArgs) {
     }
 }
 
+// ── 增量加载 ──────────────────────────────────────────────────────────────────
+
+TEST_F(GridViewTest, IncrementalLoadingRequestsVisibleCellsPlusPrefetch) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    GridView* gv = new GridView(window);
+    gv->setGeometry(10, 10, 500, 400);
+    attachFluentDelegate(gv);
+    gv->setIncrementalLoading(true);
+    gv->setPrefetchDistance(30);
+
+    auto* model = new PagedListModel(40, gv);
+    model->setTotalCount(10000);
+    QList<int> requested;
+    QObject::connect(model, &PagedListModel::pageRequested, gv, [&requested](int page) { requested << page; });
+    QSignalSpy rangeSpy(gv, &GridView::visibleRangeChanged);
+    gv->setModel(model);
+    window->show();
+    QTest::qWait(50);
+
+    ASSERT_FALSE(rangeSpy.isEmpty());
+    const int first = rangeSpy.last().at(0).toInt();
+    const int last = rangeSpy.last().at(1).toInt();
+    EXPECT_EQ(first, 0);
+    // 可见 cell 数 + 预取，远小于总数
+    EXPECT_GT(last, 30);
+    EXPECT_LT(last, 200);
+    EXPECT_TRUE(requested.contains(0));
+    EXPECT_FALSE(requested.contains(last / 40 + 1));
+    EXPECT_TRUE(model->index(0, 0).data(view::collections::ItemLoadingRole).toBool());
+
+    // 滚动后请求新范围
+    gv->verticalScrollBar()->setValue(gv->verticalScrollBar()->maximum());
+    EXPECT_TRUE(requested.contains(10000 / 40 - 1));
+}
+
 TEST_F(GridViewTest, VisualCheck) {
     if (qEnvironmentVariableIsSet("SKIP_VISUAL_TEST")) {
         GTEST_SKIP() << "Set SKIP_VISUAL_TEST=1 to skip visual tests";
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <QAbstractItemView>
+#include <QAbstractListModel>
 #include <QApplication>
 #include <QFontDatabase>
+#include <QImage>
 #include <QItemSelectionModel>
 #include <QLabel>
 #include <QMetaEnum>
@@ -17,14 +19,19 @@
 
 #include "utils/DebugOverlay.h"
 #include "FluentListItemDelegate.h"
+#include "view/collections/DragDisplacement.h"
+#include "view/collections/IncrementalLoading.h"
+#include "view/collections/ItemPaintCache.h"
 #include "view/collections/ListView.h"
 #include "view/textfields/Label.h"
 #include "view/basicinput/Button.h"
 #include "view/QMLPlus.h"
+#include "design/Animation.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
 
 #include "view/scrolling/ScrollBar.h"
+#include "viewmodel/PagedListModel.h"
 
 using namespace view::collections;
 using namespace view::textfields;
@@ -874,6 +881,65 @@ TEST_F(ListViewTest, ReorderMoveRowInModel) {
     EXPECT_EQ(mdl->stringList(), (QStringList{"B", "C", "A", "D"}));
 }
 
+TEST_F(ListViewTest, DragDisplacementTracksOnlyItsWindow) {
+    DragDisplacement engine;
+    engine.setRange(100, 149);
+    EXPECT_EQ(engine.first(), 100);
+    EXPECT_EQ(engine.last(), 149);
+
+    // 首次设置目标直接到位；区间外恒为 0
+    engine.setTarget(120, QPointF(0, -40));
+    EXPECT_EQ(engine.offset(120), QPointF(0, -40));
+    engine.setTarget(10, QPointF(0, 40));
+    EXPECT_EQ(engine.offset(10), QPointF());
+
+    // 再次改变目标时补间，由同一个时钟推进
+    engine.setTarget(120, QPointF(0, 0));
+    engine.setTarget(121, QPointF(0, 40));
+    engine.setTarget(121, QPointF(0, 0));
+    EXPECT_EQ(engine.state(), QAbstractAnimation::Running);
+    QTest::qWait(::Animation::Duration::Fast + 100);
+    EXPECT_EQ(engine.state(), QAbstractAnimation::Stopped);
+    EXPECT_EQ(engine.offset(120), QPointF(0, 0));
+
+    // 平移区间保留重叠部分
+    engine.setTarget(140, QPointF(0, 12));
+    engine.setRange(130, 179);
+    EXPECT_EQ(engine.offset(140), QPointF(0, 12));
+    EXPECT_EQ(engine.offset(120), QPointF());
+
+    engine.clear();
+    EXPECT_TRUE(engine.isEmpty());
+}
+
+TEST_F(ListViewTest, DragReorderOnLargeModel) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    lv->setCanReorderItems(true);
+    QStringList items;
+    for (int i = 0; i < 50000; ++i) items << QStringLiteral("Item %1").arg(i);
+    auto* mdl = attachStringListModel(lv, items);
+    window->show();
+    QTest::qWait(50);
+
+    QSignalSpy reorderSpy(lv, &ListView::itemReordered);
+    const QRect r0 = lv->visualRect(mdl->index(0, 0));
+    const QRect r3 = lv->visualRect(mdl->index(3, 0));
+
+    QTest::mousePress(lv->viewport(), Qt::LeftButton, Qt::NoModifier, r0.center());
+    QTest::mouseMove(lv->viewport(), r0.center() + QPoint(0, QApplication::startDragDistance() + 2));
+    QTest::qWait(20);
+    QTest::mouseMove(lv->viewport(), QPoint(r3.center().x(), r3.bottom() - 2));
+    QTest::qWait(::Animation::Duration::Fast + 50);
+    QTest::mouseRelease(lv->viewport(), Qt::LeftButton, Qt::NoModifier, QPoint(r3.center().x(), r3.bottom() - 2));
+    QTest::qWait(20);
+
+    ASSERT_EQ(reorderSpy.count(), 1);
+    EXPECT_EQ(reorderSpy.at(0).at(0).toInt(), 0);
+    EXPECT_EQ(mdl->index(3, 0).data().toString(), QStringLiteral("Item 0"));
+}
+
 // ── Section tests ─────────────────────────────────────────────────────────────
 
 TEST_F(ListViewTest, DefaultSectionEnabled) {
@@ -916,6 +982,207 @@ TEST_F(ListViewTest, SetSectionKeyFunction) {
     EXPECT_TRUE(lv->sectionEnabled());
 }
 
+TEST_F(ListViewTest, SectionIndexUpdatesIncrementally) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    auto* m = attachStringListModel(lv, {"Apple", "Avocado", "Banana", "Blueberry", "Cherry"});
+
+    int keyCalls = 0;
+    lv->setSectionEnabled(true);
+    lv->setSectionKeyFunction([lv, &keyCalls](int row) -> QString {
+        ++keyCalls;
+        return lv->model()->index(row, 0).data().toString().left(1);
+    });
+    window->show();
+    QTest::qWait(50);
+
+    ASSERT_EQ(lv->sectionCount(), 3);
+    EXPECT_EQ(lv->sectionKey(1), QStringLiteral("B"));
+    EXPECT_EQ(lv->sectionStartRow(2), 4);
+    EXPECT_EQ(lv->sectionForRow(3), 1);
+
+    // 绘制与 sizeHint 只查索引，不再调用回调
+    keyCalls = 0;
+    lv->viewport()->repaint();
+    EXPECT_EQ(keyCalls, 0);
+
+    // 插入：只重新评估插入行及其前后邻行
+    m->insertRows(2, 1);
+    m->setData(m->index(2, 0), QStringLiteral("Bagel"));
+    EXPECT_LE(keyCalls, 8);
+    EXPECT_EQ(lv->sectionCount(), 3);
+    EXPECT_EQ(lv->sectionStartRow(1), 2);
+    EXPECT_EQ(lv->sectionStartRow(2), 5);
+
+    // 删除整个 section
+    m->removeRows(0, 2);
+    ASSERT_EQ(lv->sectionCount(), 2);
+    EXPECT_EQ(lv->sectionKey(0), QStringLiteral("B"));
+    EXPECT_EQ(lv->sectionStartRow(1), 3);
+
+    // dataChanged 合并 section
+    m->setData(m->index(3, 0), QStringLiteral("Brie"));
+    EXPECT_EQ(lv->sectionCount(), 1);
+    EXPECT_EQ(lv->sectionForRow(3), 0);
+}
+
+TEST_F(ListViewTest, ScrollToSectionAndStickyHeader) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    QStringList items;
+    for (int i = 0; i < 100; ++i) items << QStringLiteral("Item %1").arg(i);
+    auto* m = attachStringListModel(lv, items);
+    lv->setSectionEnabled(true);
+    lv->setSectionKeyFunction([](int row) { return QStringLiteral("Group %1").arg(row / 10); });
+    window->show();
+    QTest::qWait(50);
+    lv->doItemsLayout();
+
+    EXPECT_EQ(lv->sectionCount(), 10);
+    lv->scrollToSection(5);
+    EXPECT_LE(qAbs(lv->visualRect(m->index(50, 0)).top()), lv->spacing());
+
+    // 滚过 section 5 的行内 header 后，视口顶部由吸顶 header 覆盖，点击被吞掉
+    const int headerH = lv->visualRect(m->index(50, 0)).height() - defaultListRowHeight();
+    lv->setStickySectionHeader(true);
+    lv->verticalScrollBar()->setValue(lv->verticalScrollBar()->value() + headerH + 5);
+    QTest::qWait(10);
+    lv->setCurrentIndex(m->index(0, 0));
+    const QPoint topPos(lv->viewport()->width() / 2, 2);
+    EXPECT_EQ(lv->indexAt(topPos).row(), 50);
+    QTest::mouseClick(lv->viewport(), Qt::LeftButton, Qt::NoModifier, topPos);
+    EXPECT_EQ(lv->currentIndex().row(), 0);
+
+    lv->setStickySectionHeader(false);
+    QTest::mouseClick(lv->viewport(), Qt::LeftButton, Qt::NoModifier, topPos);
+    EXPECT_EQ(lv->currentIndex().row(), 50);
+}
+
+// ── 虚拟化均匀行 ─────────────────────────────────────────────────────────────
+
+namespace {
+
+/** 只按需生成文本的大数据量模型，避免测试本身成为瓶颈 */
+class CountingListModel : public QAbstractListModel {
+public:
+    CountingListModel(int rows, QObject* parent = nullptr)
+        : QAbstractListModel(parent), m_rows(rows) {}
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override {
+        return parent.isValid() ? 0 : m_rows;
+    }
+    QVariant data(const QModelIndex& index, int role) const override {
+        if (!index.isValid() || role != Qt::DisplayRole) return {};
+        return QStringLiteral("Row %1").arg(index.row());
+    }
+private:
+    int m_rows = 0;
+};
+
+} // namespace
+
+TEST_F(ListViewTest, VirtualizedDefaults) {
+    ListView* lv = new ListView(window);
+    EXPECT_FALSE(lv->isVirtualized());
+    EXPECT_EQ(lv->uniformRowHeight(), 0);
+
+    QSignalSpy spy(lv, &ListView::virtualizedChanged);
+    lv->setVirtualized(true);
+    lv->setVirtualized(true);
+    EXPECT_TRUE(lv->isVirtualized());
+    EXPECT_EQ(spy.count(), 1);
+}
+
+TEST_F(ListViewTest, VirtualizedUniformRowGeometry) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 200);
+    QStringList items;
+    for (int i = 0; i < 1000; ++i) items << QStringLiteral("Item %1").arg(i);
+    auto* m = attachStringListModel(lv, items);
+    lv->setVirtualized(true);
+    window->show();
+    QTest::qWait(50);
+
+    const int rowH = defaultListRowHeight();
+    const int s = lv->spacing();
+    auto* vsb = lv->verticalScrollBar();
+    EXPECT_EQ(vsb->maximum(), s + 1000 * (rowH + s) - lv->viewport()->height());
+
+    const QRect r500 = lv->visualRect(m->index(500, 0));
+    EXPECT_EQ(r500.height(), rowH);
+    EXPECT_EQ(r500.top(), s + 500 * (rowH + s) - vsb->value());
+
+    lv->scrollTo(m->index(999, 0));
+    EXPECT_EQ(vsb->value(), vsb->maximum());
+    const QRect r999 = lv->visualRect(m->index(999, 0));
+    EXPECT_TRUE(lv->viewport()->rect().contains(r999));
+    EXPECT_EQ(lv->indexAt(r999.center()).row(), 999);
+
+    // 行间 spacing 不命中任何行
+    EXPECT_FALSE(lv->indexAt(QPoint(r999.center().x(), r999.top() - 1)).isValid());
+
+    lv->setCurrentIndex(m->index(999, 0));
+    QTest::keyClick(lv, Qt::Key_Home);
+    EXPECT_EQ(lv->currentIndex().row(), 0);
+    EXPECT_EQ(vsb->value(), 0);
+}
+
+TEST_F(ListViewTest, VirtualizedSectionHeadersOffsetRows) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    QStringList items;
+    for (int i = 0; i < 100; ++i) items << QStringLiteral("Item %1").arg(i);
+    auto* m = attachStringListModel(lv, items);
+    lv->setSectionEnabled(true);
+    lv->setSectionKeyFunction([](int row) { return QString::number(row / 10); });
+    lv->setVirtualized(true);
+    window->show();
+    QTest::qWait(50);
+
+    const int rowH = defaultListRowHeight();
+    const int s = lv->spacing();
+    const int top0 = lv->visualRect(m->index(0, 0)).top();
+    const int headerH = lv->visualRect(m->index(0, 0)).height() - rowH;
+    ASSERT_GT(headerH, 0);
+
+    EXPECT_EQ(lv->visualRect(m->index(1, 0)).height(), rowH);
+    EXPECT_EQ(lv->visualRect(m->index(20, 0)).height(), rowH + headerH);
+    // 行 25 之前有 3 个 section header（0 / 10 / 20）
+    EXPECT_EQ(lv->visualRect(m->index(25, 0)).top() - top0, 25 * (rowH + s) + 3 * headerH);
+
+    // header 区域命中所属 section 的首行
+    lv->scrollTo(m->index(20, 0), QAbstractItemView::PositionAtTop);
+    const QRect r20 = lv->visualRect(m->index(20, 0));
+    EXPECT_EQ(lv->indexAt(QPoint(r20.center().x(), r20.top() + 1)).row(), 20);
+    EXPECT_EQ(lv->indexAt(QPoint(r20.center().x(), r20.bottom() - 1)).row(), 20);
+}
+
+TEST_F(ListViewTest, VirtualizedScrollToEndWithSections) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    constexpr int kRows = 20000;
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 400);
+    lv->setVirtualized(true);
+    lv->setModel(new CountingListModel(kRows, lv));
+    attachFluentDelegate(lv);
+    lv->setSectionEnabled(true);
+    lv->setSectionKeyFunction([](int row) { return QString::number(row / 100); });
+    window->show();
+    QTest::qWait(50);
+
+    // 百万行首帧 / 跳到末尾的耗时见 bench/views/collections（scroll/ListView/virtualized/1000000/*）
+    lv->scrollTo(lv->model()->index(kRows - 1, 0));
+
+    auto* vsb = lv->verticalScrollBar();
+    EXPECT_EQ(vsb->value(), vsb->maximum());
+    const QRect last = lv->visualRect(lv->model()->index(kRows - 1, 0));
+    EXPECT_TRUE(lv->viewport()->rect().contains(last));
+    EXPECT_EQ(lv->indexAt(last.center()).row(), kRows - 1);
+}
+
 // ── 跨平台 wheelEvent 测试 ─────────────────────────────────────────────────
 // 覆盖 PhaseBased / NoPhasePixel / NoPhaseDiscrete 三种事件路径，以及 cluster 节流。
 // 详见 openspec listview-cross-platform-input/.
@@ -1286,6 +1553,213 @@ TEST_F(ListViewTest, KeyboardSelectionWorksAfterNoPhaseDiscreteWheel) {
 
 // ── 可视化测试（业务组装与上面一致）───────────────────────────────────────────
 
+// ── 增量加载 ──────────────────────────────────────────────────────────────────
+
+namespace {
+QVector<PagedListModel::Row> pageRows(int first, int count) {
+    QVector<PagedListModel::Row> rows;
+    for (int i = first; i < first + count; ++i) rows.append({ QStringLiteral("Row %1").arg(i) });
+    return rows;
+}
+} // namespace
+
+TEST_F(ListViewTest, IncrementalLoadingRequestsAroundViewportAndCancelsFarPages) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    lv->setVirtualized(true);
+    attachFluentDelegate(lv);
+    lv->setIncrementalLoading(true);
+    lv->setPrefetchDistance(20);
+
+    auto* model = new PagedListModel(50, lv);
+    model->setTotalCount(1000000);
+    model->setCancelDistance(200);
+    QList<int> requested;
+    QList<int> cancelled;
+    QObject::connect(model, &PagedListModel::pageRequested, lv, [&requested](int page) { requested << page; });
+    QObject::connect(model, &PagedListModel::pageCancelled, lv, [&cancelled](int page) { cancelled << page; });
+    QSignalSpy rangeSpy(lv, &ListView::visibleRangeChanged);
+
+    lv->setModel(model);
+    window->show();
+    QTest::qWait(50);
+
+    ASSERT_FALSE(rangeSpy.isEmpty());
+    EXPECT_EQ(rangeSpy.last().at(0).toInt(), 0);
+    EXPECT_EQ(requested, QList<int>({ 0 }));
+    EXPECT_TRUE(model->index(3, 0).data(ItemLoadingRole).toBool());
+
+    model->setPageRows(0, pageRows(0, 50));
+    EXPECT_FALSE(model->index(3, 0).data(ItemLoadingRole).toBool());
+    EXPECT_EQ(model->index(3, 0).data().toString(), QStringLiteral("Row 3"));
+
+    // 拖到中部：只请求中部附近的页；再拖到底部：中部的在途请求被取消
+    auto* vsb = lv->verticalScrollBar();
+    vsb->setValue(vsb->maximum() / 2);
+    ASSERT_GT(requested.size(), 1);
+    const int middlePage = requested.last();
+    EXPECT_GT(middlePage, 1000);
+    EXPECT_TRUE(model->isPageRequested(middlePage));
+
+    vsb->setValue(vsb->maximum());
+    EXPECT_TRUE(cancelled.contains(middlePage));
+    EXPECT_FALSE(model->isPageRequested(middlePage));
+    EXPECT_TRUE(model->isPageRequested(1000000 / 50 - 1));
+
+    // 已取消页的迟到回填被忽略
+    model->setPageRows(middlePage, pageRows(middlePage * 50, 50));
+    EXPECT_FALSE(model->isPageLoaded(middlePage));
+}
+
+TEST_F(ListViewTest, IncrementalLoadingFetchesAheadForUnknownTotal) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    attachFluentDelegate(lv);
+    lv->setIncrementalLoading(true);
+    lv->setPrefetchDistance(10);
+
+    // 本地桩：异步返回，总共 3 页半
+    auto* model = new PagedListModel(20, lv);
+    QObject::connect(model, &PagedListModel::pageRequested, lv, [model](int page, int first) {
+        QTimer::singleShot(0, model, [model, page, first]() {
+            model->setPageRows(page, pageRows(first, page < 3 ? 20 : 10));
+        });
+    });
+    lv->setModel(model);
+    window->show();
+    QTest::qWait(50);
+    EXPECT_EQ(model->rowCount(), 20);   // 视口内未到预取边界前只取一页
+
+    // 每轮滚到底并处理一次异步回填；轮数上限只防止死循环
+    for (int round = 0; round < 300
+         && (model->canFetchMore(QModelIndex()) || !model->requestedPages().isEmpty()); ++round) {
+        lv->verticalScrollBar()->setValue(lv->verticalScrollBar()->maximum());
+        QTest::qWait(10);
+    }
+    ASSERT_FALSE(model->canFetchMore(QModelIndex()));
+    ASSERT_TRUE(model->requestedPages().isEmpty());
+    EXPECT_EQ(model->rowCount(), 70);
+    EXPECT_EQ(model->index(69, 0).data().toString(), QStringLiteral("Row 69"));
+}
+
+TEST_F(ListViewTest, IncrementalLoadingHorizontalFlowStopsAtViewportEdge) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    lv->setFlow(QListView::LeftToRight);
+    attachFluentDelegate(lv);
+    lv->setIncrementalLoading(true);
+    lv->setPrefetchDistance(10);
+
+    auto* model = new PagedListModel(50, lv);
+    model->setTotalCount(100000);
+    QList<int> requested;
+    QObject::connect(model, &PagedListModel::pageRequested, lv, [&requested](int page) { requested << page; });
+    QSignalSpy rangeSpy(lv, &ListView::visibleRangeChanged);
+
+    lv->setModel(model);
+    window->show();
+    QTest::qWait(50);
+
+    // 横向排列时行的 top 不会越过视口底边：应在越出右边时停下，而不是走完整个 model
+    ASSERT_FALSE(rangeSpy.isEmpty());
+    EXPECT_EQ(rangeSpy.last().at(0).toInt(), 0);
+    EXPECT_LT(rangeSpy.last().at(1).toInt(), 50);
+    EXPECT_EQ(requested, QList<int>({ 0 }));
+}
+
+TEST_F(ListViewTest, IncrementalLoadingPaintsSkeletonRows) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    lv->setBorderVisible(false);
+    attachFluentDelegate(lv);
+    lv->setIncrementalLoading(true);
+    auto* model = new PagedListModel(50, lv);
+    model->setTotalCount(50);
+    lv->setModel(model);
+    window->show();
+    QTest::qWait(50);
+
+    QImage image(lv->viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+    lv->viewport()->render(&image);
+    const QRect row0 = lv->visualRect(model->index(0, 0));
+    const int y = row0.center().y();
+    const QColor bar = image.pixelColor(row0.left() + ::Spacing::Padding::ListItemHorizontal + 4, y);
+    const QColor blank = image.pixelColor(row0.right() - 4, y);
+    EXPECT_NE(bar, blank);
+
+    // 数据到达后不再绘制骨架
+    model->setPageRows(0, QVector<PagedListModel::Row>(50, PagedListModel::Row{ QString() }));
+    image.fill(Qt::transparent);
+    lv->viewport()->render(&image);
+    EXPECT_EQ(image.pixelColor(row0.left() + ::Spacing::Padding::ListItemHorizontal + 4, y),
+              image.pixelColor(row0.right() - 4, y));
+}
+
+// ── 绘制缓存 ──────────────────────────────────────────────────────────────────
+
+TEST_F(ListViewTest, PaintCacheReusesRowPixmapsAcrossRepaints) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    QStringList rows;
+    for (int i = 0; i < 100; ++i) rows << QStringLiteral("Row %1").arg(i);
+    auto* model = attachStringListModel(lv, rows);
+    lv->setPaintCacheEnabled(true);
+    ASSERT_NE(lv->paintCache(), nullptr);
+    window->show();
+    QTest::qWait(50);
+
+    QImage first(lv->viewport()->size(), QImage::Format_ARGB32_Premultiplied);
+    first.fill(Qt::transparent);
+    lv->viewport()->render(&first);
+    const ItemPaintCache* cache = lv->paintCache();
+    EXPECT_GT(cache->count(), 0);
+
+    const int misses = cache->missCount();
+    QImage second(first.size(), first.format());
+    second.fill(Qt::transparent);
+    lv->viewport()->render(&second);
+    EXPECT_EQ(cache->missCount(), misses);
+    EXPECT_GT(cache->hitCount(), 0);
+    EXPECT_EQ(first, second);
+
+    // 数据变化只让对应行重新绘制
+    model->setData(model->index(0, 0), QStringLiteral("Changed"));
+    lv->viewport()->render(&second);
+    EXPECT_EQ(cache->missCount(), misses + 1);
+}
+
+TEST_F(ListViewTest, PaintCacheRespectsBudgetAndRestoresDelegate) {
+    ListView* lv = new ListView(window);
+    lv->setGeometry(10, 10, 300, 300);
+    QStringList rows;
+    for (int i = 0; i < 100; ++i) rows << QStringLiteral("Row %1").arg(i);
+    attachStringListModel(lv, rows);
+    QAbstractItemDelegate* userDelegate = lv->itemDelegate();
+    lv->setPaintCacheBudget(200);
+    lv->setPaintCacheEnabled(true);
+    window->show();
+    QTest::qWait(50);
+    lv->verticalScrollBar()->setValue(lv->verticalScrollBar()->maximum());
+    QTest::qWait(50);
+    EXPECT_LE(lv->paintCache()->usage(), 200);
+
+    // section 代理包在缓存外层，缓存直接包用户 delegate
+    lv->setSectionKeyFunction([](int row) { return QString::number(row / 10); });
+    lv->setSectionEnabled(true);
+    EXPECT_EQ(lv->paintCache()->innerDelegate(), userDelegate);
+    lv->setSectionEnabled(false);
+    EXPECT_EQ(lv->itemDelegate(), lv->paintCache());
+
+    lv->setPaintCacheEnabled(false);
+    EXPECT_EQ(lv->paintCache(), nullptr);
+    EXPECT_EQ(lv->itemDelegate(), userDelegate);
+}
+
 TEST_F(ListViewTest, VisualCheck) {
     if (qEnvironmentVariableIsSet("SKIP_VISUAL_TEST")) {
         GTEST_SKIP() << "Set SKIP_VISUAL_TEST=1 to skip visual tests";
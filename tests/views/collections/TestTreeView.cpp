@@ -6,13 +6,20 @@
 #include <QLabel>
 #include <QScrollArea>
 #include <QScrollBar>
+#include <QSet>
 #include <QStandardItemModel>
+#include <QTimer>
 #include "compatibility/QtCompat.h"
 #include <QtTest/QSignalSpy>
 #include <QtTest/QTest>
+#include <functional>
 
 #include "FluentTreeItemDelegate.h"
+#include "view/collections/IncrementalLoading.h"
+#include "view/collections/ItemPaintCache.h"
 #include "view/collections/TreeView.h"
+#include "view/status_info/ProgressRing.h"
+#include "viewmodel/LazyTreeModel.h"
 #include "view/QMLPlus.h"
 #include "design/Spacing.h"
 #include "design/Typography.h"
@@ -101,6 +108,48 @@ void showOffscreen(QWidget* w) {
     QApplication::processEvents();
 }
 
+/** 根下 count 个尚未加载子项的文件夹 */
+LazyTreeModel* createLazyFolders(int count, QObject* parent) {
+    auto* model = new LazyTreeModel(50, parent);
+    model->fetchMore(QModelIndex());
+    QVector<LazyTreeModel::Child> folders;
+    for (int i = 0; i < count; ++i) folders.append({ { QStringLiteral("Folder %1").arg(i) }, true });
+    model->setChildren(QModelIndex(), 0, folders, false);
+    return model;
+}
+
+/** folders 个顶层文件夹，每个 children 个子项；每隔两个子项带一个叶子 */
+QStandardItemModel* createWideTreeModel(int folders, int children, QObject* parent = nullptr) {
+    auto* model = new QStandardItemModel(parent);
+    for (int f = 0; f < folders; ++f) {
+        auto* folder = new QStandardItem(QStringLiteral("Folder %1").arg(f));
+        for (int c = 0; c < children; ++c) {
+            auto* child = new QStandardItem(QStringLiteral("Item %1.%2").arg(f).arg(c));
+            if (c % 3 == 0) child->appendRow(new QStandardItem(QStringLiteral("Leaf %1.%2").arg(f).arg(c)));
+            folder->appendRow(child);
+        }
+        model->appendRow(folder);
+    }
+    return model;
+}
+
+void forEachIndex(const QAbstractItemModel* model, const QModelIndex& parent,
+                  const std::function<void(const QModelIndex&)>& fn) {
+    for (int r = 0; r < model->rowCount(parent); ++r) {
+        const QModelIndex index = model->index(r, 0, parent);
+        fn(index);
+        forEachIndex(model, index, fn);
+    }
+}
+
+int visibleLoadingRings(TreeView* tv) {
+    int count = 0;
+    for (auto* ring : tv->viewport()->findChildren<status_info::ProgressRing*>()) {
+        if (ring->isVisible()) ++count;
+    }
+    return count;
+}
+
 /**
  * 创建一个带 CheckStateRole 的可勾选树模型 (WinUI Multi-selection 模式)
  */
@@ -791,6 +840,320 @@ TEST_F(TreeViewTest, ChevronRotationApi) {
     EXPECT_DOUBLE_EQ(tv->chevronRotation(workIdx), 1.0);
 }
 
+TEST_F(TreeViewTest, ChevronAnimatesOnlyRowsInsideViewport) {
+    TreeView* tv = new TreeView(window);
+    auto* model = new QStandardItemModel(tv);
+    for (int i = 0; i < 200; ++i) {
+        auto* folder = new QStandardItem(QStringLiteral("Folder %1").arg(i));
+        folder->appendRow(new QStandardItem(QStringLiteral("File")));
+        model->appendRow(folder);
+    }
+    tv->setModel(model);
+    tv->setFixedSize(300, 400);
+    window->resize(320, 420);
+    tv->grab();
+
+    // 视口外的节点直接落到终态，不占用补间
+    const QModelIndex offscreen = model->index(150, 0);
+    ASSERT_FALSE(tv->visualRect(offscreen).intersects(tv->viewport()->rect()));
+    tv->expand(offscreen);
+    EXPECT_DOUBLE_EQ(tv->chevronRotation(offscreen), 1.0);
+
+    const QModelIndex visible = model->index(0, 0);
+    tv->expand(visible);
+    EXPECT_LT(tv->chevronRotation(visible), 1.0);
+    QTest::qWait(300);
+    EXPECT_DOUBLE_EQ(tv->chevronRotation(visible), 1.0);
+}
+
+TEST_F(TreeViewTest, ExpandRevealOnlyAffectsExpandedSubtree) {
+    window->setAttribute(Qt::WA_DontShowOnScreen, true);
+    TreeView* tv = new TreeView(window);
+    auto* model = attachSampleModel(tv);
+    tv->setFixedSize(300, 400);
+    window->resize(320, 420);
+    window->show();
+    QTest::qWait(50);
+
+    const QModelIndex personal = model->index(1, 0);
+    tv->expand(personal);
+    const QImage revealing = tv->viewport()->grab().toImage();
+    QTest::qWait(400);
+    const QImage settled = tv->viewport()->grab().toImage();
+
+    // 子行处于渐显起点，子树之外的行（上方与下方）不受影响
+    const qreal dpr = revealing.devicePixelRatio();
+    auto region = [dpr](const QImage& image, const QRect& rect) {
+        return image.copy(QRect(rect.topLeft() * dpr, rect.size() * dpr));
+    };
+    const QRect childRect = tv->visualRect(model->index(0, 0, personal));
+    const QRect aboveRect = tv->visualRect(model->index(0, 0));
+    const QRect belowRect = tv->visualRect(model->index(2, 0));
+    EXPECT_NE(region(revealing, childRect), region(settled, childRect));
+    EXPECT_EQ(region(revealing, aboveRect), region(settled, aboveRect));
+    EXPECT_EQ(region(revealing, belowRect), region(settled, belowRect));
+}
+
+TEST_F(TreeViewTest, ExpandRevealStaggerIsCappedForManyChildren) {
+    TreeView* tv = new TreeView(window);
+    auto* model = new QStandardItemModel(tv);
+    auto* big = new QStandardItem(QStringLiteral("Big"));
+    for (int i = 0; i < 10000; ++i) big->appendRow(new QStandardItem(QStringLiteral("Child %1").arg(i)));
+    model->appendRow(big);
+    tv->setModel(model);
+    attachFluentDelegate(tv);
+    tv->setFixedSize(300, 400);
+    window->resize(320, 420);
+    window->show();
+    QTest::qWait(50);
+
+    // 绘制耗时见 bench/views/collections（paint/TreeView/expandReveal/*）
+    const QModelIndex parent = model->index(0, 0);
+    tv->expand(parent);
+    const QModelIndex near = model->index(5, 0, parent);
+    const QModelIndex far = model->index(9999, 0, parent);
+    EXPECT_LT(tv->revealProgress(far), 1.0);
+
+    // 动画过半后：延迟已封顶，最远的子行与第 6 行同步渐显（若已结束则两者均为 1）
+    QTest::qWait(150);
+    EXPECT_GT(tv->revealProgress(far), 0.0);
+    EXPECT_DOUBLE_EQ(tv->revealProgress(far), tv->revealProgress(near));
+    tv->scrollTo(far);
+    EXPECT_DOUBLE_EQ(tv->revealProgress(far), tv->revealProgress(near));
+
+    QTest::qWait(400);
+    EXPECT_DOUBLE_EQ(tv->revealProgress(far), 1.0);
+}
+
+TEST_F(TreeViewTest, PaintCacheSkipsRowsWithRunningChevron) {
+    TreeView* tv = new TreeView(window);
+    auto* model = attachSampleModel(tv);
+    tv->setFixedSize(300, 400);
+    window->resize(320, 420);
+    tv->setPaintCacheEnabled(true);
+    const ItemPaintCache* cache = tv->paintCache();
+    ASSERT_NE(cache, nullptr);
+    auto painted = [cache]() { return cache->hitCount() + cache->missCount(); };
+
+    tv->grab();
+    EXPECT_GT(cache->missCount(), 0);
+
+    // chevron 旋转期间该行每帧直接绘制，不计入缓存
+    const QModelIndex workIdx = model->index(0, 0);
+    tv->expand(workIdx);
+    int before = painted();
+    tv->grab();
+    const int duringAnimation = painted() - before;
+
+    QTest::qWait(300);
+    before = painted();
+    tv->grab();
+    EXPECT_EQ(duringAnimation, painted() - before - 1);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// On-demand children
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TreeViewTest, LazyExpandShowsLoadingRingUntilChildrenArrive) {
+    TreeView* tv = new TreeView(window);
+    attachFluentDelegate(tv);
+    auto* model = createLazyFolders(3, tv);
+    tv->setModel(model);
+    tv->setFixedSize(350, 400);
+    showOffscreen(window);
+
+    QSignalSpy requested(model, &LazyTreeModel::childrenRequested);
+    const QModelIndex folder = model->index(0, 0);
+    tv->expand(folder);
+    QApplication::processEvents();
+    ASSERT_EQ(requested.count(), 1);
+    EXPECT_TRUE(model->isLoading(folder));
+    EXPECT_EQ(visibleLoadingRings(tv), 1);
+
+    model->setChildren(folder, 0, { { { QStringLiteral("File") }, false } }, false);
+    QApplication::processEvents();
+    EXPECT_EQ(model->rowCount(folder), 1);
+    EXPECT_EQ(visibleLoadingRings(tv), 0);
+}
+
+TEST_F(TreeViewTest, CollapseCancelsInFlightChildRequests) {
+    TreeView* tv = new TreeView(window);
+    auto* model = createLazyFolders(3, tv);
+    tv->setModel(model);
+    tv->setFixedSize(350, 400);
+    showOffscreen(window);
+
+    const QModelIndex folder = model->index(1, 0);
+    tv->expand(folder);
+    QApplication::processEvents();
+    ASSERT_EQ(model->pendingRequests(), 1);
+
+    QSignalSpy cancelled(model, &LazyTreeModel::childrenCancelled);
+    tv->collapse(folder);
+    EXPECT_EQ(cancelled.count(), 1);
+    EXPECT_EQ(model->pendingRequests(), 0);
+
+    // 再次展开时重新请求同一页
+    QSignalSpy requested(model, &LazyTreeModel::childrenRequested);
+    tv->expand(folder);
+    QApplication::processEvents();
+    ASSERT_EQ(requested.count(), 1);
+    EXPECT_EQ(requested.at(0).at(1).toInt(), 0);
+}
+
+TEST_F(TreeViewTest, ExpandAllWithDepthLimitWaitsForLazyLevels) {
+    TreeView* tv = new TreeView(window);
+    auto* model = new LazyTreeModel(50, tv);
+    // 异步数据源：每层 4 个节点，第 3 层为叶子
+    QObject::connect(model, &LazyTreeModel::childrenRequested, tv,
+                     [model](const QModelIndex& parent, int offset, int) {
+        const QPersistentModelIndex p(parent);
+        QTimer::singleShot(0, model, [model, p, offset]() {
+            int depth = 0;
+            for (QModelIndex i = p; i.isValid(); i = i.parent()) ++depth;
+            QVector<LazyTreeModel::Child> children;
+            for (int i = 0; i < 4; ++i) children.append({ { QStringLiteral("Item %1").arg(i) }, depth < 2 });
+            model->setChildren(p, offset, children, false);
+        });
+    });
+    tv->setModel(model);
+    tv->setFixedSize(350, 400);
+    showOffscreen(window);
+
+    QSignalSpy finished(tv, &TreeView::expandAllFinished);
+    tv->expandAll(2);
+    EXPECT_TRUE(tv->isExpandingAll());
+    ASSERT_TRUE(finished.count() == 1 || finished.wait(3000));
+    EXPECT_FALSE(tv->isExpandingAll());
+
+    ASSERT_EQ(model->rowCount(), 4);
+    for (int i = 0; i < 4; ++i) {
+        const QModelIndex top = model->index(i, 0);
+        EXPECT_TRUE(tv->isExpanded(top));
+        ASSERT_EQ(model->rowCount(top), 4);
+        EXPECT_TRUE(tv->isExpanded(model->index(3, 0, top)));
+    }
+}
+
+TEST_F(TreeViewTest, CancelExpandAllStopsIncrementalExpansion) {
+    TreeView* tv = new TreeView(window);
+    auto* model = createLazyFolders(20, tv);
+    tv->setModel(model);
+    showOffscreen(window);
+
+    QSignalSpy finished(tv, &TreeView::expandAllFinished);
+    tv->expandAll(-1);
+    tv->cancelExpandAll();
+    QApplication::processEvents();
+    EXPECT_FALSE(tv->isExpandingAll());
+    EXPECT_EQ(finished.count(), 0);
+    EXPECT_FALSE(tv->isExpanded(model->index(0, 0)));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Flattened row index
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(TreeViewTest, RowIndexGeometryMatchesQTreeView) {
+    TreeView* tv = new TreeView(window);
+    auto* model = createWideTreeModel(30, 6, tv);
+    tv->setModel(model);
+    attachFluentDelegate(tv);
+    tv->setUniformRowHeights(true);
+    tv->setFixedSize(300, 400);
+    showOffscreen(window);
+
+    auto expectSameGeometry = [&](const char* step) {
+        forEachIndex(model, QModelIndex(), [&](const QModelIndex& index) {
+            EXPECT_EQ(tv->visualRect(index), tv->QTreeView::visualRect(index))
+                << step << ": " << index.data().toString().toStdString();
+        });
+        for (int y = -5; y < tv->viewport()->height() + 5; y += 7) {
+            const QPoint p(40, y);
+            EXPECT_EQ(tv->indexAt(p), tv->QTreeView::indexAt(p)) << step << ": y=" << y;
+        }
+    };
+
+    for (int f = 0; f < 30; f += 2) tv->expand(model->index(f, 0));
+    tv->expand(model->index(0, 0, model->index(0, 0)));
+    expectSameGeometry("expanded");
+
+    tv->collapse(model->index(4, 0));
+    tv->setRowHidden(1, model->index(2, 0), true);
+    tv->verticalScrollBar()->setValue(tv->verticalScrollBar()->maximum() / 2);
+    expectSameGeometry("collapsed + hidden + scrolled");
+
+    model->item(6)->appendRow(new QStandardItem(QStringLiteral("Added")));
+    tv->setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+    tv->verticalScrollBar()->setValue(137);
+    expectSameGeometry("per-pixel");
+
+    // 行高不统一时回落到 QTreeView 的实现
+    tv->setUniformRowHeights(false);
+    tv->collapse(model->index(6, 0));
+    expectSameGeometry("non-uniform");
+}
+
+TEST_F(TreeViewTest, RangeSelectionSpansExpandedSubtrees) {
+    TreeView* tv = new TreeView(window);
+    auto* model = createWideTreeModel(5, 4, tv);
+    tv->setModel(model);
+    attachFluentDelegate(tv);
+    tv->setSelectionMode(TreeSelectionMode::Extended);
+    tv->setUniformRowHeights(true);
+    tv->setFixedSize(300, 500);
+    tv->expand(model->index(0, 0));
+    tv->expand(model->index(0, 0, model->index(0, 0)));
+    tv->expand(model->index(1, 0));
+    showOffscreen(window);
+
+    const QModelIndex from = model->index(0, 0, model->index(0, 0));   // Item 0.0
+    const QModelIndex to = model->index(2, 0);                          // Folder 2
+    QTest::mouseClick(tv->viewport(), Qt::LeftButton, Qt::NoModifier, tv->visualRect(from).center());
+    QTest::mouseClick(tv->viewport(), Qt::LeftButton, Qt::ShiftModifier, tv->visualRect(to).center());
+
+    QSet<QPersistentModelIndex> expected;
+    for (QModelIndex i = from; i.isValid(); i = tv->indexBelow(i)) {
+        expected.insert(i);
+        if (i == to) break;
+    }
+    QSet<QPersistentModelIndex> selected;
+    for (const QModelIndex& i : tv->selectionModel()->selectedRows()) selected.insert(i);
+    EXPECT_EQ(selected.size(), expected.size());
+    EXPECT_EQ(selected, expected);
+}
+
+TEST_F(TreeViewTest, RowIndexMatchesQTreeViewOnLargeTree) {
+    TreeView* tv = new TreeView(window);
+    auto* model = new QStandardItemModel(tv);
+    for (int f = 0; f < 100; ++f) {
+        auto* folder = new QStandardItem(QStringLiteral("Folder %1").arg(f));
+        for (int c = 0; c < 500; ++c) folder->appendRow(new QStandardItem(QStringLiteral("Item %1").arg(c)));
+        model->appendRow(folder);
+    }
+    tv->setModel(model);
+    attachFluentDelegate(tv);
+    tv->setUniformRowHeights(true);
+    tv->setFixedSize(300, 400);
+    showOffscreen(window);
+    tv->expandAll();
+
+    // 耗时对比见 bench/views/collections（geometry/TreeView/*）
+    QVector<QModelIndex> targets;
+    for (int i = 0; i < 400; ++i)
+        targets.append(model->index((i * 211) % 500, 0, model->index((i * 37) % 100, 0)));
+
+    QVector<QRect> flat;
+    QVector<QRect> walked;
+    for (const QModelIndex& t : targets) flat.append(tv->visualRect(t));
+    for (const QModelIndex& t : targets) walked.append(tv->QTreeView::visualRect(t));
+    EXPECT_EQ(flat, walked);
+
+    for (const QModelIndex& t : targets) tv->scrollTo(t, QAbstractItemView::PositionAtCenter);
+    EXPECT_TRUE(tv->viewport()->rect().contains(tv->visualRect(targets.last()).center()));
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Drag reorder (file-manager style)
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -992,6 +1355,41 @@ TEST_F(TreeViewTest, DragDropOntoFolder) {
     EXPECT_EQ(work->child(work->rowCount() - 1)->text(), "Pictures");
 }
 
+TEST_F(TreeViewTest, DragDropOntoLazyFolderUsesMoveRows) {
+    // Models without QStandardItem: the drop goes through moveRows and lands before the placeholder
+    TreeView* tv = new TreeView(window);
+    auto* model = createLazyFolders(3, tv);
+    const QPersistentModelIndex target(model->index(0, 0));
+    model->fetchMore(target);
+    model->setChildren(target, 0, { { { QStringLiteral("File A") }, false }, { { QStringLiteral("File B") }, false } }, true);
+    tv->setModel(model);
+    tv->setCanReorderItems(true);
+    tv->setFixedSize(350, 400);
+    showOffscreen(window);
+    QSignalSpy reordered(tv, &TreeView::itemReordered);
+
+    QPoint start = tv->visualRect(model->index(2, 0)).center();
+    QPoint end = tv->visualRect(target).center();
+    QTest::mousePress(tv->viewport(), Qt::LeftButton, Qt::NoModifier, start);
+    QPoint moved(start.x(), start.y() - QApplication::startDragDistance() - 5);
+    QMouseEvent moveEvent1(QEvent::MouseMove, QPointF(moved), QPointF(moved),
+                           Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+    QApplication::sendEvent(tv->viewport(), &moveEvent1);
+    QApplication::processEvents();
+    QMouseEvent moveEvent2(QEvent::MouseMove, QPointF(end), QPointF(end),
+                           Qt::LeftButton, Qt::LeftButton, Qt::NoModifier);
+    QApplication::sendEvent(tv->viewport(), &moveEvent2);
+    QApplication::processEvents();
+    QTest::mouseRelease(tv->viewport(), Qt::LeftButton, Qt::NoModifier, end);
+    QApplication::processEvents();
+
+    EXPECT_EQ(model->rowCount(), 2);
+    EXPECT_EQ(model->index(2, 0, target).data().toString(), "Folder 2");
+    EXPECT_TRUE(model->index(3, 0, target).data(ItemLoadingRole).toBool());
+    ASSERT_EQ(reordered.count(), 1);
+    EXPECT_EQ(reordered.at(0).at(3).toInt(), 2);
+}
+
 TEST_F(TreeViewTest, DragCrossParentBetween) {
     // File-manager style: drag child item to root level (between root items)
     TreeView* tv = new TreeView(window);
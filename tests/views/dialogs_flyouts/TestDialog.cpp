@@ -8,6 +8,10 @@
 #include "view/basicinput/Button.h"
 #include "view/QMLPlus.h"
 #include "view/FluentElement.h"
+#include "utils/ShadowRenderer.h"
+#include <QPainter>
+#include <QPixmapCache>
+#include <QPolygon>
 
 using namespace view::dialogs_flyouts;
 using namespace view::basicinput;
@@ -122,6 +126,94 @@ TEST_F(DialogTest, ThemeSwitchNoCrash) {
 //  入场/退场动画：仅 opacity（scale 已移除以避免子控件错位）
 // ══════════════════════════════════════════════════════════════════════════════
 
+TEST_F(DialogTest, ShadowRendererNinePatchMatchesFullRender) {
+    const auto& params = Elevation::getShadow(Elevation::High, false);
+    const QRect content(24, 24, 200, 120);
+    const int radius = 8;
+
+    auto paint = [&](bool ninePatch) {
+        QImage img(QSize(280, 200), QImage::Format_ARGB32_Premultiplied);
+        img.fill(Qt::transparent);
+        QPainter p(&img);
+        if (ninePatch) {
+            ShadowRenderer::drawRoundedRectShadow(p, content, radius, params);
+        } else {
+            const int m = ShadowRenderer::extent(params);
+            const QRect outer = content.adjusted(-m, -m, m, m).translated(params.offsetX, params.offsetY);
+            QPainterPath shape;
+            shape.addRoundedRect(QRectF(m, m, content.width(), content.height()), radius, radius);
+            p.drawPixmap(outer.topLeft(), ShadowRenderer::renderShadow(shape, outer.size(), params, 1.0));
+        }
+        return img;
+    };
+
+    QPixmapCache::clear();
+    const QImage stretched = paint(true);
+    const QImage reference = paint(false);
+
+    // 九宫格拉伸与整张模糊结果逐像素接近（允许 1 级量化误差）
+    int maxDiff = 0;
+    for (int y = 0; y < stretched.height(); ++y)
+        for (int x = 0; x < stretched.width(); ++x)
+            maxDiff = qMax(maxDiff, qAbs(qAlpha(stretched.pixel(x, y)) - qAlpha(reference.pixel(x, y))));
+    EXPECT_LE(maxDiff, 1);
+
+    // 阴影随离开内容边缘的距离衰减，且超出 blurRadius 后基本透明
+    const int y = content.center().y();
+    const int a1 = qAlpha(stretched.pixel(content.right() + 2, y));
+    const int a2 = qAlpha(stretched.pixel(content.right() + params.blurRadius / 2, y));
+    EXPECT_GT(a1, a2);
+    EXPECT_LE(qAlpha(stretched.pixel(content.right() + params.blurRadius + 4, y)), 1);
+
+    // 第二次绘制命中缓存，结果一致
+    EXPECT_EQ(paint(true), stretched);
+}
+
+TEST_F(DialogTest, ShadowRendererShapeKeyBuildsPathOnlyOnMiss) {
+    const auto& params = Elevation::getShadow(Elevation::High, false);
+    const QRect card(40, 40, 160, 90);
+    auto buildBubble = [&] {
+        QPainterPath path;
+        path.addRoundedRect(card, 8, 8);
+        QPainterPath tail;
+        tail.addPolygon(QPolygon({ QPoint(90, 42), QPoint(110, 42), QPoint(100, 28) }));
+        return path.united(tail);
+    };
+
+    int builds = 0;
+    auto paint = [&](bool keyed) {
+        QImage img(QSize(280, 200), QImage::Format_ARGB32_Premultiplied);
+        img.fill(Qt::transparent);
+        QPainter p(&img);
+        if (keyed) {
+            ShadowRenderer::drawPathShadow(p, QStringLiteral("test_bubble"), card.adjusted(-12, -12, 12, 12),
+                                           [&] { ++builds; return buildBubble(); }, params);
+        } else {
+            const int m = ShadowRenderer::extent(params);
+            const QRect box = card.adjusted(-12 - m, -12 - m, 12 + m, 12 + m);
+            QPainterPath shape = buildBubble().translated(-box.topLeft());
+            p.drawPixmap(box.topLeft() + QPoint(params.offsetX, params.offsetY),
+                         ShadowRenderer::renderShadow(shape, box.size(), params, 1.0));
+        }
+        return img;
+    };
+
+    QPixmapCache::clear();
+    const QImage keyed = paint(true);
+    const QImage reference = paint(false);
+    EXPECT_EQ(builds, 1);
+
+    int maxDiff = 0;
+    for (int y = 0; y < keyed.height(); ++y)
+        for (int x = 0; x < keyed.width(); ++x)
+            maxDiff = qMax(maxDiff, qAbs(qAlpha(keyed.pixel(x, y)) - qAlpha(reference.pixel(x, y))));
+    EXPECT_LE(maxDiff, 1);
+
+    // 命中缓存：不再构造路径，结果一致
+    EXPECT_EQ(paint(true), keyed);
+    EXPECT_EQ(builds, 1);
+}
+
 TEST_F(DialogTest, DialogEntranceAnimatesOpacity) {
     // 入场：progress=0 时 windowOpacity 应为 0；progress=1 时为 1
     Dialog dialog(window);